@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   template<typename Dim>
+   dimension_array<Dim> make_array(std::size_t count, double start)
+   {
+      dimension_array<Dim> values = dimension_array<Dim>::uninitialized(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values.data()[i] = start + static_cast<double>(i) * 0.001;
+      }
+      return values;
+   }
+}
+
+// Baseline: mass * specific heat * delta T, building temporary base_dimensions per element
+static void BM_PerElement_HeatTransfer(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto masses = make_array<mass<kilo_grams>>(count, 1.0);
+   const auto deltaTemps = make_array<temperature<kelvin>>(count, 10.0);
+   auto heat = dimension_array<energy<calories>>::uninitialized(count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         heat.set(i, masses[i] * constants::specific_heat_water * deltaTemps[i]);
+      }
+      benchmark::DoNotOptimize(heat.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerElement_HeatTransfer)->Range(1 << 10, 1 << 20);
+
+static void BM_Expression_HeatTransfer(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto masses = make_array<mass<kilo_grams>>(count, 1.0);
+   const auto deltaTemps = make_array<temperature<kelvin>>(count, 10.0);
+   auto heat = dimension_array<energy<calories>>::uninitialized(count);
+
+   for (auto _ : state)
+   {
+      heat = masses * constants::specific_heat_water * deltaTemps;
+      benchmark::DoNotOptimize(heat.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Expression_HeatTransfer)->Range(1 << 10, 1 << 20);
+
+// Mixed-unit sum, which converts the right operand on every element
+static void BM_PerElement_MixedSum(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto metersArr = make_array<length<meters>>(count, 1.0);
+   const auto feetArr = make_array<length<feet>>(count, 2.0);
+   auto total = dimension_array<length<inches>>::uninitialized(count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         total.set(i, metersArr[i] + feetArr[i]);
+      }
+      benchmark::DoNotOptimize(total.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerElement_MixedSum)->Range(1 << 10, 1 << 20);
+
+static void BM_Expression_MixedSum(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto metersArr = make_array<length<meters>>(count, 1.0);
+   const auto feetArr = make_array<length<feet>>(count, 2.0);
+   auto total = dimension_array<length<inches>>::uninitialized(count);
+
+   for (auto _ : state)
+   {
+      total = metersArr + feetArr;
+      benchmark::DoNotOptimize(total.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Expression_MixedSum)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "dimensional.h"
+#include "NewLengthUnits.h"
+
+using namespace dimension;
+
+namespace
+{
+   std::vector<double> make_input(std::size_t count)
+   {
+      std::vector<double> values(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values[i] = static_cast<double>(i) * 0.5;
+      }
+      return values;
+   }
+}
+
+// Baseline: one get_dimension_as call per element
+static void BM_PerElement_Delta(benchmark::State& state)
+{
+   const std::vector<double> in = make_input(static_cast<std::size_t>(state.range(0)));
+   std::vector<double> out(in.size());
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < in.size(); ++i)
+      {
+         out[i] = get_length_as<meters>(length<feet>(in[i]));
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerElement_Delta)->Range(1 << 10, 1 << 20);
+
+static void BM_ConvertSpan_Delta(benchmark::State& state)
+{
+   const std::vector<double> in = make_input(static_cast<std::size_t>(state.range(0)));
+   std::vector<double> out(in.size());
+
+   for (auto _ : state)
+   {
+      convert_span<feet, meters>(in, out);
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvertSpan_Delta)->Range(1 << 10, 1 << 20);
+
+// Baseline: the scalar offset path, one ConvertImpl-style step per element through the primary unit
+static void BM_PerElement_Offset(benchmark::State& state)
+{
+   const std::vector<double> in = make_input(static_cast<std::size_t>(state.range(0)));
+   std::vector<double> out(in.size());
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < in.size(); ++i)
+      {
+         const double inMeters = ConvertImpl<Conversion<meters, feet>, true, true>(in[i]);
+         out[i] = ConvertImpl<Conversion<meters, Baz>, false, false>(inMeters);
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerElement_Offset)->Range(1 << 10, 1 << 20);
+
+static void BM_ConvertSpan_Offset(benchmark::State& state)
+{
+   const std::vector<double> in = make_input(static_cast<std::size_t>(state.range(0)));
+   std::vector<double> out(in.size());
+
+   for (auto _ : state)
+   {
+      convert_span<feet, Baz, quantity>(in, out);
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvertSpan_Offset)->Range(1 << 10, 1 << 20);
+
+static void BM_DimensionArray_As(benchmark::State& state)
+{
+   dimension_array<length<feet>> arr(make_input(static_cast<std::size_t>(state.range(0))));
+
+   for (auto _ : state)
+   {
+      auto converted = arr.as<unit_exponent<meters>>();
+      benchmark::DoNotOptimize(converted.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DimensionArray_As)->Range(1 << 10, 1 << 20);
+
+// Baseline: one get_point_as call per temperature point
+static void BM_PerElement_Point(benchmark::State& state)
+{
+   const std::vector<double> in = make_input(static_cast<std::size_t>(state.range(0)));
+   std::vector<double> out(in.size());
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < in.size(); ++i)
+      {
+         out[i] = get_point_as<fahrenheit>(point<celsius, temperatureType>(in[i]));
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerElement_Point)->Range(1 << 10, 1 << 20);
+
+static void BM_ConvertPoints(benchmark::State& state)
+{
+   const std::vector<double> in = make_input(static_cast<std::size_t>(state.range(0)));
+   std::vector<double> out(in.size());
+
+   for (auto _ : state)
+   {
+      convert_points<fahrenheit, celsius>(in, out);
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvertPoints)->Range(1 << 10, 1 << 20);
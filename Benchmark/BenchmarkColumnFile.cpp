@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "dimensional.h"
+#include "Dimension_Core/ColumnFile.h"
+
+using namespace dimension;
+
+namespace
+{
+   constexpr std::size_t ColumnSamples = 1 << 22;
+
+   const std::filesystem::path& column_path()
+   {
+      static const std::filesystem::path path = []
+      {
+         auto file = std::filesystem::temp_directory_path() / "dimension_benchmark_column.dcol";
+         std::vector<double> values(ColumnSamples);
+         for (std::size_t i = 0; i < ColumnSamples; ++i)
+         {
+            values[i] = static_cast<double>(i % 1000);
+         }
+         write_column<length<feet>>(file, values);
+         return file;
+      }();
+      return path;
+   }
+}
+
+// Baseline: read the whole file into memory and convert it
+static void BM_ColumnReadStream(benchmark::State& state)
+{
+   const auto& path = column_path();
+   for (auto _ : state)
+   {
+      std::ifstream in(path, std::ios::binary);
+      column_header header;
+      in.read(reinterpret_cast<char*>(&header), sizeof(header));
+      in.seekg(static_cast<std::streamoff>(header.data_offset));
+      std::vector<double> values(header.count);
+      in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(header.count * sizeof(double)));
+      for (double& v : values)
+      {
+         v *= 0.3048;
+      }
+      benchmark::DoNotOptimize(values.data());
+   }
+   state.SetBytesProcessed(state.iterations() * ColumnSamples * sizeof(double));
+}
+BENCHMARK(BM_ColumnReadStream)->Unit(benchmark::kMicrosecond);
+
+static void BM_ColumnOpenExact(benchmark::State& state)
+{
+   const auto& path = column_path();
+   for (auto _ : state)
+   {
+      const mapped_column<length<feet>> column(path);
+      benchmark::DoNotOptimize(column.values().data());
+   }
+   state.SetBytesProcessed(state.iterations() * ColumnSamples * sizeof(double));
+}
+BENCHMARK(BM_ColumnOpenExact)->Unit(benchmark::kMicrosecond);
+
+static void BM_ColumnOpenConverted(benchmark::State& state)
+{
+   const auto& path = column_path();
+   for (auto _ : state)
+   {
+      const mapped_column<length<meters>> column(path);
+      benchmark::DoNotOptimize(column.values().data());
+   }
+   state.SetBytesProcessed(state.iterations() * ColumnSamples * sizeof(double));
+}
+BENCHMARK(BM_ColumnOpenConverted)->Unit(benchmark::kMicrosecond);
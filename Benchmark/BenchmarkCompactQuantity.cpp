@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <ratio>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   using sensor_codec = codec::scaled<std::int16_t, std::centi>;
+
+   dimension_array<temperature<kelvin>> make_readings(std::size_t count)
+   {
+      auto values = dimension_array<temperature<kelvin>>::uninitialized(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values.data()[i] = 250.0 + static_cast<double>(i % 5000) * 0.01;
+      }
+      return values;
+   }
+}
+
+// Baseline: the same update on a full width array
+static void BM_OffsetDoubleArray(benchmark::State& state)
+{
+   auto values = make_readings(static_cast<std::size_t>(state.range(0)));
+
+   for (auto _ : state)
+   {
+      double* raw = values.data();
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         raw[i] += 0.01;
+      }
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+   state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(double)));
+}
+BENCHMARK(BM_OffsetDoubleArray)->Arg(1 << 16)->Arg(1 << 24);
+
+template<typename Codec>
+static void BM_OffsetCompactArray(benchmark::State& state)
+{
+   compact_array<temperature<kelvin>, Codec> values(make_readings(static_cast<std::size_t>(state.range(0))));
+
+   for (auto _ : state)
+   {
+      values += temperature<kelvin>(0.01);
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+   state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(typename Codec::storage_type)));
+}
+BENCHMARK_TEMPLATE(BM_OffsetCompactArray, codec::float16)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK_TEMPLATE(BM_OffsetCompactArray, codec::bfloat16)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK_TEMPLATE(BM_OffsetCompactArray, sensor_codec)->Arg(1 << 16)->Arg(1 << 24);
+
+template<typename Codec>
+static void BM_DecodeCompactArray(benchmark::State& state)
+{
+   const compact_array<temperature<kelvin>, Codec> values(make_readings(static_cast<std::size_t>(state.range(0))));
+   auto out = dimension_array<temperature<kelvin>>::uninitialized(values.size());
+
+   for (auto _ : state)
+   {
+      values.decode(0, out.values());
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_DecodeCompactArray, codec::float16)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_DecodeCompactArray, sensor_codec)->Arg(1 << 16);
+
+template<typename Codec>
+static void BM_EncodeCompactArray(benchmark::State& state)
+{
+   const auto readings = make_readings(static_cast<std::size_t>(state.range(0)));
+   compact_array<temperature<kelvin>, Codec> values(readings.size());
+
+   for (auto _ : state)
+   {
+      values.encode(0, readings.values());
+      benchmark::DoNotOptimize(values.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_EncodeCompactArray, codec::float16)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_EncodeCompactArray, sensor_codec)->Arg(1 << 16);
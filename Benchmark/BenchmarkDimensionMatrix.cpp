@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   using state = std::tuple<length<meters>, length<meters>, length<meters>,
+                            speed<meters, seconds>, speed<meters, seconds>, speed<meters, seconds>>;
+   using transition = dimension_matrix<state, inverse_dimensions_t<state>>;
+   using covariance = dimension_matrix<state, state>;
+
+   constexpr std::size_t n = 6;
+   using raw_matrix = std::array<double, n * n>;
+
+   raw_matrix make_raw(double seed)
+   {
+      raw_matrix values{};
+      for (std::size_t i = 0; i < n * n; ++i)
+      {
+         values[i] = seed + static_cast<double>(i % 7) * 0.125;
+      }
+      return values;
+   }
+
+   raw_matrix multiply(const raw_matrix& a, const raw_matrix& b)
+   {
+      raw_matrix c{};
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         for (std::size_t k = 0; k < n; ++k)
+         {
+            for (std::size_t j = 0; j < n; ++j)
+            {
+               c[i * n + j] += a[i * n + k] * b[k * n + j];
+            }
+         }
+      }
+      return c;
+   }
+
+   raw_matrix transpose(const raw_matrix& a)
+   {
+      raw_matrix t{};
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         for (std::size_t j = 0; j < n; ++j)
+         {
+            t[j * n + i] = a[i * n + j];
+         }
+      }
+      return t;
+   }
+}
+
+// Baseline: covariance prediction F P F^T + Q on plain doubles
+static void BM_PredictRawDouble(benchmark::State& state)
+{
+   const raw_matrix f = make_raw(1.0);
+   const raw_matrix q = make_raw(0.01);
+   raw_matrix p = make_raw(0.5);
+
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(p);
+      raw_matrix next = multiply(multiply(f, p), ::transpose(f));
+      for (std::size_t i = 0; i < n * n; ++i) { next[i] += q[i]; }
+      benchmark::DoNotOptimize(next);
+   }
+}
+BENCHMARK(BM_PredictRawDouble);
+
+static void BM_PredictDimensionMatrix(benchmark::State& state)
+{
+   const auto f = transition::from_raw(make_raw(1.0));
+   const auto q = covariance::from_raw(make_raw(0.01));
+   auto p = covariance::from_raw(make_raw(0.5));
+
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(p);
+      const covariance next = f * p * dimension::transpose(f) + q;
+      benchmark::DoNotOptimize(next);
+   }
+}
+BENCHMARK(BM_PredictDimensionMatrix);
+
+static void BM_InverseDimensionMatrix(benchmark::State& state)
+{
+   auto p = covariance::from_raw(make_raw(0.5));
+   for (std::size_t i = 0; i < n; ++i) { p = p + covariance::from_raw([i] { raw_matrix d{}; d[i * n + i] = 10.0; return d; }()); }
+
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(p);
+      const auto inv = inverse(p);
+      benchmark::DoNotOptimize(inv);
+   }
+}
+BENCHMARK(BM_InverseDimensionMatrix);
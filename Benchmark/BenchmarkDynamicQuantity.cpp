@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   std::vector<speed<feet, seconds>> make_speeds(std::size_t count)
+   {
+      std::vector<speed<feet, seconds>> values;
+      values.reserve(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values.emplace_back(static_cast<double>(i % 100) + 0.5);
+      }
+      return values;
+   }
+}
+
+// Baseline: the same conversion on the static type
+static void BM_StaticConvert(benchmark::State& state)
+{
+   const auto values = make_speeds(static_cast<std::size_t>(state.range(0)));
+
+   for (auto _ : state)
+   {
+      double total = 0.0;
+      for (const auto& value : values)
+      {
+         total += get_speed_as<meters, seconds>(value);
+      }
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StaticConvert)->Arg(4096);
+
+static void BM_DynamicQuantityCast(benchmark::State& state)
+{
+   const auto speeds = make_speeds(static_cast<std::size_t>(state.range(0)));
+   const std::vector<dynamic_quantity> values(speeds.begin(), speeds.end());
+
+   for (auto _ : state)
+   {
+      double total = 0.0;
+      for (const auto& value : values)
+      {
+         total += get_speed_as<meters, seconds>(quantity_cast<speed<meters, seconds>>(value));
+      }
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DynamicQuantityCast)->Arg(4096);
+
+static void BM_DynamicMultiply(benchmark::State& state)
+{
+   const auto speeds = make_speeds(static_cast<std::size_t>(state.range(0)));
+   const std::vector<dynamic_quantity> values(speeds.begin(), speeds.end());
+   const dynamic_quantity duration(timespan<minutes>(2.0));
+   std::vector<dynamic_quantity> out(values.size());
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         out[i] = values[i] * duration;
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DynamicMultiply)->Arg(4096);
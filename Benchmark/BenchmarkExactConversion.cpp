@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   std::vector<length<std::int32_t, milli_meters>> make_telemetry(std::size_t count)
+   {
+      std::vector<length<std::int32_t, milli_meters>> values;
+      values.reserve(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values.emplace_back(static_cast<std::int32_t>(i * 7919 % 2000000) - 1000000);
+      }
+      return values;
+   }
+}
+
+// Baseline: the floating-point path integral Reps used before, through a double factor
+static void BM_IntegralThroughDouble(benchmark::State& state)
+{
+   const auto values = make_telemetry(static_cast<std::size_t>(state.range(0)));
+   std::vector<std::int32_t> out(values.size());
+   constexpr double factor = conversion_factor_v<std::tuple<unit_exponent<milli_meters>>, std::tuple<unit_exponent<centi_meters>>>;
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         out[i] = static_cast<std::int32_t>(static_cast<double>(get_length_as<milli_meters>(values[i])) * factor);
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntegralThroughDouble)->Range(1 << 10, 1 << 16);
+
+static void BM_IntegralExact(benchmark::State& state)
+{
+   const auto values = make_telemetry(static_cast<std::size_t>(state.range(0)));
+   std::vector<std::int32_t> out(values.size());
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         out[i] = get_length_as<centi_meters>(values[i]);
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntegralExact)->Range(1 << 10, 1 << 16);
+
+static void BM_IntegralExactRoundedSaturated(benchmark::State& state)
+{
+   const auto values = make_telemetry(static_cast<std::size_t>(state.range(0)));
+   std::vector<length<std::int16_t, meters>> out(values.size());
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         out[i] = dimension_cast<length<std::int16_t, meters>, rounding::to_nearest, overflow::saturate>(values[i]);
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntegralExactRoundedSaturated)->Range(1 << 10, 1 << 16);
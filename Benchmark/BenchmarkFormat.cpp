@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <sstream>
+#include <string>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+// Baseline: to_string as it was, one ostringstream per call and the units written piece by piece
+static void BM_ToStringStream(benchmark::State& state)
+{
+   double value = 1.0;
+   for (auto _ : state)
+   {
+      const speed<meters, seconds> v(value);
+      std::ostringstream os;
+      os << get_speed_as<meters, seconds>(v) << " [";
+      stream_units_tuple<std::ostream, typename speed<meters, seconds>::units>(os);
+      os << "]";
+      std::string text = os.str();
+      benchmark::DoNotOptimize(text.data());
+      value += 0.25;
+   }
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToStringStream);
+
+static void BM_ToString(benchmark::State& state)
+{
+   double value = 1.0;
+   for (auto _ : state)
+   {
+      std::string text = to_string(speed<meters, seconds>(value));
+      benchmark::DoNotOptimize(text.data());
+      value += 0.25;
+   }
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToString);
+
+static void BM_ToChars(benchmark::State& state)
+{
+   std::array<char, 64> buffer{};
+   double value = 1.0;
+   for (auto _ : state)
+   {
+      const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), speed<meters, seconds>(value), std::chars_format::general, 6);
+      benchmark::DoNotOptimize(result.ptr);
+      benchmark::ClobberMemory();
+      value += 0.25;
+   }
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToChars);
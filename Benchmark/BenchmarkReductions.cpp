@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   dimension_array<length<feet>> make_lengths(std::size_t count)
+   {
+      dimension_array<length<feet>> values(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values.data()[i] = 1.0 + static_cast<double>(i % 1000) * 0.001;
+      }
+      return values;
+   }
+}
+
+// Baseline: accumulate through operator+, into a meters total
+static void BM_SumAccumulate(benchmark::State& state)
+{
+   const auto values = make_lengths(static_cast<std::size_t>(state.range(0)));
+
+   for (auto _ : state)
+   {
+      const length<meters> total = std::accumulate(values.begin(), values.end(), length<meters>(0.0),
+         [](const length<meters>& acc, const length<feet>& value) { return acc + value; });
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumAccumulate)->Range(1 << 10, 1 << 22);
+
+static void BM_Sum(benchmark::State& state)
+{
+   const auto values = make_lengths(static_cast<std::size_t>(state.range(0)));
+
+   for (auto _ : state)
+   {
+      const length<meters> total = sum(values);
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sum)->Range(1 << 10, 1 << 22);
+
+static void BM_SumNeumaier(benchmark::State& state)
+{
+   const auto values = make_lengths(static_cast<std::size_t>(state.range(0)));
+
+   for (auto _ : state)
+   {
+      const length<meters> total = sum<summation::neumaier>(values);
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumNeumaier)->Range(1 << 10, 1 << 22);
+
+static void BM_SumParallel(benchmark::State& state)
+{
+   const auto values = make_lengths(static_cast<std::size_t>(state.range(0)));
+
+   for (auto _ : state)
+   {
+      const length<meters> total = sum(execution::par, values);
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumParallel)->Range(1 << 16, 1 << 22)->UseRealTime();
+
+// Baseline: compare every element against a threshold in other units
+static void BM_CountIfPerElement(benchmark::State& state)
+{
+   const auto values = make_lengths(static_cast<std::size_t>(state.range(0)));
+   const length<meters> threshold(0.4);
+
+   for (auto _ : state)
+   {
+      std::size_t matches = 0;
+      for (const auto& value : values)
+      {
+         matches += static_cast<std::size_t>(value > threshold);
+      }
+      benchmark::DoNotOptimize(matches);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountIfPerElement)->Range(1 << 10, 1 << 22);
+
+static void BM_CountIfThreshold(benchmark::State& state)
+{
+   const auto values = make_lengths(static_cast<std::size_t>(state.range(0)));
+
+   for (auto _ : state)
+   {
+      const std::size_t matches = count_if(values, greater_than(length<meters>(0.4)));
+      benchmark::DoNotOptimize(matches);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountIfThreshold)->Range(1 << 10, 1 << 22);
@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   template<typename T>
+   std::vector<T> make_values(std::size_t count, T start)
+   {
+      std::vector<T> values(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values[i] = start + static_cast<T>(i % 1000) * T{0.001f};
+      }
+      return values;
+   }
+}
+
+// Distance / time, halved and converted to km/h, entirely at the precision of T.
+// float and double share the same code, so the difference is the width of the data.
+template<typename T>
+static void BM_SpeedPipeline(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto distances = make_values<T>(count, T{1.0f});
+   const auto times = make_values<T>(count, T{2.0f});
+   std::vector<T> speeds(count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         const auto average = length<T, feet>(distances[i]) / timespan<T, seconds>(times[i]) * 0.5;
+         speeds[i] = get_speed_as<kilo_meters, hours>(average);
+      }
+      benchmark::DoNotOptimize(speeds.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+   state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(3 * sizeof(T)));
+}
+BENCHMARK_TEMPLATE(BM_SpeedPipeline, float)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SpeedPipeline, double)->Range(1 << 10, 1 << 20);
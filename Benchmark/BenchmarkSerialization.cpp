@@ -0,0 +1,285 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   constexpr std::size_t Samples = 1024;
+
+   std::vector<pressure<pascals>> make_samples()
+   {
+      std::vector<pressure<pascals>> samples;
+      samples.reserve(Samples);
+      for (std::size_t i = 0; i < Samples; ++i)
+      {
+         samples.emplace_back(101325.0 + static_cast<double>(i));
+      }
+      return samples;
+   }
+}
+
+// Baseline: one tagged buffer allocated per value
+static void BM_SerializePerValue(benchmark::State& state)
+{
+   const auto samples = make_samples();
+   for (auto _ : state)
+   {
+      for (const auto& sample : samples)
+      {
+         auto buffer = serialize(sample);
+         benchmark::DoNotOptimize(buffer.data());
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(BM_SerializePerValue);
+
+static void BM_SerializeBlock(benchmark::State& state)
+{
+   const auto samples = make_samples();
+   std::array<std::byte, BlockSerializationPolicy<FNV_1a_32Bit>::block_size<pressure<pascals>>(Samples)> buffer;
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(serialize_block<pressure<pascals>>(buffer, samples));
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(BM_SerializeBlock);
+
+static void BM_DeserializePerValue(benchmark::State& state)
+{
+   std::vector<std::vector<uint8_t>> buffers;
+   for (const auto& sample : make_samples())
+   {
+      buffers.push_back(serialize(sample));
+   }
+   for (auto _ : state)
+   {
+      for (const auto& buffer : buffers)
+      {
+         benchmark::DoNotOptimize(deserialize<pressure<pascals>>(buffer));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(BM_DeserializePerValue);
+
+static void BM_DeserializeBlock(benchmark::State& state)
+{
+   std::array<std::byte, BlockSerializationPolicy<FNV_1a_32Bit>::block_size<pressure<pascals>>(Samples)> buffer;
+   serialize_block<pressure<pascals>>(buffer, make_samples());
+   std::vector<pressure<pascals>> result(Samples);
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(deserialize_block<pressure<pascals>>(buffer, std::span(result)));
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(BM_DeserializeBlock);
+
+namespace
+{
+   constexpr std::size_t ScanSamples = 1 << 20;
+
+   std::vector<std::byte> make_block()
+   {
+      std::vector<double> values(ScanSamples);
+      for (std::size_t i = 0; i < ScanSamples; ++i)
+      {
+         values[i] = 101325.0 + static_cast<double>(i % 1000);
+      }
+      std::vector<std::byte> buffer(BlockSerializationPolicy<FNV_1a_32Bit>::block_size<pressure<pascals>>(ScanSamples));
+      serialize_block<pressure<pascals>>(buffer, std::span<const double>(values));
+      return buffer;
+   }
+}
+
+// Baseline: copy the block out before scanning it
+static void BM_ScanDeserialized(benchmark::State& state)
+{
+   const auto buffer = make_block();
+   std::vector<pressure<pascals>> result(ScanSamples);
+   for (auto _ : state)
+   {
+      deserialize_block<pressure<pascals>>(buffer, std::span(result));
+      double sum = 0.0;
+      for (const auto& p : result)
+      {
+         sum += get_pressure_as<pascals>(p);
+      }
+      benchmark::DoNotOptimize(sum);
+   }
+   state.SetBytesProcessed(state.iterations() * ScanSamples * sizeof(double));
+}
+BENCHMARK(BM_ScanDeserialized);
+
+static void BM_ScanViewIterator(benchmark::State& state)
+{
+   const auto buffer = make_block();
+   for (auto _ : state)
+   {
+      const serialized_view<pressure<pascals>> view(buffer);
+      double sum = 0.0;
+      for (const auto p : view)
+      {
+         sum += get_pressure_as<pascals>(p);
+      }
+      benchmark::DoNotOptimize(sum);
+   }
+   state.SetBytesProcessed(state.iterations() * ScanSamples * sizeof(double));
+}
+BENCHMARK(BM_ScanViewIterator);
+
+static void BM_ScanViewValues(benchmark::State& state)
+{
+   const auto buffer = make_block();
+   for (auto _ : state)
+   {
+      const serialized_view<pressure<pascals>> view(buffer);
+      double sum = 0.0;
+      for (const double v : view.values())
+      {
+         sum += v;
+      }
+      benchmark::DoNotOptimize(sum);
+   }
+   state.SetBytesProcessed(state.iterations() * ScanSamples * sizeof(double));
+}
+BENCHMARK(BM_ScanViewValues);
+
+namespace
+{
+   using convertible = ConvertibleBlockSerializationPolicy;
+
+   std::vector<double> make_heights()
+   {
+      std::vector<double> values(Samples);
+      for (std::size_t i = 0; i < Samples; ++i)
+      {
+         values[i] = 5.0 + static_cast<double>(i % 100) * 0.01;
+      }
+      return values;
+   }
+}
+
+// Baseline: read the block in the units it was written in, then convert each object
+static void BM_DeserializeBlockThenConvert(benchmark::State& state)
+{
+   std::vector<std::byte> buffer(BlockSerializationPolicy<FNV_1a_32Bit>::block_size<length<feet>>(Samples));
+   serialize_block<length<feet>>(buffer, std::span<const double>(make_heights()));
+   std::vector<length<feet>> written(Samples);
+   std::vector<length<meters>> result(Samples);
+   for (auto _ : state)
+   {
+      deserialize_block<length<feet>>(buffer, std::span(written));
+      for (std::size_t i = 0; i < Samples; ++i)
+      {
+         result[i] = length<meters>(get_length_as<meters>(written[i]));
+      }
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(BM_DeserializeBlockThenConvert);
+
+static void BM_DeserializeConvertibleExact(benchmark::State& state)
+{
+   std::vector<std::byte> buffer(convertible::block_size<length<feet>>(Samples));
+   convertible::serialize<length<feet>>(buffer, std::span<const double>(make_heights()));
+   std::vector<double> result(Samples);
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(convertible::deserialize<length<feet>>(buffer, std::span(result)));
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(BM_DeserializeConvertibleExact);
+
+static void BM_DeserializeConvertibleConverted(benchmark::State& state)
+{
+   std::vector<std::byte> buffer(convertible::block_size<length<feet>>(Samples));
+   convertible::serialize<length<feet>>(buffer, std::span<const double>(make_heights()));
+   std::vector<double> result(Samples);
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(convertible::deserialize<length<meters>>(buffer, std::span(result)));
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(BM_DeserializeConvertibleConverted);
+
+static void BM_DeserializeConvertibleObjects(benchmark::State& state)
+{
+   std::vector<std::byte> buffer(convertible::block_size<length<feet>>(Samples));
+   convertible::serialize<length<feet>>(buffer, std::span<const double>(make_heights()));
+   std::vector<length<meters>> result(Samples);
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(convertible::deserialize<length<meters>>(buffer, std::span(result)));
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(BM_DeserializeConvertibleObjects);
+
+namespace
+{
+   constexpr std::size_t PortableSamples = 1 << 16;
+   constexpr std::endian foreign_order = std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+
+   template<typename Policy>
+   std::vector<std::byte> make_portable_block()
+   {
+      std::vector<double> values(PortableSamples);
+      for (std::size_t i = 0; i < PortableSamples; ++i)
+      {
+         values[i] = 101325.0 + static_cast<double>(i % 1000);
+      }
+      std::vector<std::byte> buffer(Policy::template block_size<pressure<pascals>>(PortableSamples));
+      Policy::template serialize<pressure<pascals>>(buffer, std::span<const double>(values));
+      return buffer;
+   }
+}
+
+// A copy when the wire order matches the host, a byte swap otherwise
+template<std::endian WireOrder>
+static void BM_DeserializePortable(benchmark::State& state)
+{
+   using policy = PortableSerializationPolicy<FNV_1a_32Bit, WireOrder>;
+   const auto buffer = make_portable_block<policy>();
+   std::vector<double> result(PortableSamples);
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(policy::template deserialize<pressure<pascals>>(buffer, std::span(result)));
+      benchmark::ClobberMemory();
+   }
+   state.SetBytesProcessed(state.iterations() * PortableSamples * sizeof(double));
+}
+BENCHMARK(BM_DeserializePortable<std::endian::native>);
+BENCHMARK(BM_DeserializePortable<foreign_order>);
+
+// Baseline: swap each value while constructing the objects
+static void BM_DeserializePortableObjects(benchmark::State& state)
+{
+   using policy = PortableSerializationPolicy<FNV_1a_32Bit, foreign_order>;
+   const auto buffer = make_portable_block<policy>();
+   std::vector<pressure<pascals>> result(PortableSamples);
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(policy::deserialize<pressure<pascals>>(buffer, std::span(result)));
+      benchmark::ClobberMemory();
+   }
+   state.SetBytesProcessed(state.iterations() * PortableSamples * sizeof(double));
+}
+BENCHMARK(BM_DeserializePortableObjects);
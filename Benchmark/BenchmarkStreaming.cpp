@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   constexpr std::size_t Records = 1 << 20;
+
+   using sample = pressure<pascals>;
+}
+
+// Baseline: one allocated buffer per record, handed over through a locked queue
+static void BM_StreamLockedQueue(benchmark::State& state)
+{
+   for (auto _ : state)
+   {
+      std::deque<std::vector<uint8_t>> queue;
+      std::mutex mutex;
+      std::condition_variable ready;
+      bool done = false;
+      double total = 0.0;
+
+      std::thread consumer([&]
+      {
+         std::unique_lock lock(mutex);
+         while (true)
+         {
+            ready.wait(lock, [&] { return !queue.empty() || done; });
+            if (queue.empty())
+            {
+               return;
+            }
+            const std::vector<uint8_t> record = std::move(queue.front());
+            queue.pop_front();
+            lock.unlock();
+            total += get_pressure_as<pascals>(deserialize<sample>(record));
+            lock.lock();
+         }
+      });
+
+      for (std::size_t i = 0; i < Records; ++i)
+      {
+         std::vector<uint8_t> record = serialize(sample(static_cast<double>(i)));
+         {
+            const std::lock_guard lock(mutex);
+            queue.push_back(std::move(record));
+         }
+         ready.notify_one();
+      }
+      {
+         const std::lock_guard lock(mutex);
+         done = true;
+      }
+      ready.notify_one();
+      consumer.join();
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * Records);
+}
+BENCHMARK(BM_StreamLockedQueue)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_StreamRing(benchmark::State& state)
+{
+   const auto batchSize = static_cast<std::size_t>(state.range(0));
+   for (auto _ : state)
+   {
+      spsc_ring ring(1 << 20);
+      double total = 0.0;
+
+      std::thread consumer([&]
+      {
+         ring_source source(ring);
+         stream_reader<sample, ring_source> reader(source, batchSize);
+         sample value;
+         while (reader.next(value))
+         {
+            total += get_pressure_as<pascals>(value);
+         }
+      });
+
+      ring_sink sink(ring, backpressure::block);
+      {
+         stream_writer<sample, ring_sink> writer(sink, batchSize);
+         for (std::size_t i = 0; i < Records; ++i)
+         {
+            writer.push(sample(static_cast<double>(i)));
+         }
+      }
+      sink.close();
+      consumer.join();
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * Records);
+}
+BENCHMARK(BM_StreamRing)->Arg(64)->Arg(1024)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   constexpr std::size_t Records = 1 << 16;
+
+   /// @brief The I-th of the benchmarked types, m^(I+1), each with its own tag
+   template<std::size_t I>
+   using record_type = base_dimension<unit_exponent<meters, static_cast<int>(I) + 1>>;
+
+   template<typename Sequence>
+   struct registry_of;
+
+   template<std::size_t... Is>
+   struct registry_of<std::index_sequence<Is...>>
+   {
+      using type = tag_registry<FNV_1a_32Bit, record_type<Is>...>;
+   };
+
+   template<std::size_t N>
+   using registry_t = typename registry_of<std::make_index_sequence<N>>::type;
+
+   /// @brief Sums each type separately, so each type has its own handler
+   template<std::size_t N>
+   struct sum_visitor
+   {
+      std::array<double, N> totals{};
+
+      template<is_base_dimension Dim>
+      void operator()(const Dim& obj)
+      {
+         constexpr std::size_t index = std::tuple_element_t<0, typename Dim::units>::exponent::num - 1;
+         totals[index] += get_dimension_tuple<typename Dim::units>(obj);
+      }
+   };
+
+   /// @brief A pseudo-random mix of N types, so the branch predictor cannot learn the order
+   template<std::size_t N>
+   std::vector<std::byte> make_stream()
+   {
+      std::vector<std::byte> stream;
+      stream.reserve(Records * registry_t<N>::record_size);
+
+      std::uint32_t state = 12345;
+      for (std::size_t i = 0; i < Records; ++i)
+      {
+         state = state * 1664525u + 1013904223u;
+         const std::size_t type = (state >> 16) % N;
+         [&]<std::size_t... Is>(std::index_sequence<Is...>)
+         {
+            static_cast<void>(((type == Is && [&]
+            {
+               const auto record = serialize(record_type<Is>(static_cast<double>(i)));
+               const auto* bytes = reinterpret_cast<const std::byte*>(record.data());
+               stream.insert(stream.end(), bytes, bytes + record.size());
+               return true;
+            }()) || ...));
+         }(std::make_index_sequence<N>{});
+      }
+      return stream;
+   }
+
+   template<typename Dim, std::size_t N>
+   bool try_decode(const std::byte* record, sum_visitor<N>& visitor)
+   {
+      if (!validateTag<Dim, const std::byte*, FNV_1a_32Bit>(record))
+      {
+         return false;
+      }
+      PrecisionType value;
+      std::memcpy(&value, record + FNV_1a_32Bit::tag_size, sizeof(value));
+      visitor(Dim(value));
+      return true;
+   }
+}
+
+// Baseline: try each type in turn until its tag matches
+template<std::size_t N>
+static void BM_DecodeTryEachType(benchmark::State& state)
+{
+   const auto stream = make_stream<N>();
+   for (auto _ : state)
+   {
+      sum_visitor<N> visitor;
+      for (std::size_t offset = 0; offset < stream.size(); offset += registry_t<N>::record_size)
+      {
+         const std::byte* record = stream.data() + offset;
+         [&]<std::size_t... Is>(std::index_sequence<Is...>)
+         {
+            static_cast<void>((try_decode<record_type<Is>>(record, visitor) || ...));
+         }(std::make_index_sequence<N>{});
+      }
+      benchmark::DoNotOptimize(visitor.totals);
+   }
+   state.SetItemsProcessed(state.iterations() * Records);
+}
+BENCHMARK(BM_DecodeTryEachType<4>);
+BENCHMARK(BM_DecodeTryEachType<16>);
+BENCHMARK(BM_DecodeTryEachType<48>);
+
+template<std::size_t N>
+static void BM_DecodeTagRegistry(benchmark::State& state)
+{
+   const auto stream = make_stream<N>();
+   for (auto _ : state)
+   {
+      sum_visitor<N> visitor;
+      registry_t<N>::dispatch_all(stream, visitor);
+      benchmark::DoNotOptimize(visitor.totals);
+   }
+   state.SetItemsProcessed(state.iterations() * Records);
+}
+BENCHMARK(BM_DecodeTagRegistry<4>);
+BENCHMARK(BM_DecodeTagRegistry<16>);
+BENCHMARK(BM_DecodeTagRegistry<48>);
+
+template<std::size_t N>
+static void BM_DecodeTagRegistryGrouped(benchmark::State& state)
+{
+   const auto stream = make_stream<N>();
+   for (auto _ : state)
+   {
+      sum_visitor<N> visitor;
+      registry_t<N>::dispatch_grouped(stream, visitor);
+      benchmark::DoNotOptimize(visitor.totals);
+   }
+   state.SetItemsProcessed(state.iterations() * Records);
+}
+BENCHMARK(BM_DecodeTagRegistryGrouped<4>);
+BENCHMARK(BM_DecodeTagRegistryGrouped<16>);
+BENCHMARK(BM_DecodeTagRegistryGrouped<48>);
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   template<typename Dim>
+   dimension_array<Dim> make_array(std::size_t count, double start, double step)
+   {
+      dimension_array<Dim> values = dimension_array<Dim>::uninitialized(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values.data()[i] = start + static_cast<double>(i % 4096) * step;
+      }
+      return values;
+   }
+}
+
+// Baseline: scalar libm sin and cos per angle<degrees>
+static void BM_PerElement_SinCos(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto angles = make_array<angle<degrees>>(count, -360.0, 0.17);
+   std::vector<double> sines(count);
+   std::vector<double> cosines(count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         sines[i] = dimension::sin(angles[i]);
+         cosines[i] = dimension::cos(angles[i]);
+      }
+      benchmark::DoNotOptimize(sines.data());
+      benchmark::DoNotOptimize(cosines.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerElement_SinCos)->Range(1 << 10, 1 << 20);
+
+static void BM_Batched_SinCos(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto angles = make_array<angle<degrees>>(count, -360.0, 0.17);
+   std::vector<double> sines(count);
+   std::vector<double> cosines(count);
+
+   for (auto _ : state)
+   {
+      sincos<degrees>(angles.values(), sines, cosines);
+      benchmark::DoNotOptimize(sines.data());
+      benchmark::DoNotOptimize(cosines.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Batched_SinCos)->Range(1 << 10, 1 << 20);
+
+// Baseline: scalar libm atan2 per pair of lengths in different units
+static void BM_PerElement_Atan2(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto y = make_array<length<meters>>(count, -50.0, 0.031);
+   const auto x = make_array<length<feet>>(count, 80.0, -0.047);
+   std::vector<double> out(count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         out[i] = get_angle_as<radians>(dimension::atan2(y[i], length<meters>(x[i])));
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerElement_Atan2)->Range(1 << 10, 1 << 20);
+
+static void BM_Batched_Atan2(benchmark::State& state)
+{
+   const auto count = static_cast<std::size_t>(state.range(0));
+   const auto y = make_array<length<meters>>(count, -50.0, 0.031);
+   const auto x = make_array<length<feet>>(count, 80.0, -0.047);
+
+   for (auto _ : state)
+   {
+      auto angles = atan2(y, x);
+      benchmark::DoNotOptimize(angles.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Batched_Atan2)->Range(1 << 10, 1 << 20);
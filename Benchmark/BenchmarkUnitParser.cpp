@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <charconv>
+#include <string>
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   std::vector<std::string> make_telemetry(std::size_t count, const char* units)
+   {
+      std::vector<std::string> lines;
+      lines.reserve(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         // Shortest round trip form, as telemetry usually carries
+         std::array<char, 32> number{};
+         const auto end = std::to_chars(number.data(), number.data() + number.size(), static_cast<double>(i % 1000) * 0.125).ptr;
+         lines.push_back(std::string(number.data(), end) + " " + units);
+      }
+      return lines;
+   }
+}
+
+// Baseline: the number alone, parsed with std::from_chars
+static void BM_FromCharsOnly(benchmark::State& state)
+{
+   const auto lines = make_telemetry(4096, "");
+
+   for (auto _ : state)
+   {
+      double total = 0.0;
+      for (const auto& line : lines)
+      {
+         double value = 0.0;
+         std::from_chars(line.data(), line.data() + line.size(), value);
+         total += value;
+      }
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lines.size()));
+}
+BENCHMARK(BM_FromCharsOnly);
+
+static void BM_ParseSpeed(benchmark::State& state)
+{
+   const auto lines = make_telemetry(4096, "km/h");
+
+   for (auto _ : state)
+   {
+      double total = 0.0;
+      for (const auto& line : lines)
+      {
+         total += get_speed_as<meters, seconds>(parse<speed<meters, seconds>>(line));
+      }
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lines.size()));
+}
+BENCHMARK(BM_ParseSpeed);
+
+static void BM_ParseArea(benchmark::State& state)
+{
+   const auto lines = make_telemetry(4096, "ft^2");
+
+   for (auto _ : state)
+   {
+      double total = 0.0;
+      for (const auto& line : lines)
+      {
+         total += get_area_as<meters>(parse<area<meters>>(line));
+      }
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lines.size()));
+}
+BENCHMARK(BM_ParseArea);
+
+static void BM_ParseQuantity(benchmark::State& state)
+{
+   const auto lines = make_telemetry(4096, "kg*m/s^2");
+
+   for (auto _ : state)
+   {
+      double total = 0.0;
+      for (const auto& line : lines)
+      {
+         total += parse_quantity(line).primary_value();
+      }
+      benchmark::DoNotOptimize(total);
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lines.size()));
+}
+BENCHMARK(BM_ParseQuantity);
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "dimensional.h"
+
+using namespace dimension;
+
+namespace
+{
+   constexpr std::size_t count = 1024;
+
+   struct raw_vectors
+   {
+      std::vector<double> r = std::vector<double>(3 * count);
+      std::vector<double> f = std::vector<double>(3 * count);
+   };
+
+   raw_vectors make_raw()
+   {
+      raw_vectors values;
+      for (std::size_t i = 0; i < 3 * count; ++i)
+      {
+         values.r[i] = 1.0 + static_cast<double>(i % 7) * 0.25;
+         values.f[i] = 2.0 - static_cast<double>(i % 5) * 0.125;
+      }
+      return values;
+   }
+
+   template<typename Dim>
+   std::vector<vec3<Dim>> make_vecs(const std::vector<double>& raw)
+   {
+      std::vector<vec3<Dim>> values(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         values[i] = vec3<Dim>::from_raw({raw[3 * i], raw[3 * i + 1], raw[3 * i + 2]});
+      }
+      return values;
+   }
+}
+
+// Baseline: cross products of double[3]
+static void BM_CrossRawDouble(benchmark::State& state)
+{
+   const auto values = make_raw();
+   std::vector<double> out(3 * count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         const double* a = &values.r[3 * i];
+         const double* b = &values.f[3 * i];
+         double* c = &out[3 * i];
+         c[0] = a[1] * b[2] - a[2] * b[1];
+         c[1] = a[2] * b[0] - a[0] * b[2];
+         c[2] = a[0] * b[1] - a[1] * b[0];
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(BM_CrossRawDouble);
+
+static void BM_CrossVec3(benchmark::State& state)
+{
+   const auto raw = make_raw();
+   const auto r = make_vecs<length<meters>>(raw.r);
+   const auto f = make_vecs<force<newtons>>(raw.f);
+   std::vector<decltype(cross(r[0], f[0]))> out(count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         out[i] = cross(r[i], f[i]);
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(BM_CrossVec3);
+
+// Baseline: dot products of double[3]
+static void BM_DotRawDouble(benchmark::State& state)
+{
+   const auto values = make_raw();
+   std::vector<double> out(count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         const double* a = &values.r[3 * i];
+         const double* b = &values.f[3 * i];
+         out[i] = a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(BM_DotRawDouble);
+
+static void BM_DotVec3(benchmark::State& state)
+{
+   const auto raw = make_raw();
+   const auto r = make_vecs<length<meters>>(raw.r);
+   const auto f = make_vecs<force<newtons>>(raw.f);
+   std::vector<decltype(dot(r[0], f[0]))> out(count);
+
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         out[i] = dot(r[i], f[i]);
+      }
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(BM_DotVec3);
@@ -0,0 +1,56 @@
+// Compile-time benchmark of canonical unit ordering.
+// Instantiates the sort of many unit tuples, written in reverse order, with either
+// tuple_sort (the default) or tuple_bubble_sort (DIMENSION_BENCHMARK_BUBBLE_SORT).
+// Build the DimensionCompileTime_TupleSort and DimensionCompileTime_BubbleSort targets
+// and compare their compile times, such as with `time cmake --build . --target ...`.
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "Dimension_Core/StringLiteral.h"
+#include "Dimension_Core/TupleHandling.h"
+
+using namespace dimension;
+
+namespace
+{
+   /// @brief Stand-in for a unit_exponent, with a distinct qualifiedName per Group and Index
+   template<std::size_t Group, std::size_t Index>
+   struct named
+   {
+      static constexpr StringLiteral<5> qualifiedName = std::array<char, 5>{
+         static_cast<char>('a' + Group % 26), static_cast<char>('a' + Index / 26 % 26), static_cast<char>('a' + Index % 26), ':', '\0'
+      };
+   };
+
+   template<std::size_t Group, std::size_t... Is>
+   auto reversed(std::index_sequence<Is...>) -> std::tuple<named<Group, sizeof...(Is) - 1 - Is>...>;
+
+   template<std::size_t Group, std::size_t N>
+   using reversed_t = decltype(reversed<Group>(std::make_index_sequence<N>{}));
+
+#if defined(DIMENSION_BENCHMARK_BUBBLE_SORT)
+   template<typename Tuple>
+   using sorted_t = typename tuple_bubble_sort<Tuple>::type;
+#else
+   template<typename Tuple>
+   using sorted_t = tuple_sort_t<Tuple>;
+#endif
+
+   template<std::size_t... Groups>
+   constexpr std::size_t sort_all(std::index_sequence<Groups...>)
+   {
+      // Tuples of 4, 8 and 16 units, as found in compound and intermediate dimensions
+      return (... + (std::tuple_size_v<sorted_t<reversed_t<Groups, 4>>>
+                   + std::tuple_size_v<sorted_t<reversed_t<Groups, 8>>>
+                   + std::tuple_size_v<sorted_t<reversed_t<Groups, 16>>>));
+   }
+}
+
+static_assert(sort_all(std::make_index_sequence<64>{}) == 64 * 28);
+
+int main()
+{
+   return 0;
+}
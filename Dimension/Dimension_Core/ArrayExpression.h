@@ -0,0 +1,411 @@
+#ifndef DIMENSION_ARRAY_EXPRESSION_H
+#define DIMENSION_ARRAY_EXPRESSION_H
+
+#include <cstddef> // For std::size_t
+#include <ratio>
+#include <span>
+#include <stdexcept> // For std::invalid_argument
+#include <tuple>
+#include <type_traits>
+
+#include "Coefficient.h"
+#include "PrecisionType.h"
+#include "TupleHandling.h"
+#include "UnitSimplifier.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   template<is_base_dimension Dim, typename Allocator>
+   class dimension_array;
+
+   /// @brief Check if a type is a dimension_array
+   template<typename T>
+   struct is_dimension_array : std::false_type {};
+
+   template<typename Dim, typename Allocator>
+   struct is_dimension_array<dimension_array<Dim, Allocator>> : std::true_type {};
+
+   /// @brief Marker base for lazy element-wise expressions over arrays of dimensions
+   struct array_expression_marker {};
+
+   /// @brief Concept for a lazy array expression
+   template<typename T>
+   concept is_array_expression = std::is_base_of_v<array_expression_marker, std::remove_cvref_t<T>>;
+
+   /// @brief Concept for an operand which produces one value per element, an expression or a dimension_array
+   template<typename T>
+   concept array_operand = is_array_expression<T> || is_dimension_array<std::remove_cvref_t<T>>::value;
+
+   // Every expression node provides:
+   //    units, ratio, symbols, rep - the same meaning as on base_dimension, resolved at compile time
+   //    dimension_type             - the base_dimension an element of the expression would have
+   //    is_broadcast               - true when the node has no per-element values
+   //    size()                     - number of elements, meaningless for broadcast nodes
+   //    value(i)                   - per-element part of the raw value at index i
+   //    scale()                    - broadcast part of the raw value, shared by every element
+   // The raw value of element i is value(i) * scale(). Keeping the broadcast part separate
+   // lets products with constants collapse into a single factor applied once per element.
+
+   /// @brief Leaf node referencing a contiguous array of raw values in the units of Dim
+   /// @details Only a view is stored, the referenced values must outlive the expression.
+   /// @tparam Dim The dimension type of each element
+   template<is_base_dimension Dim>
+   class array_leaf : public array_expression_marker
+   {
+   public:
+      using dimension_type = Dim;
+      using units = typename Dim::units;
+      using ratio = typename Dim::ratio;
+      using symbols = typename Dim::symbols;
+      using rep = typename Dim::rep;
+
+      static constexpr bool is_broadcast = false;
+
+      constexpr explicit array_leaf(std::span<const rep> raw) noexcept : data(raw) {}
+
+      [[nodiscard]] constexpr std::size_t size() const noexcept { return data.size(); }
+      [[nodiscard]] constexpr rep value(std::size_t index) const { return data[index]; }
+      [[nodiscard]] constexpr rep scale() const noexcept { return rep{1}; }
+
+   private:
+      std::span<const rep> data;
+   };
+
+   /// @brief Leaf node holding a single dimension value shared by every element
+   /// @tparam Dim The dimension type of the value
+   template<is_base_dimension Dim>
+   class broadcast_leaf : public array_expression_marker
+   {
+   public:
+      using dimension_type = Dim;
+      using units = typename Dim::units;
+      using ratio = typename Dim::ratio;
+      using symbols = typename Dim::symbols;
+      using rep = typename Dim::rep;
+
+      static constexpr bool is_broadcast = true;
+
+      constexpr explicit broadcast_leaf(const Dim& obj) : scalar(obj.template get_tuple_scalar<units>()) {}
+
+      [[nodiscard]] constexpr std::size_t size() const noexcept { return 0; }
+      [[nodiscard]] constexpr rep value(std::size_t) const noexcept { return rep{1}; }
+      [[nodiscard]] constexpr rep scale() const noexcept { return scalar; }
+
+   private:
+      rep scalar;
+   };
+
+   /// @brief Leaf node holding a unitless scalar shared by every element
+   /// @tparam Rep The type of the scalar
+   template<typename Rep>
+   class scalar_leaf : public array_expression_marker
+   {
+   public:
+      using dimension_type = base_dimension_impl<Rep>;
+      using units = std::tuple<>;
+      using ratio = std::ratio<1>;
+      using symbols = std::tuple<>;
+      using rep = Rep;
+
+      static constexpr bool is_broadcast = true;
+
+      constexpr explicit scalar_leaf(Rep value) noexcept : scalar(value) {}
+
+      [[nodiscard]] constexpr std::size_t size() const noexcept { return 0; }
+      [[nodiscard]] constexpr rep value(std::size_t) const noexcept { return rep{1}; }
+      [[nodiscard]] constexpr rep scale() const noexcept { return scalar; }
+
+   private:
+      rep scalar;
+   };
+
+   /// @brief Size shared by two operands, throwing if two per-element operands disagree
+   template<typename Lhs, typename Rhs>
+   constexpr std::size_t combined_size(const Lhs& lhs, const Rhs& rhs)
+   {
+      if constexpr (Lhs::is_broadcast)
+      {
+         return rhs.size();
+      }
+      else if constexpr (Rhs::is_broadcast)
+      {
+         return lhs.size();
+      }
+      else
+      {
+         if (lhs.size() != rhs.size())
+         {
+            throw std::invalid_argument("Array expression operands must be the same size");
+         }
+         return lhs.size();
+      }
+   }
+
+   /// @brief Element-wise product or quotient of two expressions
+   /// @details Units, ratio and symbols combine exactly as they do for operator* and operator/
+   ///    between two base_dimension objects.
+   /// @tparam Lhs Left expression node
+   /// @tparam Rhs Right expression node
+   /// @tparam Divide Whether this node divides (true) or multiplies (false)
+   template<typename Lhs, typename Rhs, bool Divide>
+   class product_expression : public array_expression_marker
+   {
+   public:
+      using rep = std::common_type_t<typename Lhs::rep, typename Rhs::rep>;
+      using ratio = std::conditional_t<Divide,
+         std::ratio_divide<typename Lhs::ratio, typename Rhs::ratio>,
+         std::ratio_multiply<typename Lhs::ratio, typename Rhs::ratio>>;
+      using symbols = std::conditional_t<Divide,
+         typename divide_symbol_tuples<typename Lhs::symbols, typename Rhs::symbols>::type,
+         typename multiply_symbol_tuples<typename Lhs::symbols, typename Rhs::symbols>::type>;
+      using units = typename InitialSimplifier<tuple_cat_t<typename Lhs::units,
+         std::conditional_t<Divide, typename FlipExponents<typename Rhs::units>::units, typename Rhs::units>>>::units;
+      using dimension_type = typename base_dimensionFromTuple<rep, ratio, units, symbols>::dim;
+
+      static constexpr bool is_broadcast = Lhs::is_broadcast && Rhs::is_broadcast;
+
+      constexpr product_expression(const Lhs& left, const Rhs& right)
+         : lhs(left), rhs(right), count(combined_size(left, right))
+      {
+      }
+
+      [[nodiscard]] constexpr std::size_t size() const noexcept { return count; }
+
+      [[nodiscard]] constexpr rep value(std::size_t index) const
+      {
+         if constexpr (Rhs::is_broadcast)
+         {
+            return static_cast<rep>(lhs.value(index));
+         }
+         else if constexpr (Lhs::is_broadcast)
+         {
+            if constexpr (Divide)
+            {
+               return rep{1} / static_cast<rep>(rhs.value(index));
+            }
+            else
+            {
+               return static_cast<rep>(rhs.value(index));
+            }
+         }
+         else if constexpr (Divide)
+         {
+            return static_cast<rep>(lhs.value(index)) / static_cast<rep>(rhs.value(index));
+         }
+         else
+         {
+            return static_cast<rep>(lhs.value(index)) * static_cast<rep>(rhs.value(index));
+         }
+      }
+
+      [[nodiscard]] constexpr rep scale() const
+      {
+         if constexpr (Divide)
+         {
+            return static_cast<rep>(lhs.scale()) / static_cast<rep>(rhs.scale());
+         }
+         else
+         {
+            return static_cast<rep>(lhs.scale()) * static_cast<rep>(rhs.scale());
+         }
+      }
+
+   private:
+      Lhs lhs;
+      Rhs rhs;
+      std::size_t count;
+   };
+
+   /// @brief Element-wise sum or difference of two expressions
+   /// @details As with operator+ and operator- between two base_dimension objects, the result
+   ///    is expressed in the units of the left operand without coefficients. The right operand
+   ///    is converted with a single compile-time factor.
+   /// @tparam Lhs Left expression node
+   /// @tparam Rhs Right expression node
+   /// @tparam Subtract Whether this node subtracts (true) or adds (false)
+   template<typename Lhs, typename Rhs, bool Subtract>
+   requires matching_dimensions<typename Lhs::dimension_type, typename Rhs::dimension_type>
+   class sum_expression : public array_expression_marker
+   {
+   public:
+      using rep = std::common_type_t<typename Lhs::rep, typename Rhs::rep>;
+      using ratio = std::ratio<1>;
+      using symbols = std::tuple<>;
+      using units = typename Lhs::units;
+      using dimension_type = typename base_dimensionFromTuple<rep, ratio, units, symbols>::dim;
+
+      static constexpr bool is_broadcast = Lhs::is_broadcast && Rhs::is_broadcast;
+
+      constexpr sum_expression(const Lhs& left, const Rhs& right)
+         : lhs(left), rhs(right), count(combined_size(left, right)),
+           lhs_scale(static_cast<rep>(left.scale()) * static_cast<rep>(lhs_factor)),
+           rhs_scale(static_cast<rep>(right.scale()) * static_cast<rep>(rhs_factor))
+      {
+      }
+
+      [[nodiscard]] constexpr std::size_t size() const noexcept { return count; }
+
+      [[nodiscard]] constexpr rep value(std::size_t index) const
+      {
+         const rep left = static_cast<rep>(lhs.value(index)) * lhs_scale;
+         const rep right = static_cast<rep>(rhs.value(index)) * rhs_scale;
+         return Subtract ? left - right : left + right;
+      }
+
+      [[nodiscard]] constexpr rep scale() const noexcept { return rep{1}; }
+
+   private:
+      static constexpr PrecisionType lhs_factor = coefficient_factor_v<Lhs>;
+      static constexpr PrecisionType rhs_factor = coefficient_factor_v<Rhs> * conversion_factor_v<typename Rhs::units, typename Lhs::units>;
+
+      Lhs lhs;
+      Rhs rhs;
+      std::size_t count;
+      rep lhs_scale;
+      rep rhs_scale;
+   };
+
+   /// @brief Create an expression leaf over raw values already expressed in the units of Dim
+   /// @details The values are referenced, not copied, and must outlive the expression
+   /// @tparam Dim The dimension type of each element
+   /// @param values Raw values in the units of Dim
+   template<is_base_dimension Dim>
+   [[nodiscard]] constexpr array_leaf<Dim> as_expression(std::span<const typename Dim::rep> values) noexcept
+   {
+      return array_leaf<Dim>(values);
+   }
+
+   /// @brief Wrap any supported operand as an expression node
+   template<typename T>
+   constexpr auto to_expression(const T& operand)
+   {
+      if constexpr (is_array_expression<T>)
+      {
+         return operand;
+      }
+      else if constexpr (is_dimension_array<T>::value)
+      {
+         return array_leaf<typename T::dimension_type>(operand.values());
+      }
+      else if constexpr (is_base_dimension<T>)
+      {
+         return broadcast_leaf<T>(operand);
+      }
+      else
+      {
+         return scalar_leaf<double>(static_cast<double>(operand));
+      }
+   }
+
+   template<typename Lhs, typename Rhs>
+   concept array_expression_operands =
+      (array_operand<Lhs> && (array_operand<Rhs> || is_base_dimension<Rhs>)) ||
+      (is_base_dimension<Lhs> && array_operand<Rhs>);
+
+   template<typename Lhs, typename Rhs, bool Divide>
+   using product_of = product_expression<decltype(to_expression(std::declval<Lhs>())), decltype(to_expression(std::declval<Rhs>())), Divide>;
+
+   template<typename Lhs, typename Rhs, bool Subtract>
+   using sum_of = sum_expression<decltype(to_expression(std::declval<Lhs>())), decltype(to_expression(std::declval<Rhs>())), Subtract>;
+
+   /// @brief Lazy element-wise multiplication, nothing is computed until the expression is evaluated
+   /// @details Operands are dimension_arrays, expressions, or single dimensions applied to every element.
+   ///    dimension_array operands are referenced and must outlive the expression.
+   template<typename Lhs, typename Rhs>
+   requires array_expression_operands<Lhs, Rhs>
+   [[nodiscard]] constexpr auto operator*(const Lhs& lhs, const Rhs& rhs)
+   {
+      return product_of<Lhs, Rhs, false>(to_expression(lhs), to_expression(rhs));
+   }
+
+   /// @brief Lazy element-wise division
+   template<typename Lhs, typename Rhs>
+   requires array_expression_operands<Lhs, Rhs>
+   [[nodiscard]] constexpr auto operator/(const Lhs& lhs, const Rhs& rhs)
+   {
+      return product_of<Lhs, Rhs, true>(to_expression(lhs), to_expression(rhs));
+   }
+
+   /// @brief Lazy element-wise addition, in the units of lhs
+   template<typename Lhs, typename Rhs>
+   requires array_expression_operands<Lhs, Rhs>
+   [[nodiscard]] constexpr auto operator+(const Lhs& lhs, const Rhs& rhs)
+   {
+      return sum_of<Lhs, Rhs, false>(to_expression(lhs), to_expression(rhs));
+   }
+
+   /// @brief Lazy element-wise subtraction, in the units of lhs
+   template<typename Lhs, typename Rhs>
+   requires array_expression_operands<Lhs, Rhs>
+   [[nodiscard]] constexpr auto operator-(const Lhs& lhs, const Rhs& rhs)
+   {
+      return sum_of<Lhs, Rhs, true>(to_expression(lhs), to_expression(rhs));
+   }
+
+   /// @brief Lazy multiplication by a unitless scalar
+   template<array_operand Lhs>
+   [[nodiscard]] constexpr auto operator*(const Lhs& lhs, double scalar)
+   {
+      return product_of<Lhs, double, false>(to_expression(lhs), to_expression(scalar));
+   }
+
+   /// @brief Lazy multiplication by a unitless scalar
+   template<array_operand Rhs>
+   [[nodiscard]] constexpr auto operator*(double scalar, const Rhs& rhs)
+   {
+      return product_of<double, Rhs, false>(to_expression(scalar), to_expression(rhs));
+   }
+
+   /// @brief Lazy division by a unitless scalar
+   template<array_operand Lhs>
+   [[nodiscard]] constexpr auto operator/(const Lhs& lhs, double scalar)
+   {
+      return product_of<Lhs, double, true>(to_expression(lhs), to_expression(scalar));
+   }
+
+   /// @brief Lazy division of a unitless scalar by each element
+   template<array_operand Rhs>
+   [[nodiscard]] constexpr auto operator/(double scalar, const Rhs& rhs)
+   {
+      return product_of<double, Rhs, true>(to_expression(scalar), to_expression(rhs));
+   }
+
+   /// @brief Evaluate an expression into raw values expressed in the units of Dest
+   /// @details Every unit conversion and coefficient in the expression, together with any
+   ///    broadcast values, is folded into one factor. Each element then costs the per-element
+   ///    arithmetic of the expression plus a single multiply, in one vectorizable loop.
+   /// @tparam Dest The dimension type to evaluate into, must match the dimension of the expression
+   /// @param expr The expression to evaluate
+   /// @param out Destination for the raw values, must be the same size as the expression
+   template<is_base_dimension Dest, is_array_expression Expr>
+   requires matching_dimensions<typename Expr::dimension_type, Dest>
+   void evaluate(const Expr& expr, std::span<typename Dest::rep> out)
+   {
+      static_assert(!Expr::is_broadcast, "An expression without any array operand has no size");
+
+      using rep = typename Dest::rep;
+
+      if (expr.size() != out.size())
+      {
+         throw std::invalid_argument("Array expression and destination must be the same size");
+      }
+
+      constexpr PrecisionType factor = coefficient_factor_v<Expr> *
+                                       conversion_factor_v<typename Expr::units, typename Dest::units> /
+                                       coefficient_factor_v<Dest>;
+
+      const rep scale = static_cast<rep>(static_cast<PrecisionType>(expr.scale()) * factor);
+      rep* const dst = out.data();
+      const std::size_t count = out.size();
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         dst[i] = static_cast<rep>(expr.value(i)) * scale;
+      }
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_ARRAY_EXPRESSION_H
@@ -0,0 +1,261 @@
+#ifndef DIMENSION_BATCH_CONVERSION_H
+#define DIMENSION_BATCH_CONVERSION_H
+
+#include <algorithm> // For std::copy
+#include <cstddef> // For std::size_t
+#include <ranges> // For std::ranges::contiguous_range
+#include <span>
+#include <stdexcept> // For std::invalid_argument
+#include <type_traits>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "Conversion.h"
+#include "UnitSimplifier.h"
+#include "UnitValidation.h"
+
+namespace dimension
+{
+
+   /// @brief Combined slope and offset of a conversion, resolved at compile time
+   /// @details For fundamental units, the chain of Conversion<From, To> specializations
+   ///    (direct, inverse, or through Primary) is folded into one affine transform
+   ///    out = in * slope + offset. Offsets are only applied to quantities,
+   ///    deltas use the slope alone. For tuples of unit_exponents the conversion is
+   ///    always a delta and only the slope is populated.
+   /// @tparam From Unit, or tuple of unit_exponents, to convert from
+   /// @tparam To Unit, or tuple of unit_exponents, to convert to
+   /// @tparam IsQuantity Whether offsets should be applied (quantity) or ignored (delta)
+   template<typename From, typename To, bool IsQuantity = delta>
+   struct affine_conversion;
+
+   /// @brief Affine conversion between two fundamental units
+   template<typename From, typename To, bool IsQuantity>
+   requires (!is_tuple<From>::value && !is_tuple<To>::value)
+   struct affine_conversion<From, To, IsQuantity>
+   {
+   private:
+      /// @brief Slope and offset of one conversion step, inverting the trait if needed
+      template<typename Conv, bool Inverse>
+      struct step
+      {
+         static constexpr PrecisionType conv_offset = IsQuantity ? GetOffset<Conv>() : PrecisionType{0};
+
+         static constexpr PrecisionType slope = Inverse ? PrecisionType{1} / Conv::slope : Conv::slope;
+         static constexpr PrecisionType offset = Inverse ? -conv_offset / Conv::slope : conv_offset;
+      };
+
+      static constexpr auto resolve()
+      {
+         struct result { PrecisionType slope; PrecisionType offset; };
+
+         if constexpr (std::is_same_v<From, To>)
+         {
+            return result{PrecisionType{1}, PrecisionType{0}};
+         }
+         else if constexpr (HasConversion<From, To>)
+         {
+            using s = step<Conversion<From, To>, false>;
+            return result{s::slope, s::offset};
+         }
+         else if constexpr (HasConversion<To, From>)
+         {
+            using s = step<Conversion<To, From>, true>;
+            return result{s::slope, s::offset};
+         }
+         else
+         {
+            #ifdef REQUIRE_CONVERSIONS
+               static_assert(sizeof(From) == 0, "No specialized conversion found. See compiler output for more details");
+            #endif
+            // Compose From -> Primary -> To into a single transform
+            using first = affine_conversion<From, typename From::Primary, IsQuantity>;
+            using second = affine_conversion<typename From::Primary, To, IsQuantity>;
+            return result{first::slope * second::slope, first::offset * second::slope + second::offset};
+         }
+      }
+
+   public:
+      static constexpr PrecisionType slope = resolve().slope;
+      static constexpr PrecisionType offset = resolve().offset;
+   };
+
+   /// @brief Linear conversion between two tuples of unit_exponents
+   template<typename... FromUnits, typename... ToUnits, bool IsQuantity>
+   struct affine_conversion<std::tuple<FromUnits...>, std::tuple<ToUnits...>, IsQuantity>
+   {
+      static_assert(!IsQuantity, "Offsets are only defined for conversions between single fundamental units");
+
+      static constexpr PrecisionType slope = conversion_factor_v<std::tuple<FromUnits...>, std::tuple<ToUnits...>>;
+      static constexpr PrecisionType offset = 0.0;
+   };
+
+   namespace kernels
+   {
+      /// @brief out[i] = in[i] * slope for n elements
+      /// @details Uses AVX-512 or AVX2 when enabled at compile time, with a scalar tail.
+      ///    in and out may alias exactly (in-place), but must not otherwise overlap.
+      template<typename T>
+      void scale(const T* in, T* out, std::size_t n, T slope) noexcept
+      {
+         std::size_t i = 0;
+
+         #if defined(__AVX512F__)
+         if constexpr (std::is_same_v<T, double>)
+         {
+            const __m512d s = _mm512_set1_pd(slope);
+            for (; i + 8 <= n; i += 8)
+            {
+               _mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_loadu_pd(in + i), s));
+            }
+         }
+         else if constexpr (std::is_same_v<T, float>)
+         {
+            const __m512 s = _mm512_set1_ps(slope);
+            for (; i + 16 <= n; i += 16)
+            {
+               _mm512_storeu_ps(out + i, _mm512_mul_ps(_mm512_loadu_ps(in + i), s));
+            }
+         }
+         #elif defined(__AVX2__)
+         if constexpr (std::is_same_v<T, double>)
+         {
+            const __m256d s = _mm256_set1_pd(slope);
+            for (; i + 4 <= n; i += 4)
+            {
+               _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(in + i), s));
+            }
+         }
+         else if constexpr (std::is_same_v<T, float>)
+         {
+            const __m256 s = _mm256_set1_ps(slope);
+            for (; i + 8 <= n; i += 8)
+            {
+               _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(in + i), s));
+            }
+         }
+         #endif
+
+         for (; i < n; ++i)
+         {
+            out[i] = in[i] * slope;
+         }
+      }
+
+      /// @brief out[i] = in[i] * slope + offset for n elements
+      /// @details Uses AVX-512 or AVX2 FMA when enabled at compile time, with a scalar tail.
+      ///    in and out may alias exactly (in-place), but must not otherwise overlap.
+      template<typename T>
+      void affine(const T* in, T* out, std::size_t n, T slope, T offset) noexcept
+      {
+         std::size_t i = 0;
+
+         #if defined(__AVX512F__)
+         if constexpr (std::is_same_v<T, double>)
+         {
+            const __m512d s = _mm512_set1_pd(slope);
+            const __m512d o = _mm512_set1_pd(offset);
+            for (; i + 8 <= n; i += 8)
+            {
+               _mm512_storeu_pd(out + i, _mm512_fmadd_pd(_mm512_loadu_pd(in + i), s, o));
+            }
+         }
+         else if constexpr (std::is_same_v<T, float>)
+         {
+            const __m512 s = _mm512_set1_ps(slope);
+            const __m512 o = _mm512_set1_ps(offset);
+            for (; i + 16 <= n; i += 16)
+            {
+               _mm512_storeu_ps(out + i, _mm512_fmadd_ps(_mm512_loadu_ps(in + i), s, o));
+            }
+         }
+         #elif defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+         if constexpr (std::is_same_v<T, double>)
+         {
+            const __m256d s = _mm256_set1_pd(slope);
+            const __m256d o = _mm256_set1_pd(offset);
+            for (; i + 4 <= n; i += 4)
+            {
+               _mm256_storeu_pd(out + i, _mm256_fmadd_pd(_mm256_loadu_pd(in + i), s, o));
+            }
+         }
+         else if constexpr (std::is_same_v<T, float>)
+         {
+            const __m256 s = _mm256_set1_ps(slope);
+            const __m256 o = _mm256_set1_ps(offset);
+            for (; i + 8 <= n; i += 8)
+            {
+               _mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_loadu_ps(in + i), s, o));
+            }
+         }
+         #endif
+
+         for (; i < n; ++i)
+         {
+            out[i] = in[i] * slope + offset;
+         }
+      }
+   }
+
+   /// @brief Convert a contiguous array of raw values from one unit to another
+   /// @details The slope and offset are resolved once at compile time from the
+   ///    Conversion specializations, then applied with a vectorized loop.
+   /// @tparam FromUnits Unit, or tuple of unit_exponents, the input values are expressed in
+   /// @tparam ToUnits Unit, or tuple of unit_exponents, to convert to
+   /// @tparam IsQuantity quantity to apply conversion offsets, delta (default) to ignore them
+   /// @param in Values to convert, any contiguous range such as std::span or std::vector
+   /// @param out Destination for converted values, must be the same size as in
+   template<typename FromUnits, typename ToUnits, bool IsQuantity = delta, std::ranges::contiguous_range In, std::ranges::contiguous_range Out>
+   requires std::is_same_v<std::ranges::range_value_t<In>, std::ranges::range_value_t<Out>>
+   void convert_span(const In& in, Out&& out)
+   {
+      using T = std::ranges::range_value_t<Out>;
+
+      const std::span<const T> src(std::ranges::data(in), std::ranges::size(in));
+      const std::span<T> dst(std::ranges::data(out), std::ranges::size(out));
+
+      if (src.size() != dst.size())
+      {
+         throw std::invalid_argument("convert_span input and output must be the same size");
+      }
+
+      using conversion = affine_conversion<FromUnits, ToUnits, IsQuantity>;
+      constexpr T slope = static_cast<T>(conversion::slope);
+      constexpr T offset = static_cast<T>(conversion::offset);
+
+      if constexpr (conversion::offset == PrecisionType{0})
+      {
+         if constexpr (conversion::slope == PrecisionType{1})
+         {
+            if (src.data() != dst.data())
+            {
+               std::copy(src.begin(), src.end(), dst.begin());
+            }
+         }
+         else
+         {
+            kernels::scale<T>(src.data(), dst.data(), src.size(), slope);
+         }
+      }
+      else
+      {
+         kernels::affine<T>(src.data(), dst.data(), src.size(), slope, offset);
+      }
+   }
+
+   /// @brief Convert a contiguous array of raw values from one unit to another in place
+   /// @tparam FromUnits Unit, or tuple of unit_exponents, the values are expressed in
+   /// @tparam ToUnits Unit, or tuple of unit_exponents, to convert to
+   /// @tparam IsQuantity quantity to apply conversion offsets, delta (default) to ignore them
+   /// @param values Values to convert, any contiguous range such as std::span or std::vector
+   template<typename FromUnits, typename ToUnits, bool IsQuantity = delta, std::ranges::contiguous_range R>
+   void convert_span(R&& values)
+   {
+      convert_span<FromUnits, ToUnits, IsQuantity>(values, values);
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_BATCH_CONVERSION_H
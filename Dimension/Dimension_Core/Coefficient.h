@@ -286,6 +286,13 @@ namespace dimension
       using type = typename multiply_symbol_tuples<std::tuple<T1s...>, negated_pack>::type;
    };
 
+   // ============================================================================
+   //  coefficient_factor_v<Dim>
+   //     combined value of the ratio and symbols carried by a dimension type
+   // ============================================================================
+   template<typename Dim>
+   inline constexpr double coefficient_factor_v = ratio_value<typename Dim::ratio>() * eval_symbol_tuple<typename Dim::symbols>();
+
 }
 
 #endif //DIMENSIONAL_COEFFICIENT_H
@@ -0,0 +1,399 @@
+#ifndef DIMENSION_COLUMN_FILE_H
+#define DIMENSION_COLUMN_FILE_H
+
+#include <algorithm> // For std::min
+#include <array>
+#include <cerrno> // For errno
+#include <cstddef> // For std::byte, std::size_t
+#include <cstdint> // For std::uint#_t
+#include <cstring> // For std::memcpy
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept> // For std::invalid_argument, std::runtime_error
+#include <string>
+#include <string_view>
+#include <system_error> // For std::system_error
+#include <type_traits>
+#include <utility> // For std::exchange
+
+#if defined(_WIN32)
+   #ifndef WIN32_LEAN_AND_MEAN
+      #define WIN32_LEAN_AND_MEAN
+   #endif
+   #ifndef NOMINMAX
+      #define NOMINMAX
+   #endif
+   #include <windows.h>
+#else
+   #include <fcntl.h> // For open
+   #include <sys/mman.h> // For mmap, munmap
+   #include <sys/stat.h> // For fstat
+   #include <unistd.h> // For close
+#endif
+
+#include "BatchConversion.h"
+#include "ConvertibleSerialization.h"
+#include "DimensionArray.h"
+#include "DynamicQuantity.h"
+#include "Hashing.h"
+#include "PrecisionType.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief Alignment in bytes of the values in a column file
+   inline constexpr std::size_t column_alignment = 64;
+
+   /// @brief Fixed header at the start of a column file
+   /// @details A column file is laid out as the header, then the canonical unit string with its null
+   ///    terminator, then zero padding up to data_offset, then count packed Rep values.
+   ///    All fields are written in the byte order of the writer, recorded in byte_order.
+   struct column_header
+   {
+      static constexpr std::array<char, 8> expected_magic{'D', 'I', 'M', 'C', 'O', 'L', '\0', '\1'};
+      static constexpr std::uint32_t native_byte_order = 0x01020304;
+
+      std::array<char, 8> magic = expected_magic;
+      std::uint32_t byte_order = native_byte_order;
+      char rep_kind = 0;                   ///< 'f' for floating point, 'i' for signed and 'u' for unsigned integers
+      std::uint8_t rep_size = 0;           ///< sizeof(Rep)
+      std::uint16_t unit_length = 0;       ///< Length of the unit string, excluding its null terminator
+      std::uint64_t type_hash = 0;         ///< FNV-1a 64-bit hash of the unit string, including its null terminator
+      std::uint64_t signature = 0;         ///< Packed dimension_signature of the values
+      double scale = 1.0;                  ///< Factor taking a stored value to the primary units of its dimensions
+      std::uint64_t count = 0;             ///< Number of values
+      std::uint64_t data_offset = 0;       ///< Offset of the first value from the start of the file
+      std::uint64_t reserved = 0;
+   };
+
+   static_assert(sizeof(column_header) == 64 && std::is_trivially_copyable_v<column_header>);
+
+   namespace column_detail
+   {
+      /// @brief Canonical unit string of a dimension, as hashed by TypeTagHelper, including its null terminator
+      template<is_base_dimension Dim>
+      constexpr std::string_view unit_string() noexcept
+      {
+         constexpr const auto& text = TypeTagHelper<Dim, FNV_1a_64Bit>::TupleString;
+         return std::string_view(text.value.data(), text.size);
+      }
+
+      constexpr std::uint64_t align_up(std::uint64_t offset) noexcept
+      {
+         return (offset + column_alignment - 1) / column_alignment * column_alignment;
+      }
+   }
+
+   /// @brief Header describing count values of Dim
+   template<is_base_dimension Dim>
+   constexpr column_header make_column_header(std::size_t count) noexcept
+   {
+      using rep = typename Dim::rep;
+      constexpr std::string_view units = column_detail::unit_string<Dim>();
+
+      column_header header;
+      header.rep_kind = serialization_detail::rep_kind_v<rep>;
+      header.rep_size = static_cast<std::uint8_t>(sizeof(rep));
+      header.unit_length = static_cast<std::uint16_t>(units.size() - 1);
+      header.type_hash = TypeTagHelper<Dim, FNV_1a_64Bit>::value().get();
+      header.signature = dimension_signature_v<Dim>.packed();
+      header.scale = static_cast<double>(primary_scale_v<Dim>);
+      header.count = count;
+      header.data_offset = column_detail::align_up(sizeof(column_header) + units.size());
+      return header;
+   }
+
+   /// @brief Write raw values in the units of Dim to a column file
+   /// @details Throws std::runtime_error if the file cannot be written
+   /// @tparam Dim The dimension type of the values
+   /// @param path The file to create or overwrite
+   /// @param values The values to write
+   template<is_base_dimension Dim>
+   requires std::is_arithmetic_v<typename Dim::rep>
+   void write_column(const std::filesystem::path& path, std::span<const typename Dim::rep> values)
+   {
+      static_assert(column_detail::unit_string<Dim>().size() <= 0xFFFF, "Unit string is too long for a column file");
+
+      const column_header header = make_column_header<Dim>(values.size());
+      constexpr std::string_view units = column_detail::unit_string<Dim>();
+      constexpr std::array<char, column_alignment> padding{};
+
+      std::ofstream out(path, std::ios::binary | std::ios::trunc);
+      if (!out)
+      {
+         throw std::runtime_error("Unable to open column file for writing: " + path.string());
+      }
+
+      out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      out.write(units.data(), static_cast<std::streamsize>(units.size()));
+      out.write(padding.data(), static_cast<std::streamsize>(header.data_offset - sizeof(header) - units.size()));
+      out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size_bytes()));
+
+      if (!out.flush())
+      {
+         throw std::runtime_error("Unable to write column file: " + path.string());
+      }
+   }
+
+   /// @brief Write a dimension array to a column file
+   /// @param path The file to create or overwrite
+   /// @param values The array to write
+   template<is_base_dimension Dim, typename Allocator>
+   void write_column(const std::filesystem::path& path, const dimension_array<Dim, Allocator>& values)
+   {
+      write_column<Dim>(path, values.values());
+   }
+
+   /// @brief Read-only memory mapping of a whole file
+   /// @details Throws std::system_error if the file cannot be opened or mapped. An empty file maps to no bytes.
+   class mapped_file
+   {
+   public:
+      mapped_file() = default;
+
+      explicit mapped_file(const std::filesystem::path& path)
+      {
+#if defined(_WIN32)
+         HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+         if (file == INVALID_HANDLE_VALUE)
+         {
+            throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "Unable to open " + path.string());
+         }
+
+         LARGE_INTEGER fileSize;
+         if (!GetFileSizeEx(file, &fileSize))
+         {
+            const auto error = static_cast<int>(GetLastError());
+            CloseHandle(file);
+            throw std::system_error(error, std::system_category(), "Unable to read the size of " + path.string());
+         }
+
+         length = static_cast<std::size_t>(fileSize.QuadPart);
+         if (length > 0)
+         {
+            mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            void* view = (mapping != nullptr) ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (view == nullptr)
+            {
+               const auto error = static_cast<int>(GetLastError());
+               if (mapping != nullptr)
+               {
+                  CloseHandle(mapping);
+               }
+               CloseHandle(file);
+               throw std::system_error(error, std::system_category(), "Unable to map " + path.string());
+            }
+            address = static_cast<const std::byte*>(view);
+         }
+         CloseHandle(file);
+#else
+         const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+         if (fd < 0)
+         {
+            throw std::system_error(errno, std::generic_category(), "Unable to open " + path.string());
+         }
+
+         struct stat status{};
+         if (::fstat(fd, &status) != 0)
+         {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "Unable to read the size of " + path.string());
+         }
+
+         length = static_cast<std::size_t>(status.st_size);
+         if (length > 0)
+         {
+            void* view = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view == MAP_FAILED)
+            {
+               const int error = errno;
+               ::close(fd);
+               throw std::system_error(error, std::generic_category(), "Unable to map " + path.string());
+            }
+            address = static_cast<const std::byte*>(view);
+         }
+         ::close(fd);
+#endif
+      }
+
+      mapped_file(const mapped_file&) = delete;
+      mapped_file& operator=(const mapped_file&) = delete;
+
+      mapped_file(mapped_file&& other) noexcept
+         : address(std::exchange(other.address, nullptr)), length(std::exchange(other.length, 0))
+#if defined(_WIN32)
+         , mapping(std::exchange(other.mapping, nullptr))
+#endif
+      {
+      }
+
+      mapped_file& operator=(mapped_file&& other) noexcept
+      {
+         if (this != &other)
+         {
+            release();
+            address = std::exchange(other.address, nullptr);
+            length = std::exchange(other.length, 0);
+#if defined(_WIN32)
+            mapping = std::exchange(other.mapping, nullptr);
+#endif
+         }
+         return *this;
+      }
+
+      ~mapped_file() { release(); }
+
+      [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return std::span<const std::byte>(address, length); }
+
+   private:
+      void release() noexcept
+      {
+         if (address != nullptr)
+         {
+#if defined(_WIN32)
+            UnmapViewOfFile(address);
+            CloseHandle(mapping);
+            mapping = nullptr;
+#else
+            ::munmap(const_cast<std::byte*>(address), length);
+#endif
+         }
+         address = nullptr;
+         length = 0;
+      }
+
+      const std::byte* address = nullptr;
+      std::size_t length = 0;
+#if defined(_WIN32)
+      HANDLE mapping = nullptr;
+#endif
+   };
+
+   /// @brief Read the header of a column file
+   /// @details Throws std::invalid_argument if the bytes do not hold a valid column file for this host
+   /// @param bytes The contents of the file
+   /// @return The validated header
+   inline column_header read_column_header(std::span<const std::byte> bytes)
+   {
+      column_header header;
+      if (bytes.size() < sizeof(column_header))
+      {
+         throw std::invalid_argument("File is too small to be a column file");
+      }
+      std::memcpy(&header, bytes.data(), sizeof(column_header));
+
+      if (header.magic != column_header::expected_magic)
+      {
+         throw std::invalid_argument("File is not a column file");
+      }
+      if (header.byte_order != column_header::native_byte_order)
+      {
+         throw std::invalid_argument("Column file was written with a different byte order");
+      }
+
+      const std::uint64_t unitsEnd = sizeof(column_header) + header.unit_length + 1u;
+      if (unitsEnd > bytes.size() || header.data_offset > bytes.size() ||
+          header.data_offset % column_alignment != 0 || header.data_offset < unitsEnd ||
+          header.rep_size == 0 || header.count > (bytes.size() - std::min<std::uint64_t>(bytes.size(), header.data_offset)) / header.rep_size)
+      {
+         throw std::invalid_argument("Column file is truncated or its header is corrupt");
+      }
+
+      const std::string_view units(reinterpret_cast<const char*>(bytes.data()) + sizeof(column_header), header.unit_length + 1u);
+      if (FNV_1a_64Bit::hash(units) != header.type_hash)
+      {
+         throw std::invalid_argument("Column file unit string does not match its hash");
+      }
+      return header;
+   }
+
+   /// @brief A column file opened as values of Dim
+   /// @details The file is memory mapped. When it was written in the units of Dim its values are used in
+   ///    place, so opening costs the same however large the file is. When it was written in other units
+   ///    of the same dimensions, such as feet for length<meters>, the values are converted once, in bulk,
+   ///    and the mapping is released.
+   ///    Throws std::invalid_argument if the file holds other dimensions or another Rep, and
+   ///    std::out_of_range if an integral value does not fit the Rep once converted.
+   /// @tparam Dim The dimension type to read the values as
+   template<is_base_dimension Dim>
+   requires std::is_arithmetic_v<typename Dim::rep>
+   class mapped_column
+   {
+   public:
+      using dimension_type = Dim;
+      using rep = typename Dim::rep;
+      using size_type = std::size_t;
+      using const_iterator = typename dimension_array<Dim>::const_iterator;
+      using iterator = const_iterator;
+
+      explicit mapped_column(const std::filesystem::path& path)
+         : file(path), hdr(read_column_header(file.bytes())),
+           units(reinterpret_cast<const char*>(file.bytes().data()) + sizeof(column_header), hdr.unit_length)
+      {
+         if (hdr.rep_kind != serialization_detail::rep_kind_v<rep> || hdr.rep_size != sizeof(rep))
+         {
+            throw std::invalid_argument("Column file Rep does not match the requested dimension type");
+         }
+         if (dimension_signature::from_packed(hdr.signature) != dimension_signature_v<Dim>)
+         {
+            throw std::invalid_argument("Column file dimensions do not match the requested dimension type");
+         }
+
+         const std::byte* data = file.bytes().data() + hdr.data_offset;
+         const auto factor = static_cast<PrecisionType>(static_cast<PrecisionType>(hdr.scale) / primary_scale_v<Dim>);
+         if (factor == PrecisionType{1})
+         {
+            first = reinterpret_cast<const rep*>(data);
+            return;
+         }
+
+         converted = dimension_array<Dim>::uninitialized(hdr.count);
+         rep* out = converted.data();
+         if constexpr (std::is_floating_point_v<rep>)
+         {
+            // data_offset is a multiple of column_alignment and mappings are page aligned
+            kernels::scale<rep>(reinterpret_cast<const rep*>(data), out, hdr.count, static_cast<rep>(factor));
+         }
+         else
+         {
+            kernels::round_scale<ConvertibleBlockSerializationPolicy::integral_rounding, ConvertibleBlockSerializationPolicy::integral_overflow, rep>(
+               reinterpret_cast<const rep*>(data), out, hdr.count, factor);
+         }
+         first = converted.data();
+         wasConverted = true;
+         file = mapped_file();
+      }
+
+      [[nodiscard]] size_type size() const noexcept { return hdr.count; }
+      [[nodiscard]] bool empty() const noexcept { return hdr.count == 0; }
+
+      /// @brief Whether the values were converted from other units, rather than used in place
+      [[nodiscard]] bool converted_on_open() const noexcept { return wasConverted; }
+
+      [[nodiscard]] const column_header& header() const noexcept { return hdr; }
+
+      /// @brief The canonical unit string the file was written in
+      [[nodiscard]] std::string_view written_units() const noexcept { return units; }
+
+      [[nodiscard]] std::span<const rep> values() const noexcept { return std::span<const rep>(first, hdr.count); }
+
+      [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(first); }
+      [[nodiscard]] const_iterator end() const noexcept { return const_iterator(first + hdr.count); }
+
+      Dim operator[](size_type index) const { return Dim(first[index]); }
+
+   private:
+      mapped_file file;
+      column_header hdr;
+      std::string units;
+      dimension_array<Dim> converted;
+      const rep* first = nullptr;
+      bool wasConverted = false;
+   };
+
+} // end Dimension
+
+#endif // DIMENSION_COLUMN_FILE_H
@@ -0,0 +1,496 @@
+#ifndef DIMENSION_COMPACT_QUANTITY_H
+#define DIMENSION_COMPACT_QUANTITY_H
+
+#include <algorithm> // For std::min
+#include <array>
+#include <bit> // For std::bit_cast
+#include <concepts>
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::uint16_t, std::uint32_t
+#include <limits>
+#include <ratio>
+#include <span>
+#include <stdexcept> // For std::out_of_range
+#include <type_traits>
+#include <vector>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+#include "Coefficient.h"
+#include "DimensionArray.h"
+#include "PrecisionType.h"
+#include "RepTraits.h"
+#include "UnitSimplifier.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief Encodings of a floating-point value into fewer bits, for compact_quantity and compact_array
+   /// @details A codec provides storage_type, and encode and decode between storage_type and any
+   ///    floating-point type. Both are branch-free so that loops over them vectorize.
+   namespace codec
+   {
+      /// @brief IEEE 754 binary16, 11 significant bits and a range of +-65504
+      /// @details Values are rounded to the nearest representable value, ties to even, through float.
+      ///    Values beyond the range become infinity, NaN stays NaN.
+      struct float16
+      {
+         using storage_type = std::uint16_t;
+
+         template<std::floating_point T>
+         static constexpr storage_type encode(T value) noexcept
+         {
+            constexpr std::uint32_t f32_infinity = 255u << 23;
+            constexpr std::uint32_t f16_overflow = (127u + 16u) << 23;
+            constexpr std::uint32_t denormal_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+            std::uint32_t bits = std::bit_cast<std::uint32_t>(static_cast<float>(value));
+            const std::uint32_t sign = bits & 0x80000000u;
+            bits ^= sign;
+
+            // Subnormal results are aligned by a float addition, which also rounds them
+            const std::uint32_t subnormal = std::bit_cast<std::uint32_t>(std::bit_cast<float>(bits) + std::bit_cast<float>(denormal_magic)) - denormal_magic;
+
+            // Normal results rebias the exponent and round to nearest even on the dropped 13 bits
+            const std::uint32_t odd = (bits >> 13) & 1u;
+            const std::uint32_t normal = (bits + ((15u - 127u) << 23) + 0xfffu + odd) >> 13;
+
+            const std::uint32_t special = bits > f32_infinity ? 0x7e00u : 0x7c00u;
+            const std::uint32_t magnitude = bits >= f16_overflow ? special : (bits < (113u << 23) ? subnormal : normal);
+            return static_cast<storage_type>(magnitude | (sign >> 16));
+         }
+
+         template<std::floating_point T>
+         static constexpr T decode(storage_type bits) noexcept
+         {
+            constexpr std::uint32_t shifted_exponent = 0x7c00u << 13;
+            constexpr float magic = std::bit_cast<float>(113u << 23);
+
+            const std::uint32_t shifted = (static_cast<std::uint32_t>(bits) & 0x7fffu) << 13;
+            const std::uint32_t exponent = shifted & shifted_exponent;
+            const std::uint32_t rebiased = shifted + ((127u - 15u) << 23);
+
+            // Infinity and NaN take the largest exponent, subnormals are normalized by a subtraction
+            const std::uint32_t special = rebiased + ((128u - 16u) << 23);
+            const float subnormal = std::bit_cast<float>(rebiased + (1u << 23)) - magic;
+            const std::uint32_t magnitude = exponent == shifted_exponent ? special
+                                          : (exponent == 0u ? std::bit_cast<std::uint32_t>(subnormal) : rebiased);
+
+            return static_cast<T>(std::bit_cast<float>(magnitude | ((static_cast<std::uint32_t>(bits) & 0x8000u) << 16)));
+         }
+      };
+
+      /// @brief The upper half of an IEEE 754 binary32, 8 significant bits and the full range of float
+      /// @details Values are rounded to the nearest representable value, ties to even, through float.
+      struct bfloat16
+      {
+         using storage_type = std::uint16_t;
+
+         template<std::floating_point T>
+         static constexpr storage_type encode(T value) noexcept
+         {
+            const auto bits = std::bit_cast<std::uint32_t>(static_cast<float>(value));
+            const std::uint32_t rounded = (bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16;
+
+            // Rounding must not carry a NaN payload into infinity
+            const bool nan = (bits & 0x7fffffffu) > 0x7f800000u;
+            return static_cast<storage_type>(nan ? ((bits >> 16) | 0x40u) : rounded);
+         }
+
+         template<std::floating_point T>
+         static constexpr T decode(storage_type bits) noexcept
+         {
+            return static_cast<T>(std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16));
+         }
+      };
+
+      /// @brief A fixed-point integer, value = stored * Resolution + Offset in the units of the dimension
+      /// @details Values are rounded to the nearest step, halfway cases away from zero, and saturate
+      ///    at the range of Int. NaN encodes as zero, which decodes to Offset.
+      /// @tparam Int The integral storage type, such as std::int16_t
+      /// @tparam Resolution The value of one step as a std::ratio, such as std::centi for 0.01 K
+      /// @tparam Offset The value of a stored zero as a std::ratio
+      template<std::integral Int, typename Resolution, typename Offset = std::ratio<0>>
+      struct scaled
+      {
+         static_assert(Resolution::num > 0, "Resolution must be positive");
+
+         using storage_type = Int;
+         using resolution = Resolution;
+         using offset = Offset;
+
+         template<std::floating_point T>
+         static constexpr storage_type encode(T value) noexcept
+         {
+            static_assert(std::numeric_limits<Int>::digits <= std::numeric_limits<T>::digits, "The range of Int must be exact in T");
+
+            constexpr T inverse = static_cast<T>(Resolution::den) / static_cast<T>(Resolution::num);
+            constexpr T base = static_cast<T>(Offset::num) / static_cast<T>(Offset::den);
+            constexpr T low = static_cast<T>(std::numeric_limits<Int>::min());
+            constexpr T high = static_cast<T>(std::numeric_limits<Int>::max());
+
+            const T steps = (value - base) * inverse;
+            const T rounded = steps + (steps < T{0} ? T{-0.5} : T{0.5});
+
+            // Min and max selects, then NaN, which compares unequal to itself, becomes zero
+            const T below = rounded < high ? rounded : high;
+            const T clamped = below > low ? below : low;
+            return static_cast<storage_type>(steps == steps ? clamped : T{0});
+         }
+
+         template<std::floating_point T>
+         static constexpr T decode(storage_type bits) noexcept
+         {
+            constexpr T step = static_cast<T>(Resolution::num) / static_cast<T>(Resolution::den);
+            constexpr T base = static_cast<T>(Offset::num) / static_cast<T>(Offset::den);
+            return static_cast<T>(bits) * step + base;
+         }
+      };
+   }
+
+   /// @brief Concept for a codec of compact_quantity, see the codec namespace
+   template<typename Codec>
+   concept compact_codec = requires(typename Codec::storage_type bits, double value)
+   {
+      { Codec::template encode<double>(value) } -> std::same_as<typename Codec::storage_type>;
+      { Codec::template decode<double>(bits) } -> std::same_as<double>;
+   };
+
+   namespace kernels
+   {
+      /// @brief out[i] = Codec::encode(in[i]) for n elements
+      /// @details float16 uses the F16C conversion instructions when enabled at compile time, 16
+      ///    floats at a time with AVX-512, with a scalar tail. Other codecs are branch-free loops the compiler vectorizes.
+      template<compact_codec Codec, std::floating_point T>
+      void encode(const T* in, typename Codec::storage_type* out, std::size_t n) noexcept
+      {
+         std::size_t i = 0;
+
+         if constexpr (std::is_same_v<Codec, codec::float16>)
+         {
+            #if defined(__AVX512F__) && defined(__F16C__)
+            if constexpr (std::is_same_v<T, float>)
+            {
+               for (; i + 16 <= n; i += 16)
+               {
+                  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                                      _mm512_cvtps_ph(_mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+               }
+            }
+            else
+            {
+               for (; i + 8 <= n; i += 8)
+               {
+                  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                                   _mm256_cvtps_ph(_mm512_cvtpd_ps(_mm512_loadu_pd(in + i)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+               }
+            }
+            #elif defined(__F16C__)
+            if constexpr (std::is_same_v<T, float>)
+            {
+               for (; i + 8 <= n; i += 8)
+               {
+                  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                                   _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+               }
+            }
+            else
+            {
+               for (; i + 4 <= n; i += 4)
+               {
+                  _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                                   _mm_cvtps_ph(_mm256_cvtpd_ps(_mm256_loadu_pd(in + i)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+               }
+            }
+            #endif
+         }
+
+         for (; i < n; ++i)
+         {
+            out[i] = Codec::encode(in[i]);
+         }
+      }
+
+      /// @brief out[i] = Codec::decode(in[i]) for n elements, see encode for the instructions used
+      template<compact_codec Codec, std::floating_point T>
+      void decode(const typename Codec::storage_type* in, T* out, std::size_t n) noexcept
+      {
+         std::size_t i = 0;
+
+         if constexpr (std::is_same_v<Codec, codec::float16>)
+         {
+            #if defined(__AVX512F__) && defined(__F16C__)
+            if constexpr (std::is_same_v<T, float>)
+            {
+               for (; i + 16 <= n; i += 16)
+               {
+                  _mm512_storeu_ps(out + i, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i))));
+               }
+            }
+            else
+            {
+               for (; i + 8 <= n; i += 8)
+               {
+                  _mm512_storeu_pd(out + i, _mm512_cvtps_pd(_mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)))));
+               }
+            }
+            #elif defined(__F16C__)
+            if constexpr (std::is_same_v<T, float>)
+            {
+               for (; i + 8 <= n; i += 8)
+               {
+                  _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+               }
+            }
+            else
+            {
+               for (; i + 4 <= n; i += 4)
+               {
+                  _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)))));
+               }
+            }
+            #endif
+         }
+
+         for (; i < n; ++i)
+         {
+            out[i] = Codec::template decode<T>(in[i]);
+         }
+      }
+   }
+
+   namespace compact_detail
+   {
+      /// @brief Raw value of a matching dimension in the units of Dim
+      template<is_base_dimension Dim, is_base_dimension Other>
+      constexpr typename Dim::rep raw_in(const Other& value)
+      {
+         if constexpr (std::is_same_v<Dim, Other>)
+         {
+            return value.template get_tuple_scalar<typename Dim::units>();
+         }
+         else
+         {
+            return static_cast<typename Dim::rep>(get_dimension_tuple<typename Dim::units>(value) / coefficient_factor_v<Dim>);
+         }
+      }
+
+      /// @brief Values decoded at once by the block-wise operations of compact_array
+      inline constexpr std::size_t block_size = 1024;
+   }
+
+   /// @brief One dimension stored in the compact encoding of Codec
+   /// @details Only the encoded bits are stored. Reading widens them to a Dim, arithmetic is done
+   ///    on Dim, and compound assignment writes the result back through the codec. Each write
+   ///    rounds to the precision of the codec.
+   /// @tparam Dim The dimension type, such as temperature<kelvin>, its Rep is the compute Rep
+   /// @tparam Codec The encoding, such as codec::float16 or codec::scaled<std::int16_t, std::centi>
+   template<is_base_dimension Dim, compact_codec Codec>
+   requires std::is_floating_point_v<typename Dim::rep>
+   class compact_quantity
+   {
+   public:
+      using dimension_type = Dim;
+      using codec_type = Codec;
+      using storage_type = typename Codec::storage_type;
+      using rep = typename Dim::rep;
+
+      /// @brief Zero bits, the value of which depends on the codec
+      constexpr compact_quantity() noexcept = default;
+
+      /// @brief Encode a dimension, converting it to the units of Dim first
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      // Implicit encoding mirrors the implicit conversions of base_dimension
+      // cppcheck-suppress noExplicitConstructor
+      constexpr compact_quantity(const Other& value) noexcept
+         : bits(Codec::encode(compact_detail::raw_in<Dim>(value)))
+      {
+      }
+
+      [[nodiscard]] static constexpr compact_quantity from_bits(storage_type encoded) noexcept
+      {
+         compact_quantity result;
+         result.bits = encoded;
+         return result;
+      }
+
+      [[nodiscard]] constexpr storage_type encoded() const noexcept { return bits; }
+
+      /// @brief Decode to the compute Rep
+      [[nodiscard]] constexpr Dim value() const noexcept { return Dim(Codec::template decode<rep>(bits)); }
+
+      // Widening is lossless, so reading as a dimension is implicit
+      // cppcheck-suppress noExplicitConstructor
+      constexpr operator Dim() const noexcept { return value(); }
+
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      constexpr compact_quantity& operator+=(const Other& rhs) noexcept { return *this = value() + rhs; }
+
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      constexpr compact_quantity& operator-=(const Other& rhs) noexcept { return *this = value() - rhs; }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      constexpr compact_quantity& operator*=(Scalar scalar) noexcept { return *this = Dim(value().template get_tuple_scalar<typename Dim::units>() * static_cast<rep>(scalar)); }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      constexpr compact_quantity& operator/=(Scalar scalar) noexcept { return *this = Dim(value().template get_tuple_scalar<typename Dim::units>() / static_cast<rep>(scalar)); }
+
+      /// @brief Equality of the encoded bits
+      friend constexpr bool operator==(const compact_quantity& lhs, const compact_quantity& rhs) noexcept { return lhs.bits == rhs.bits; }
+
+   private:
+      storage_type bits{};
+   };
+
+   /// @brief Array of dimensions stored in the compact encoding of Codec
+   /// @details The values are one contiguous vector of encoded bits. Whole-array operations decode
+   ///    blocks of compact_detail::block_size values into the compute Rep with the batched
+   ///    kernels, work on them there, and encode them back.
+   /// @tparam Dim The dimension type, its Rep is the compute Rep
+   /// @tparam Codec The encoding, see the codec namespace
+   template<is_base_dimension Dim, compact_codec Codec>
+   requires std::is_floating_point_v<typename Dim::rep>
+   class compact_array
+   {
+   public:
+      using dimension_type = Dim;
+      using codec_type = Codec;
+      using storage_type = typename Codec::storage_type;
+      using rep = typename Dim::rep;
+      using size_type = std::size_t;
+
+      compact_array() = default;
+
+      /// @brief count elements of zero bits
+      explicit compact_array(size_type count) : storage(count) {}
+
+      /// @brief Encode every value of a dimension_array, converting to the units of Dim first
+      template<is_base_dimension Other, typename Allocator>
+      requires matching_dimensions<Dim, Other>
+      explicit compact_array(const dimension_array<Other, Allocator>& values) : storage(values.size())
+      {
+         if constexpr (std::is_same_v<Dim, Other>)
+         {
+            kernels::encode<Codec>(values.data(), storage.data(), storage.size());
+         }
+         else
+         {
+            const auto converted = values.template as<Dim>();
+            kernels::encode<Codec>(converted.data(), storage.data(), storage.size());
+         }
+      }
+
+      [[nodiscard]] size_type size() const noexcept { return storage.size(); }
+      [[nodiscard]] bool empty() const noexcept { return storage.empty(); }
+
+      [[nodiscard]] storage_type* data() noexcept { return storage.data(); }
+      [[nodiscard]] const storage_type* data() const noexcept { return storage.data(); }
+
+      /// @brief Decode one element
+      [[nodiscard]] Dim operator[](size_type index) const { return Dim(Codec::template decode<rep>(storage[index])); }
+
+      /// @brief Encode one element, converting value to the units of Dim first
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      void set(size_type index, const Other& value) { storage[index] = Codec::encode(compact_detail::raw_in<Dim>(value)); }
+
+      /// @brief Decode out.size() elements starting at first into raw values in the units of Dim
+      /// @throws std::out_of_range if the range extends past the end of the array
+      void decode(size_type first, std::span<rep> out) const
+      {
+         check_range(first, out.size());
+         kernels::decode<Codec>(storage.data() + first, out.data(), out.size());
+      }
+
+      /// @brief Encode raw values in the units of Dim into the elements starting at first
+      /// @throws std::out_of_range if the range extends past the end of the array
+      void encode(size_type first, std::span<const rep> values)
+      {
+         check_range(first, values.size());
+         kernels::encode<Codec>(values.data(), storage.data() + first, values.size());
+      }
+
+      /// @brief Decode the whole array
+      [[nodiscard]] dimension_array<Dim> decoded() const
+      {
+         auto result = dimension_array<Dim>::uninitialized(storage.size());
+         kernels::decode<Codec>(storage.data(), result.data(), storage.size());
+         return result;
+      }
+
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      compact_array& operator+=(const Other& rhs)
+      {
+         const rep addend = compact_detail::raw_in<Dim>(rhs);
+         update([addend](rep value) { return value + addend; });
+         return *this;
+      }
+
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      compact_array& operator-=(const Other& rhs)
+      {
+         const rep subtrahend = compact_detail::raw_in<Dim>(rhs);
+         update([subtrahend](rep value) { return value - subtrahend; });
+         return *this;
+      }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      compact_array& operator*=(Scalar scalar)
+      {
+         const auto factor = static_cast<rep>(scalar);
+         update([factor](rep value) { return value * factor; });
+         return *this;
+      }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      compact_array& operator/=(Scalar scalar)
+      {
+         const auto divisor = static_cast<rep>(scalar);
+         update([divisor](rep value) { return value / divisor; });
+         return *this;
+      }
+
+   private:
+      void check_range(size_type first, size_type count) const
+      {
+         if (first > storage.size() || count > storage.size() - first)
+         {
+            throw std::out_of_range("compact_array range out of range");
+         }
+      }
+
+      /// @brief Decode each block, apply op to every raw value, and encode it back
+      template<typename Op>
+      void update(Op op)
+      {
+         std::array<rep, compact_detail::block_size> block;
+         for (size_type first = 0; first < storage.size(); first += block.size())
+         {
+            const size_type count = std::min(block.size(), storage.size() - first);
+            kernels::decode<Codec>(storage.data() + first, block.data(), count);
+            for (size_type i = 0; i < count; ++i)
+            {
+               block[i] = op(block[i]);
+            }
+            kernels::encode<Codec>(block.data(), storage.data() + first, count);
+         }
+      }
+
+      std::vector<storage_type> storage;
+   };
+
+} // end Dimension
+
+#endif // DIMENSION_COMPACT_QUANTITY_H
@@ -112,6 +112,12 @@ namespace dimension
       }
    }
 
+   /// @brief Precision at which conversion slopes and offsets are applied to values of type T
+   /// @details Floating-point values convert at their own precision,
+   ///    any other type converts at PrecisionType
+   template<typename T>
+   using conversion_precision_t = std::conditional_t<std::is_floating_point_v<T>, T, PrecisionType>;
+
    /// @brief Conversion traits to be defined for each conversion
    /// @details For each conversion, define a slope and optionally an offset
    /// @tparam From Unit to convert from
@@ -135,33 +141,42 @@ namespace dimension
    /// @tparam IsDelta Bool indicating if the unit being converted is sole unit of the dimension 
    ///   and is in the numerator (False), otherwise True
    /// @tparam Inverse Whether to use the inverse of the conversion traits
+   /// @tparam T Type of the value, slopes and offsets are stored at conversion_precision_t<T>
    /// @param input value to convert
    /// @return converted value
-   template<typename Conv, bool IsDelta, bool Inverse>
-   constexpr PrecisionType ConvertImpl(PrecisionType input)
+   template<typename Conv, bool IsDelta, bool Inverse, typename T = PrecisionType>
+   constexpr T ConvertImpl(T input)
    {
       // Assumes all checks have been made
+      using P = conversion_precision_t<T>;
 
       if constexpr (!Inverse)
       {
+         constexpr P slope = static_cast<P>(Conv::slope);
+
          if constexpr (HasOffset<Conv> && !IsDelta) // Conversion provides offset
          {
-            return input * Conv::slope + GetOffset<Conv>();
+            constexpr P offset = static_cast<P>(GetOffset<Conv>());
+            return static_cast<T>(static_cast<P>(input) * slope + offset);
          }
          else // Conversion does not provides offset
          {
-            return input * Conv::slope;
+            return static_cast<T>(static_cast<P>(input) * slope);
          }
       }
       else
       {
+         // Multiply by a compile-time reciprocal rather than dividing at run time
+         constexpr P inverse_slope = static_cast<P>(PrecisionType{1} / Conv::slope);
+
          if constexpr (HasOffset<Conv> && !IsDelta) // Conversion provides offset
          {
-            return (input - GetOffset<Conv>()) / Conv::slope;
+            constexpr P offset = static_cast<P>(GetOffset<Conv>());
+            return static_cast<T>((static_cast<P>(input) - offset) * inverse_slope);
          }
          else // Conversion does not provides offset
          {
-            return input / Conv::slope;
+            return static_cast<T>(static_cast<P>(input) * inverse_slope);
          }
       }
    }
@@ -173,11 +188,12 @@ namespace dimension
    /// @tparam IsDelta Bool indicating if the unit being converted is sole unit of the dimension 
    ///   and is in the numerator (False), otherwise True
    /// @tparam Inverse Whether to use the inverse of the conversion traits
+   /// @tparam T Type of the value, slopes are stored at conversion_precision_t<T>
    /// @param input value to convert
    /// @return converted value
-   template<typename From, typename To, bool Inverse = false>
+   template<typename From, typename To, bool Inverse = false, typename T = PrecisionType>
    //requires (IsDelta || !Inverse)
-   constexpr PrecisionType Convert(PrecisionType input)
+   constexpr T Convert(T input)
    {
 
       // TODO: Cut the not-delta line entirely
@@ -195,22 +211,23 @@ namespace dimension
       }
       else if constexpr (HasConversion<FromT, ToT>) // Direct conversion exists
       {
-         return ConvertImpl<Conversion<FromT, ToT>, IsDelta, Inverse>(input);
+         return ConvertImpl<Conversion<FromT, ToT>, IsDelta, Inverse, T>(input);
       }
       else if constexpr (HasConversion<ToT, FromT>) // Inverse direct conversion exists
       {
-         return ConvertImpl<Conversion<ToT, FromT>, IsDelta, !Inverse>(input);
+         return ConvertImpl<Conversion<ToT, FromT>, IsDelta, !Inverse, T>(input);
       }
       else // No direct conversion exists, fall back to primary
       {
          #ifdef REQUIRE_CONVERSIONS
-            static_assert(sizeof(fromUnit) == -1, "No specialized conversion found. See compiler output for more details");
+            static_assert(sizeof(FromT) == 0, "No specialized conversion found. See compiler output for more details");
          #endif
-         // Temporary variable is NOT created to allow full constexpr behavior in situations where input itself is constexpr
-         return Convert<typename FromT::Primary, To, Inverse>
+         // Deltas are linear, so both hops through Primary fold into a single compile-time slope
+         constexpr auto slope = static_cast<conversion_precision_t<T>>(Convert<typename FromT::Primary, To, Inverse>
          (
-            Convert<FromT, typename FromT::Primary, Inverse>(input)
-         );
+            Convert<FromT, typename FromT::Primary, Inverse>(PrecisionType{1})
+         ));
+         return static_cast<T>(static_cast<conversion_precision_t<T>>(input) * slope);
       }
    }
 
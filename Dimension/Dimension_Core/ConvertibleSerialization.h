@@ -0,0 +1,287 @@
+#ifndef DIMENSION_CONVERTIBLE_SERIALIZATION_H
+#define DIMENSION_CONVERTIBLE_SERIALIZATION_H
+
+#include <array>
+#include <cstddef> // For std::byte, std::size_t
+#include <cstdint> // For std::uint#_t, std::uintptr_t
+#include <cstring> // For std::memcpy
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept> // For std::invalid_argument
+#include <type_traits>
+
+#include "BatchConversion.h"
+#include "DynamicQuantity.h"
+#include "ExactConversion.h"
+#include "PrecisionType.h"
+#include "SerializationPolicies.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   namespace serialization_detail
+   {
+      /// @brief 'f' for floating point, 'i' for signed and 'u' for unsigned integer representations
+      template<typename Rep>
+      inline constexpr char rep_kind_v = std::is_floating_point_v<Rep> ? 'f' : (std::is_signed_v<Rep> ? 'i' : 'u');
+   }
+
+   /// @brief Block serialization policy readable in any units of the same dimensions
+   /// @details Instead of a tag hashing the exact units, the header records the signature of the
+   ///   fundamental dimensions and the factor taking a stored value to their primary units, so a block
+   ///   written as length<feet> can be read as length<meters>. The reader checks the signature once,
+   ///   then applies a single conversion factor to the whole block. When the units match, the factor is
+   ///   exactly one and the values are copied as they are.
+   ///   Layout: [signature (uint64_t)][scale (double)][rep kind (char)][sizeof(Rep) (uint8_t)][reserved (uint16_t)]
+   ///   [count (uint32_t)][count * sizeof(Rep) bytes], all in native byte order. The header is 24 bytes,
+   ///   so values written at an address aligned for Rep stay aligned.
+   ///   As with BlockSerializationPolicy, buffers are supplied by the caller and nothing is allocated.
+   struct ConvertibleBlockSerializationPolicy
+   {
+      using count_type = std::uint32_t;
+
+      /// @brief Size in bytes of the header preceding the values
+      static constexpr std::size_t header_size = sizeof(std::uint64_t) + sizeof(double) + 4 + sizeof(count_type);
+
+      /// @brief Size in bytes of a block holding count values of Dim
+      template <is_base_dimension Dim>
+      [[nodiscard]] static constexpr std::size_t block_size(std::size_t count) noexcept
+      {
+         return header_size + count * sizeof(typename Dim::rep);
+      }
+
+      /// @brief Rounding and range checking of integral values read in other units
+      /// @details A value which does not fit the Rep after conversion throws std::out_of_range
+      static constexpr rounding integral_rounding = rounding::to_nearest;
+      static constexpr overflow integral_overflow = overflow::checked;
+
+   private:
+      struct header
+      {
+         std::size_t count;
+         PrecisionType factor;
+      };
+
+      template <is_base_dimension Dim>
+      static std::byte* write_header(std::span<std::byte> bytes, std::size_t count)
+      {
+         using rep = typename Dim::rep;
+         static_assert(std::is_arithmetic_v<rep>, "Convertible block serialization requires an arithmetic Rep");
+
+         serialization_detail::check_block_output(count, bytes.size(), block_size<Dim>(count));
+
+         constexpr std::uint64_t signature = dimension_signature_v<Dim>.packed();
+         constexpr double scale = static_cast<double>(primary_scale_v<Dim>);
+         constexpr std::array<std::uint8_t, 4> repInfo{static_cast<std::uint8_t>(serialization_detail::rep_kind_v<rep>),
+                                                       static_cast<std::uint8_t>(sizeof(rep)), 0, 0};
+         const auto blockCount = static_cast<count_type>(count);
+
+         std::byte* out = bytes.data();
+         std::memcpy(out, &signature, sizeof(signature));
+         std::memcpy(out + 8, &scale, sizeof(scale));
+         std::memcpy(out + 16, repInfo.data(), repInfo.size());
+         std::memcpy(out + 20, &blockCount, sizeof(blockCount));
+         return out + header_size;
+      }
+
+      template <is_base_dimension Dim>
+      static header read_header(std::span<const std::byte> bytes)
+      {
+         using rep = typename Dim::rep;
+         static_assert(std::is_arithmetic_v<rep>, "Convertible block serialization requires an arithmetic Rep");
+
+         serialization_detail::check_block_header(bytes.size(), header_size);
+
+         std::uint64_t signature;
+         double scale;
+         std::array<std::uint8_t, 4> repInfo;
+         count_type count;
+         std::memcpy(&signature, bytes.data(), sizeof(signature));
+         std::memcpy(&scale, bytes.data() + 8, sizeof(scale));
+         std::memcpy(repInfo.data(), bytes.data() + 16, repInfo.size());
+         std::memcpy(&count, bytes.data() + 20, sizeof(count));
+
+         if (dimension_signature::from_packed(signature) != dimension_signature_v<Dim>)
+         {
+            throw std::invalid_argument("Serialized block dimensions do not match the requested dimension type");
+         }
+         if (repInfo[0] != static_cast<std::uint8_t>(serialization_detail::rep_kind_v<rep>) || repInfo[1] != sizeof(rep))
+         {
+            throw std::invalid_argument("Serialized block Rep does not match the requested dimension type");
+         }
+         serialization_detail::check_block_input(bytes.size(), block_size<Dim>(count));
+
+         // Identical units give exactly one, since both scales are the same constant
+         return {count, static_cast<PrecisionType>(static_cast<PrecisionType>(scale) / primary_scale_v<Dim>)};
+      }
+
+      template <typename Rep>
+      static Rep load(const std::byte* ptr) noexcept
+      {
+         Rep value;
+         std::memcpy(&value, ptr, sizeof(Rep));
+         return value;
+      }
+
+      template <typename Rep>
+      static Rep convert(Rep value, PrecisionType factor)
+      {
+         if constexpr (std::is_floating_point_v<Rep>)
+         {
+            return static_cast<Rep>(value * static_cast<Rep>(factor));
+         }
+         else
+         {
+            return exact_detail::round_to<integral_rounding, integral_overflow, Rep>(static_cast<PrecisionType>(value) * factor);
+         }
+      }
+
+   public:
+      /// @brief serialize packed values in the units of Dim into a passed buffer
+      /// @tparam Dim The dimension type of the values
+      /// @tparam OutputBuf The buffer type
+      /// @param out The buffer to serialize into
+      /// @param values The values to serialize
+      /// @return The number of bytes written
+      template <is_base_dimension Dim, typename OutputBuf>
+      static std::size_t serialize(OutputBuf&& out, std::span<const typename Dim::rep> values)
+      {
+         std::byte* data = write_header<Dim>(serialization_detail::output_bytes(out), values.size());
+         if (!values.empty())
+         {
+            std::memcpy(data, values.data(), values.size_bytes());
+         }
+         return block_size<Dim>(values.size());
+      }
+
+      /// @brief serialize a range of base_dimension objects into a passed buffer
+      /// @tparam Dim The dimension type to serialize
+      /// @tparam OutputBuf The buffer type
+      /// @param out The buffer to serialize into
+      /// @param objs The objects to serialize
+      /// @return The number of bytes written
+      template <is_base_dimension Dim, typename OutputBuf>
+      static std::size_t serialize(OutputBuf&& out, std::span<const Dim> objs)
+      {
+         using rep = typename Dim::rep;
+
+         std::byte* data = write_header<Dim>(serialization_detail::output_bytes(out), objs.size());
+         for (const Dim& obj : objs)
+         {
+            // Stored raw, since the scale in the header already includes the coefficients
+            const rep value = obj.template get_tuple_scalar<typename Dim::units>();
+            std::memcpy(data, &value, sizeof(rep));
+            data += sizeof(rep);
+         }
+         return block_size<Dim>(objs.size());
+      }
+
+      /// @brief Validate the header of a serialized block and return its number of values
+      /// @details Throws std::invalid_argument if the block holds other dimensions or another Rep
+      /// @tparam Dim The dimension type to read the block as
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @return The number of values in the block
+      template <is_base_dimension Dim, typename InputBuf>
+      [[nodiscard]] static std::size_t count(const InputBuf& in)
+      {
+         return read_header<Dim>(serialization_detail::input_bytes(in)).count;
+      }
+
+      /// @brief Factor applied to the stored values to read them in the units of Dim
+      /// @details Exactly one when the block was written in the units of Dim
+      /// @tparam Dim The dimension type to read the block as
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @return The conversion factor
+      template <is_base_dimension Dim, typename InputBuf>
+      [[nodiscard]] static PrecisionType conversion_factor(const InputBuf& in)
+      {
+         return read_header<Dim>(serialization_detail::input_bytes(in)).factor;
+      }
+
+      /// @brief deserialize a block into packed values in the units of Dim, converting them if needed
+      /// @tparam Dim The dimension type to read the block as
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @param values Destination for the values. Must hold at least count<Dim>(in) values.
+      /// @return The number of values read
+      /// @throws std::out_of_range if an integral value converted to the units of Dim does not fit its Rep
+      template <is_base_dimension Dim, typename InputBuf>
+      static std::size_t deserialize(const InputBuf& in, std::span<typename Dim::rep> values)
+      {
+         using rep = typename Dim::rep;
+
+         const std::span<const std::byte> bytes = serialization_detail::input_bytes(in);
+         const header hdr = read_header<Dim>(bytes);
+         serialization_detail::check_destination(values.size(), hdr.count);
+         if (hdr.count == 0)
+         {
+            return 0;
+         }
+
+         const std::byte* data = bytes.data() + header_size;
+         if (hdr.factor == PrecisionType{1})
+         {
+            std::memcpy(values.data(), data, hdr.count * sizeof(rep));
+         }
+         else if constexpr (std::is_floating_point_v<rep>)
+         {
+            if (reinterpret_cast<std::uintptr_t>(data) % alignof(rep) == 0)
+            {
+               kernels::scale<rep>(reinterpret_cast<const rep*>(data), values.data(), hdr.count, static_cast<rep>(hdr.factor));
+            }
+            else
+            {
+               std::memcpy(values.data(), data, hdr.count * sizeof(rep));
+               kernels::scale<rep>(values.data(), values.data(), hdr.count, static_cast<rep>(hdr.factor));
+            }
+         }
+         else
+         {
+            std::memcpy(values.data(), data, hdr.count * sizeof(rep));
+            kernels::round_scale<integral_rounding, integral_overflow, rep>(values.data(), values.data(), hdr.count, hdr.factor);
+         }
+         return hdr.count;
+      }
+
+      /// @brief deserialize a block into base_dimension objects, converting the values if needed
+      /// @tparam Dim The dimension type to read the block as
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @param objs Destination for the objects. Must hold at least count<Dim>(in) objects.
+      /// @return The number of objects read
+      /// @throws std::out_of_range if an integral value converted to the units of Dim does not fit its Rep
+      template <is_base_dimension Dim, typename InputBuf>
+      static std::size_t deserialize(const InputBuf& in, std::span<Dim> objs)
+      {
+         using rep = typename Dim::rep;
+
+         const std::span<const std::byte> bytes = serialization_detail::input_bytes(in);
+         const header hdr = read_header<Dim>(bytes);
+         serialization_detail::check_destination(objs.size(), hdr.count);
+
+         const std::byte* data = bytes.data() + header_size;
+         if (hdr.factor == PrecisionType{1})
+         {
+            for (std::size_t i = 0; i < hdr.count; ++i)
+            {
+               objs[i] = Dim(load<rep>(data + i * sizeof(rep)));
+            }
+         }
+         else
+         {
+            for (std::size_t i = 0; i < hdr.count; ++i)
+            {
+               objs[i] = Dim(convert(load<rep>(data + i * sizeof(rep)), hdr.factor));
+            }
+         }
+         return hdr.count;
+      }
+   };
+
+} // end Dimension
+
+#endif // DIMENSION_CONVERTIBLE_SERIALIZATION_H
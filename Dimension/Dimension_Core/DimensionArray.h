@@ -0,0 +1,359 @@
+#ifndef DIMENSION_DIMENSION_ARRAY_H
+#define DIMENSION_DIMENSION_ARRAY_H
+
+#include <algorithm> // For std::copy
+#include <cstddef> // For std::size_t, std::ptrdiff_t
+#include <initializer_list>
+#include <iterator> // For std::random_access_iterator_tag
+#include <memory> // For std::allocator, std::allocator_traits
+#include <memory_resource> // For std::pmr::polymorphic_allocator
+#include <new> // For placement new
+#include <span>
+#include <stdexcept> // For std::out_of_range
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ArrayExpression.h"
+#include "BatchConversion.h"
+#include "Coefficient.h"
+#include "ExactConversion.h"
+#include "TupleHandling.h"
+#include "UnitSimplifier.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief Allocator adaptor which default-initializes elements constructed without arguments
+   /// @details std::vector value-initializes elements on resize, meaning every new double is zeroed.
+   ///    Wrapping the allocator with this adaptor turns argument-less construction into
+   ///    default-initialization, which is a no-op for arithmetic types.
+   ///    All other construction is forwarded to the wrapped allocator.
+   /// @tparam T The value type
+   /// @tparam Alloc The allocator being adapted
+   template<typename T, typename Alloc = std::allocator<T>>
+   class default_init_allocator : public Alloc
+   {
+   private:
+      using traits = std::allocator_traits<Alloc>;
+
+   public:
+      using value_type = T;
+
+      template<typename U>
+      struct rebind
+      {
+         using other = default_init_allocator<U, typename traits::template rebind_alloc<U>>;
+      };
+
+      using Alloc::Alloc;
+
+      constexpr default_init_allocator() = default;
+
+      // Wrapping an allocator is the purpose of this type, implicit conversion is acceptable.
+      // cppcheck-suppress noExplicitConstructor
+      constexpr default_init_allocator(const Alloc& alloc) noexcept : Alloc(alloc) {}
+
+      template<typename U, typename OtherAlloc>
+      // Rebinding must be implicit to satisfy allocator requirements.
+      // cppcheck-suppress noExplicitConstructor
+      constexpr default_init_allocator(const default_init_allocator<U, OtherAlloc>& other) noexcept
+         : Alloc(static_cast<const OtherAlloc&>(other))
+      {
+      }
+
+      /// @brief Default-initialize an element (no zeroing for arithmetic types)
+      template<typename U>
+      void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>)
+      {
+         ::new (static_cast<void*>(ptr)) U;
+      }
+
+      /// @brief Forward any other construction to the adapted allocator
+      template<typename U, typename... Args>
+      void construct(U* ptr, Args&&... args)
+      {
+         traits::construct(static_cast<Alloc&>(*this), ptr, std::forward<Args>(args)...);
+      }
+   };
+
+   /// @brief Contiguous container of same-unit dimension values
+   /// @details Stores raw Rep values in a single contiguous buffer, with the units
+   ///    carried once in the type rather than once per element. The raw buffer is
+   ///    exposed through data() and values(), while element access yields Dim objects.
+   ///    Whole arrays can be converted to other units with a single pass via as().
+   /// @tparam Dim The dimension type of each element, such as length<feet>
+   /// @tparam Allocator Allocator for the underlying Rep buffer, std::pmr allocators are supported
+   template<is_base_dimension Dim, typename Allocator = std::allocator<typename Dim::rep>>
+   class dimension_array
+   {
+   public:
+      using dimension_type = Dim;
+      using rep = typename Dim::rep;
+      using units = typename Dim::units;
+      using allocator_type = Allocator;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+
+      static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, rep>,
+         "dimension_array allocator value_type must match the Rep of the dimension");
+
+   private:
+      using storage_type = std::vector<rep, default_init_allocator<rep, Allocator>>;
+
+      /// @brief Raw value stored for a dimension object, in terms of this array's units
+      static constexpr rep to_raw(const Dim& obj)
+      {
+         return obj.template get_tuple_scalar<units>();
+      }
+
+   public:
+      /// @brief Random access iterator yielding Dim objects by value
+      class const_iterator
+      {
+      public:
+         // Elements are produced by value, so only input iteration is advertised to legacy algorithms
+         using iterator_concept = std::random_access_iterator_tag;
+         using iterator_category = std::input_iterator_tag;
+         using value_type = Dim;
+         using difference_type = std::ptrdiff_t;
+         using pointer = void;
+         using reference = Dim;
+
+         constexpr const_iterator() = default;
+         constexpr explicit const_iterator(const rep* ptr) : current(ptr) {}
+
+         constexpr Dim operator*() const { return Dim(*current); }
+         constexpr Dim operator[](difference_type n) const { return Dim(current[n]); }
+
+         constexpr const_iterator& operator++() { ++current; return *this; }
+         constexpr const_iterator operator++(int) { const_iterator tmp = *this; ++current; return tmp; }
+         constexpr const_iterator& operator--() { --current; return *this; }
+         constexpr const_iterator operator--(int) { const_iterator tmp = *this; --current; return tmp; }
+
+         constexpr const_iterator& operator+=(difference_type n) { current += n; return *this; }
+         constexpr const_iterator& operator-=(difference_type n) { current -= n; return *this; }
+
+         friend constexpr const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+         friend constexpr const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+         friend constexpr const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+         friend constexpr difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) { return lhs.current - rhs.current; }
+
+         friend constexpr bool operator==(const const_iterator& lhs, const const_iterator& rhs) = default;
+         friend constexpr auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) = default;
+
+      private:
+         const rep* current = nullptr;
+      };
+
+      using iterator = const_iterator;
+
+      dimension_array() = default;
+
+      explicit dimension_array(const Allocator& alloc) : storage(alloc) {}
+
+      /// @brief Construct count zero-valued elements
+      explicit dimension_array(size_type count, const Allocator& alloc = Allocator())
+         : storage(count, rep{0}, alloc)
+      {
+      }
+
+      /// @brief Construct count copies of value
+      dimension_array(size_type count, const Dim& value, const Allocator& alloc = Allocator())
+         : storage(count, to_raw(value), alloc)
+      {
+      }
+
+      dimension_array(std::initializer_list<Dim> init, const Allocator& alloc = Allocator())
+         : storage(alloc)
+      {
+         storage.reserve(init.size());
+         for (const Dim& obj : init)
+         {
+            storage.push_back(to_raw(obj));
+         }
+      }
+
+      /// @brief Construct from raw values already expressed in this array's units
+      explicit dimension_array(std::span<const rep> raw, const Allocator& alloc = Allocator())
+         : storage(raw.begin(), raw.end(), alloc)
+      {
+      }
+
+      /// @brief Evaluate a lazy array expression into a new array in this array's units
+      /// @details Converting from an expression is the point of the expression layer, so it is implicit,
+      ///    the same way a base_dimension converts implicitly between matching units.
+      template<is_array_expression Expr>
+      requires matching_dimensions<typename Expr::dimension_type, Dim>
+      // cppcheck-suppress noExplicitConstructor
+      dimension_array(const Expr& expr, const Allocator& alloc = Allocator())
+         : storage(alloc)
+      {
+         assign(expr);
+      }
+
+      /// @brief Construct count elements whose values are left uninitialized
+      /// @details Intended for bulk loads which overwrite every element through data()
+      [[nodiscard]] static dimension_array uninitialized(size_type count, const Allocator& alloc = Allocator())
+      {
+         dimension_array result(alloc);
+         result.resize_uninitialized(count);
+         return result;
+      }
+
+      [[nodiscard]] allocator_type get_allocator() const noexcept { return static_cast<allocator_type>(storage.get_allocator()); }
+
+      // ---------------- Capacity ----------------
+
+      [[nodiscard]] size_type size() const noexcept { return storage.size(); }
+      [[nodiscard]] bool empty() const noexcept { return storage.empty(); }
+      [[nodiscard]] size_type capacity() const noexcept { return storage.capacity(); }
+
+      void reserve(size_type count) { storage.reserve(count); }
+      void shrink_to_fit() { storage.shrink_to_fit(); }
+      void clear() noexcept { storage.clear(); }
+
+      /// @brief Resize the array, new elements are zero-valued
+      void resize(size_type count) { storage.resize(count, rep{0}); }
+
+      /// @brief Resize the array, new elements are copies of value
+      void resize(size_type count, const Dim& value) { storage.resize(count, to_raw(value)); }
+
+      /// @brief Resize the array, new elements are left uninitialized
+      /// @details Skips the zero-fill performed by resize. Every new element must be written before it is read.
+      void resize_uninitialized(size_type count) { storage.resize(count); }
+
+      // ---------------- Element access ----------------
+
+      [[nodiscard]] Dim operator[](size_type index) const { return Dim(storage[index]); }
+
+      [[nodiscard]] Dim at(size_type index) const
+      {
+         if (index >= storage.size())
+         {
+            throw std::out_of_range("dimension_array index out of range");
+         }
+         return Dim(storage[index]);
+      }
+
+      [[nodiscard]] Dim front() const { return Dim(storage.front()); }
+      [[nodiscard]] Dim back() const { return Dim(storage.back()); }
+
+      /// @brief Set the element at index, converting value to this array's units if needed
+      void set(size_type index, const Dim& value) { storage[index] = to_raw(value); }
+
+      /// @brief Replace the contents with the evaluated expression, converted to this array's units
+      /// @details The expression may reference this array, every element is read before it is written.
+      template<is_array_expression Expr>
+      requires matching_dimensions<typename Expr::dimension_type, Dim>
+      void assign(const Expr& expr)
+      {
+         resize_uninitialized(expr.size());
+         evaluate<Dim>(expr, values());
+      }
+
+      template<is_array_expression Expr>
+      requires matching_dimensions<typename Expr::dimension_type, Dim>
+      dimension_array& operator=(const Expr& expr)
+      {
+         assign(expr);
+         return *this;
+      }
+
+      void push_back(const Dim& value) { storage.push_back(to_raw(value)); }
+      void pop_back() { storage.pop_back(); }
+
+      /// @brief Pointer to the raw contiguous Rep buffer
+      [[nodiscard]] rep* data() noexcept { return storage.data(); }
+      [[nodiscard]] const rep* data() const noexcept { return storage.data(); }
+
+      /// @brief View of the raw contiguous Rep buffer, expressed in this array's units
+      [[nodiscard]] std::span<rep> values() noexcept { return std::span<rep>(storage.data(), storage.size()); }
+      [[nodiscard]] std::span<const rep> values() const noexcept { return std::span<const rep>(storage.data(), storage.size()); }
+
+      // ---------------- Iteration ----------------
+
+      [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(storage.data()); }
+      [[nodiscard]] const_iterator end() const noexcept { return const_iterator(storage.data() + storage.size()); }
+      [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+      [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+      // ---------------- Conversion ----------------
+
+      /// @brief Convert the whole array to another dimension type in one pass
+      /// @details The conversion factor is resolved at compile time, then applied to every element.
+      ///    When the units already match, the values are copied without any arithmetic.
+      ///    An integral Target rounds toward zero, as dimension_cast does by default.
+      /// @tparam Target The dimension type to convert to, must match the dimension of Dim
+      /// @return A new array of Target, sharing this array's allocator
+      template<is_base_dimension Target>
+      requires matching_dimensions<Dim, Target>
+      [[nodiscard]] auto as() const
+      {
+         using target_rep = typename Target::rep;
+         using target_alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<target_rep>;
+
+         dimension_array<Target, target_alloc> result = dimension_array<Target, target_alloc>::uninitialized(size(), target_alloc(get_allocator()));
+
+         if constexpr (std::is_same_v<Target, Dim> || (same_units<units, typename Target::units> &&
+                       std::is_same_v<typename Dim::ratio, typename Target::ratio> &&
+                       std::is_same_v<typename Dim::symbols, typename Target::symbols>))
+         {
+            std::copy(storage.begin(), storage.end(), result.data());
+         }
+         else if constexpr (std::is_integral_v<target_rep>)
+         {
+            // The factor cannot be held in an integral Rep, so each element is converted as dimension_cast does
+            target_rep* out = result.data();
+            for (size_type i = 0; i < storage.size(); ++i)
+            {
+               out[i] = convert_raw<Target, rounding::toward_zero, overflow::unchecked, Dim>(storage[i]);
+            }
+         }
+         else
+         {
+            constexpr target_rep factor = static_cast<target_rep>(
+               coefficient_factor_v<Dim> * conversion_factor_v<units, typename Target::units> / coefficient_factor_v<Target>);
+
+            if constexpr (std::is_same_v<target_rep, rep>)
+            {
+               kernels::scale<rep>(storage.data(), result.data(), storage.size(), factor);
+            }
+            else
+            {
+               target_rep* out = result.data();
+               for (size_type i = 0; i < storage.size(); ++i)
+               {
+                  out[i] = static_cast<target_rep>(storage[i]) * factor;
+               }
+            }
+         }
+
+         return result;
+      }
+
+      /// @brief Convert the whole array to the given units in one pass
+      /// @tparam Units The unit_exponents to convert to, such as unit_exponent<meters>
+      /// @return A new array of base_dimension in the given units, sharing this array's allocator
+      template<are_unit_exponents... Units>
+      requires (sizeof...(Units) > 0)
+      [[nodiscard]] auto as() const
+      {
+         return as<base_dimension<rep, Units...>>();
+      }
+
+   private:
+      storage_type storage;
+   };
+
+   namespace pmr
+   {
+      /// @brief dimension_array using a polymorphic memory resource
+      template<is_base_dimension Dim>
+      using dimension_array = dimension::dimension_array<Dim, std::pmr::polymorphic_allocator<typename Dim::rep>>;
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_DIMENSION_ARRAY_H
@@ -0,0 +1,440 @@
+#ifndef DIMENSION_DIMENSION_MATRIX_H
+#define DIMENSION_DIMENSION_MATRIX_H
+
+#include <algorithm> // For std::min, std::swap_ranges
+#include <array>
+#include <cmath> // For std::abs
+#include <cstddef> // For std::size_t
+#include <stdexcept> // For std::invalid_argument
+#include <tuple>
+#include <type_traits>
+#include <utility> // For std::index_sequence
+
+#include "Coefficient.h"
+#include "UnitSimplifier.h"
+#include "Vec.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   namespace matrix_detail
+   {
+      template<typename T>
+      struct is_dimension_tuple : std::false_type {};
+
+      template<is_base_dimension... Dims>
+      struct is_dimension_tuple<std::tuple<Dims...>> : std::bool_constant<(sizeof...(Dims) > 0)> {};
+
+      template<typename Dims>
+      struct inverse;
+
+      template<typename... Dims>
+      struct inverse<std::tuple<Dims...>>
+      {
+         using type = std::tuple<vec_detail::quotient_t<base_dimension_impl<typename Dims::rep>, Dims>...>;
+      };
+
+      template<typename Rows, typename Cols>
+      struct common_rep;
+
+      template<typename... Rows, typename... Cols>
+      struct common_rep<std::tuple<Rows...>, std::tuple<Cols...>>
+      {
+         using type = std::common_type_t<typename Rows::rep..., typename Cols::rep...>;
+      };
+
+      /// @brief Rows of the product, each row of Lhs scaled by the dimension shared by every inner term
+      template<typename LhsRows, typename Scale>
+      struct scaled_rows;
+
+      template<typename... Rows, typename Scale>
+      struct scaled_rows<std::tuple<Rows...>, Scale>
+      {
+         using type = std::tuple<vec_detail::product_t<Rows, Scale>...>;
+      };
+
+      /// @brief Tile edge of the multiplication and transpose kernels, 32 doubles of each of three
+      ///    tiles fit comfortably in L1
+      inline constexpr std::size_t block_size = 32;
+   }
+
+   /// @brief A non-empty std::tuple of dimension types, giving the units of each row or column of a matrix
+   template<typename T>
+   concept dimension_tuple = matrix_detail::is_dimension_tuple<T>::value;
+
+   /// @brief The reciprocal of each dimension in Dims, such as std::tuple<frequency, ...> for std::tuple<timespan, ...>
+   template<dimension_tuple Dims>
+   using inverse_dimensions_t = typename matrix_detail::inverse<Dims>::type;
+
+   /// @brief Matrix whose element (i, j) has the dimension of the product of row dimension i and column dimension j
+   /// @details Any matrix relating physical quantities takes this form. A covariance of a state
+   ///    [position, velocity] uses the state as both rows and columns, and the transition matrix of
+   ///    that state uses the state as rows and its inverse as columns.
+   ///    Elements are stored row-major as one contiguous array of raw Rep values in the units of
+   ///    their own dimension. Because a product of dimensions multiplies raw values, the physical
+   ///    matrix is the raw matrix scaled by one factor per row and one per column, so multiplication,
+   ///    transposition and inversion run on raw values with at most one compile-time factor per term.
+   /// @tparam Rows std::tuple of the row dimensions
+   /// @tparam Cols std::tuple of the column dimensions
+   template<dimension_tuple Rows, dimension_tuple Cols>
+   class dimension_matrix
+   {
+   public:
+      using row_dimensions = Rows;
+      using column_dimensions = Cols;
+      using rep = typename matrix_detail::common_rep<Rows, Cols>::type;
+
+      static constexpr std::size_t rows = std::tuple_size_v<Rows>;
+      static constexpr std::size_t cols = std::tuple_size_v<Cols>;
+
+      using raw_type = std::array<rep, rows * cols>;
+
+      /// @brief Dimension of element (I, J)
+      template<std::size_t I, std::size_t J>
+      using element_type = vec_detail::product_t<std::tuple_element_t<I, Rows>, std::tuple_element_t<J, Cols>>;
+
+      /// @brief Zero matrix
+      constexpr dimension_matrix() noexcept = default;
+
+      /// @brief Convert from a matrix of the same shape whose elements match in dimension, each converted to the units of this matrix
+      template<typename OtherRows, typename OtherCols>
+      requires (!std::is_same_v<dimension_matrix, dimension_matrix<OtherRows, OtherCols>> &&
+                dimension_matrix<OtherRows, OtherCols>::rows == rows &&
+                dimension_matrix<OtherRows, OtherCols>::cols == cols &&
+                dimension_matrix<OtherRows, OtherCols>::template elements_match<Rows, Cols>())
+      // Implicit conversion between matching units mirrors base_dimension
+      // cppcheck-suppress noExplicitConstructor
+      constexpr dimension_matrix(const dimension_matrix<OtherRows, OtherCols>& other)
+      {
+         constexpr raw_type factors = factors_from<dimension_matrix<OtherRows, OtherCols>>();
+         for (std::size_t i = 0; i < rows * cols; ++i)
+         {
+            elements[i] = static_cast<rep>(other.raw()[i]) * factors[i];
+         }
+      }
+
+      /// @brief Construct from row-major raw values already expressed in the units of each element
+      [[nodiscard]] static constexpr dimension_matrix from_raw(const raw_type& values) noexcept
+      {
+         dimension_matrix result;
+         result.elements = values;
+         return result;
+      }
+
+      /// @brief Identity matrix, for a square matrix whose diagonal is dimensionless, such as a transition matrix
+      [[nodiscard]] static constexpr dimension_matrix identity() noexcept
+      requires (rows == cols)
+      {
+         return []<std::size_t... Is>(std::index_sequence<Is...>)
+         {
+            static_assert((matching_dimensions<element_type<Is, Is>, base_dimension_impl<rep>> && ...),
+                          "identity requires a dimensionless diagonal");
+
+            dimension_matrix result;
+            ((result.elements[Is * cols + Is] = static_cast<rep>(vec_detail::raw_factor_v<base_dimension_impl<rep>, element_type<Is, Is>>)), ...);
+            return result;
+         }(std::make_index_sequence<rows>{});
+      }
+
+      template<std::size_t I, std::size_t J>
+      requires (I < rows && J < cols)
+      [[nodiscard]] constexpr element_type<I, J> get() const
+      {
+         return element_type<I, J>(elements[I * cols + J]);
+      }
+
+      /// @brief Set element (I, J), converting value to the units of the element
+      template<std::size_t I, std::size_t J, is_base_dimension Other>
+      requires (I < rows && J < cols && matching_dimensions<element_type<I, J>, Other>)
+      constexpr void set(const Other& value)
+      {
+         elements[I * cols + J] = static_cast<rep>(value.template get_tuple_scalar<typename Other::units>() *
+                                                   vec_detail::raw_factor_v<Other, element_type<I, J>>);
+      }
+
+      /// @brief Raw elements in row-major order, each expressed in the units of its element
+      [[nodiscard]] constexpr const raw_type& raw() const noexcept { return elements; }
+
+      /// @brief Raw value of element (row, col)
+      [[nodiscard]] constexpr rep raw(std::size_t row, std::size_t col) const { return elements[row * cols + col]; }
+
+      /// @brief Whether every element matches the dimension of the corresponding element of a matrix with these rows and columns
+      template<typename OtherRows, typename OtherCols>
+      [[nodiscard]] static consteval bool elements_match()
+      {
+         using other = dimension_matrix<OtherRows, OtherCols>;
+         if constexpr (other::rows != rows || other::cols != cols)
+         {
+            return false;
+         }
+         else
+         {
+            return []<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+               return (matching_dimensions<element_type<Is / cols, Is % cols>,
+                                           typename other::template element_type<Is / cols, Is % cols>> && ...);
+            }(std::make_index_sequence<rows * cols>{});
+         }
+      }
+
+      template<typename OtherRows, typename OtherCols>
+      requires (elements_match<OtherRows, OtherCols>())
+      constexpr dimension_matrix& operator+=(const dimension_matrix<OtherRows, OtherCols>& rhs)
+      {
+         constexpr raw_type factors = factors_from<dimension_matrix<OtherRows, OtherCols>>();
+         for (std::size_t i = 0; i < rows * cols; ++i) { elements[i] += static_cast<rep>(rhs.raw()[i]) * factors[i]; }
+         return *this;
+      }
+
+      template<typename OtherRows, typename OtherCols>
+      requires (elements_match<OtherRows, OtherCols>())
+      constexpr dimension_matrix& operator-=(const dimension_matrix<OtherRows, OtherCols>& rhs)
+      {
+         constexpr raw_type factors = factors_from<dimension_matrix<OtherRows, OtherCols>>();
+         for (std::size_t i = 0; i < rows * cols; ++i) { elements[i] -= static_cast<rep>(rhs.raw()[i]) * factors[i]; }
+         return *this;
+      }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      constexpr dimension_matrix& operator*=(Scalar scalar)
+      {
+         for (auto& element : elements) { element *= static_cast<rep>(scalar); }
+         return *this;
+      }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      constexpr dimension_matrix& operator/=(Scalar scalar)
+      {
+         for (auto& element : elements) { element /= static_cast<rep>(scalar); }
+         return *this;
+      }
+
+      constexpr dimension_matrix operator-() const
+      {
+         dimension_matrix result;
+         for (std::size_t i = 0; i < rows * cols; ++i) { result.elements[i] = -elements[i]; }
+         return result;
+      }
+
+      /// @brief Sum in the units of lhs
+      template<typename OtherRows, typename OtherCols>
+      requires (elements_match<OtherRows, OtherCols>())
+      friend constexpr dimension_matrix operator+(dimension_matrix lhs, const dimension_matrix<OtherRows, OtherCols>& rhs) { return lhs += rhs; }
+
+      /// @brief Difference in the units of lhs
+      template<typename OtherRows, typename OtherCols>
+      requires (elements_match<OtherRows, OtherCols>())
+      friend constexpr dimension_matrix operator-(dimension_matrix lhs, const dimension_matrix<OtherRows, OtherCols>& rhs) { return lhs -= rhs; }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      friend constexpr dimension_matrix operator*(dimension_matrix lhs, Scalar scalar) { return lhs *= scalar; }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      friend constexpr dimension_matrix operator*(Scalar scalar, dimension_matrix rhs) { return rhs *= scalar; }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      friend constexpr dimension_matrix operator/(dimension_matrix lhs, Scalar scalar) { return lhs /= scalar; }
+
+      friend constexpr bool operator==(const dimension_matrix& lhs, const dimension_matrix& rhs) { return lhs.elements == rhs.elements; }
+
+   private:
+      /// @brief Factor taking each raw element of Other to the units of the same element of this matrix
+      template<typename Other>
+      static constexpr raw_type factors_from()
+      {
+         return []<std::size_t... Is>(std::index_sequence<Is...>)
+         {
+            return raw_type{static_cast<rep>(vec_detail::raw_factor_v<typename Other::template element_type<Is / cols, Is % cols>,
+                                                                      element_type<Is / cols, Is % cols>>)...};
+         }(std::make_index_sequence<rows * cols>{});
+      }
+
+      raw_type elements{};
+   };
+
+   /// @brief A column of dimensions, such as the state of an estimator
+   template<is_base_dimension... Dims>
+   using column_vector = dimension_matrix<std::tuple<Dims...>, std::tuple<base_dimension_impl<std::common_type_t<typename Dims::rep...>>>>;
+
+   namespace matrix_detail
+   {
+      /// @brief Dimension every inner term of Lhs * Rhs shares, void if the inner dimensions do not line up
+      template<typename Lhs, typename Rhs>
+      struct inner_dimension
+      {
+         static_assert(Lhs::cols == Rhs::rows, "Matrix product requires the columns of lhs to match the rows of rhs");
+
+         using first = vec_detail::product_t<std::tuple_element_t<0, typename Lhs::column_dimensions>,
+                                             std::tuple_element_t<0, typename Rhs::row_dimensions>>;
+
+         static constexpr bool consistent = []<std::size_t... Ks>(std::index_sequence<Ks...>)
+         {
+            return (matching_dimensions<first,
+                                        vec_detail::product_t<std::tuple_element_t<Ks, typename Lhs::column_dimensions>,
+                                                              std::tuple_element_t<Ks, typename Rhs::row_dimensions>>> && ...);
+         }(std::make_index_sequence<Lhs::cols>{});
+
+         /// @brief Factor taking inner term k to the units of the first term
+         template<typename Rep>
+         static constexpr std::array<Rep, Lhs::cols> factors()
+         {
+            return []<std::size_t... Ks>(std::index_sequence<Ks...>)
+            {
+               return std::array<Rep, Lhs::cols>{static_cast<Rep>(vec_detail::raw_factor_v<
+                  vec_detail::product_t<std::tuple_element_t<Ks, typename Lhs::column_dimensions>,
+                                        std::tuple_element_t<Ks, typename Rhs::row_dimensions>>,
+                  first>)...};
+            }(std::make_index_sequence<Lhs::cols>{});
+         }
+      };
+
+      template<typename Lhs, typename Rhs>
+      using product_matrix_t = dimension_matrix<typename scaled_rows<typename Lhs::row_dimensions, typename inner_dimension<Lhs, Rhs>::first>::type,
+                                                typename Rhs::column_dimensions>;
+   }
+
+   /// @brief Matrix product, checking at compile time that every inner term shares one dimension
+   /// @details Row i of the result takes the dimension of row i of lhs times that shared dimension,
+   ///    and the columns are those of rhs. Terms in other units of the shared dimension are scaled
+   ///    by one compile-time factor per inner index, folded into the element of lhs.
+   ///    The kernel walks i-k-j in tiles of matrix_detail::block_size so the innermost loop streams
+   ///    contiguous rows of rhs and the result.
+   template<typename LhsRows, typename LhsCols, typename RhsRows, typename RhsCols>
+   requires (matrix_detail::inner_dimension<dimension_matrix<LhsRows, LhsCols>, dimension_matrix<RhsRows, RhsCols>>::consistent)
+   [[nodiscard]] constexpr auto operator*(const dimension_matrix<LhsRows, LhsCols>& lhs, const dimension_matrix<RhsRows, RhsCols>& rhs)
+   {
+      using lhs_type = dimension_matrix<LhsRows, LhsCols>;
+      using rhs_type = dimension_matrix<RhsRows, RhsCols>;
+      using result_type = matrix_detail::product_matrix_t<lhs_type, rhs_type>;
+      using rep = typename result_type::rep;
+      using matrix_detail::block_size;
+
+      constexpr std::size_t m = lhs_type::rows;
+      constexpr std::size_t n = lhs_type::cols;
+      constexpr std::size_t p = rhs_type::cols;
+      constexpr auto factors = matrix_detail::inner_dimension<lhs_type, rhs_type>::template factors<rep>();
+
+      const auto& a = lhs.raw();
+      const auto& b = rhs.raw();
+      typename result_type::raw_type c{};
+
+      for (std::size_t i0 = 0; i0 < m; i0 += block_size)
+      {
+         const std::size_t i1 = std::min(i0 + block_size, m);
+         for (std::size_t k0 = 0; k0 < n; k0 += block_size)
+         {
+            const std::size_t k1 = std::min(k0 + block_size, n);
+            for (std::size_t j0 = 0; j0 < p; j0 += block_size)
+            {
+               const std::size_t j1 = std::min(j0 + block_size, p);
+               for (std::size_t i = i0; i < i1; ++i)
+               {
+                  for (std::size_t k = k0; k < k1; ++k)
+                  {
+                     const rep scale = static_cast<rep>(a[i * n + k]) * factors[k];
+                     for (std::size_t j = j0; j < j1; ++j)
+                     {
+                        c[i * p + j] += scale * static_cast<rep>(b[k * p + j]);
+                     }
+                  }
+               }
+            }
+         }
+      }
+      return result_type::from_raw(c);
+   }
+
+   /// @brief Transpose, element (j, i) of the result is element (i, j) of value in the same units
+   template<typename Rows, typename Cols>
+   [[nodiscard]] constexpr dimension_matrix<Cols, Rows> transpose(const dimension_matrix<Rows, Cols>& value)
+   {
+      using matrix_detail::block_size;
+      using source_type = dimension_matrix<Rows, Cols>;
+      constexpr std::size_t m = source_type::rows;
+      constexpr std::size_t n = source_type::cols;
+
+      const auto& a = value.raw();
+      typename dimension_matrix<Cols, Rows>::raw_type t;
+      for (std::size_t i0 = 0; i0 < m; i0 += block_size)
+      {
+         for (std::size_t j0 = 0; j0 < n; j0 += block_size)
+         {
+            for (std::size_t i = i0; i < std::min(i0 + block_size, m); ++i)
+            {
+               for (std::size_t j = j0; j < std::min(j0 + block_size, n); ++j)
+               {
+                  t[j * m + i] = a[i * n + j];
+               }
+            }
+         }
+      }
+      return dimension_matrix<Cols, Rows>::from_raw(t);
+   }
+
+   /// @brief Inverse of a square matrix, with rows of the inverse of its columns and columns of the inverse of its rows
+   /// @details The inverse of the physical matrix is the inverse of the raw matrix, scaled by the
+   ///    reciprocal row and column factors, which are exactly the factors of the inverted dimensions.
+   ///    The raw matrix is inverted by Gauss-Jordan elimination with partial pivoting.
+   /// @throws std::invalid_argument if the matrix is singular
+   template<typename Rows, typename Cols>
+   requires (std::tuple_size_v<Rows> == std::tuple_size_v<Cols>)
+   [[nodiscard]] constexpr auto inverse(const dimension_matrix<Rows, Cols>& value)
+   {
+      using result_type = dimension_matrix<inverse_dimensions_t<Cols>, inverse_dimensions_t<Rows>>;
+      using rep = typename result_type::rep;
+      constexpr std::size_t n = result_type::rows;
+
+      typename result_type::raw_type a;
+      for (std::size_t i = 0; i < n * n; ++i) { a[i] = static_cast<rep>(value.raw()[i]); }
+      typename result_type::raw_type inv{};
+      for (std::size_t i = 0; i < n; ++i) { inv[i * n + i] = rep{1}; }
+
+      for (std::size_t col = 0; col < n; ++col)
+      {
+         std::size_t pivot = col;
+         for (std::size_t row = col + 1; row < n; ++row)
+         {
+            if (std::abs(a[row * n + col]) > std::abs(a[pivot * n + col])) { pivot = row; }
+         }
+         if (a[pivot * n + col] == rep{0})
+         {
+            throw std::invalid_argument("Cannot invert a singular dimension_matrix");
+         }
+         if (pivot != col)
+         {
+            std::swap_ranges(a.begin() + static_cast<std::ptrdiff_t>(pivot * n), a.begin() + static_cast<std::ptrdiff_t>((pivot + 1) * n),
+                             a.begin() + static_cast<std::ptrdiff_t>(col * n));
+            std::swap_ranges(inv.begin() + static_cast<std::ptrdiff_t>(pivot * n), inv.begin() + static_cast<std::ptrdiff_t>((pivot + 1) * n),
+                             inv.begin() + static_cast<std::ptrdiff_t>(col * n));
+         }
+
+         const rep scale = rep{1} / a[col * n + col];
+         for (std::size_t j = 0; j < n; ++j)
+         {
+            a[col * n + j] *= scale;
+            inv[col * n + j] *= scale;
+         }
+
+         for (std::size_t row = 0; row < n; ++row)
+         {
+            const rep factor = a[row * n + col];
+            if (row == col || factor == rep{0}) { continue; }
+            for (std::size_t j = 0; j < n; ++j)
+            {
+               a[row * n + j] -= factor * a[col * n + j];
+               inv[row * n + j] -= factor * inv[col * n + j];
+            }
+         }
+      }
+      return result_type::from_raw(inv);
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_DIMENSION_MATRIX_H
@@ -0,0 +1,385 @@
+#ifndef DIMENSION_DYNAMIC_QUANTITY_H
+#define DIMENSION_DYNAMIC_QUANTITY_H
+
+#include <array>
+#include <cmath> // For std::sqrt
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::int8_t, std::uint64_t
+#include <numeric> // For std::gcd
+#include <stdexcept> // For std::invalid_argument, std::out_of_range
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "Coefficient.h"
+#include "FundamentalUnitExtractor.h"
+#include "PrecisionType.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief Names of the fundamental dimensions, in the order of metadata/FundamentalUnits.json
+   /// @details The index of a name is its slot in a dimension_signature.
+   inline constexpr std::array<std::string_view, 7> fundamental_dimensions{
+      "length", "mass", "amount", "angle", "charge", "timespan", "temperature"
+   };
+
+   /// @brief Slot of a fundamental dimension, or fundamental_dimensions.size() for an unknown name
+   constexpr std::size_t fundamental_index(std::string_view name) noexcept
+   {
+      std::size_t index = 0;
+      while (index < fundamental_dimensions.size() && fundamental_dimensions[index] != name)
+      {
+         ++index;
+      }
+      return index;
+   }
+
+   /// @brief Exponents of the fundamental dimensions, packed into one 64-bit word
+   /// @details Each slot is a signed byte counting the exponent in steps of 1/denominator, so
+   ///    exponents are rationals with denominators of 1, 2, 3 or 6 between -127/6 and 127/6.
+   ///    Equality is one integer compare, and multiplication and division of quantities add and
+   ///    subtract all slots at once with byte-wise arithmetic on the word.
+   class dimension_signature
+   {
+   public:
+      static constexpr std::size_t slots = 8;
+      static constexpr int denominator = 6;
+
+      /// @brief The signature of a dimensionless quantity
+      constexpr dimension_signature() noexcept = default;
+
+      /// @brief Signature with a single exponent of num / den in slot
+      /// @throws std::invalid_argument if the slot does not exist or num / den is not a multiple of 1/denominator
+      /// @throws std::out_of_range if the exponent does not fit in a slot
+      static constexpr dimension_signature of(std::size_t slot, int num, int den = 1)
+      {
+         if (slot >= slots || den == 0 || (num * denominator) % den != 0)
+         {
+            throw std::invalid_argument("Exponent is not representable in a dimension_signature");
+         }
+
+         const int steps = num * denominator / den;
+         if (steps < -128 || steps > 127)
+         {
+            throw std::out_of_range("Exponent is outside the range of a dimension_signature");
+         }
+
+         return from_packed(static_cast<std::uint64_t>(static_cast<std::uint8_t>(steps)) << (8 * slot));
+      }
+
+      /// @brief Signature with a single exponent of num / den for a fundamental dimension, by name
+      /// @throws std::invalid_argument if the name is not a fundamental dimension
+      static constexpr dimension_signature of(std::string_view name, int num, int den = 1)
+      {
+         const std::size_t slot = fundamental_index(name);
+         if (slot == fundamental_dimensions.size())
+         {
+            throw std::invalid_argument("Unknown fundamental dimension");
+         }
+         return of(slot, num, den);
+      }
+
+      [[nodiscard]] static constexpr dimension_signature from_packed(std::uint64_t packed) noexcept
+      {
+         dimension_signature result;
+         result.bits = packed;
+         return result;
+      }
+
+      [[nodiscard]] constexpr std::uint64_t packed() const noexcept { return bits; }
+
+      [[nodiscard]] constexpr bool dimensionless() const noexcept { return bits == 0; }
+
+      /// @brief Exponent of a slot in steps of 1/denominator
+      [[nodiscard]] constexpr int steps(std::size_t slot) const noexcept
+      {
+         return static_cast<std::int8_t>(static_cast<std::uint8_t>(bits >> (8 * slot)));
+      }
+
+      /// @brief Numerator of the exponent of a slot in lowest terms
+      [[nodiscard]] constexpr int numerator(std::size_t slot) const noexcept
+      {
+         return steps(slot) / std::gcd(steps(slot), denominator);
+      }
+
+      /// @brief Denominator of the exponent of a slot in lowest terms
+      [[nodiscard]] constexpr int exponent_denominator(std::size_t slot) const noexcept
+      {
+         return denominator / std::gcd(steps(slot), denominator);
+      }
+
+      /// @brief Signature of a product
+      /// @throws std::out_of_range if an exponent leaves the range of a slot
+      friend constexpr dimension_signature operator+(dimension_signature lhs, dimension_signature rhs)
+      {
+         const std::uint64_t a = lhs.bits;
+         const std::uint64_t b = rhs.bits;
+         const std::uint64_t sum = ((a & ~high_bits) + (b & ~high_bits)) ^ ((a ^ b) & high_bits);
+
+         // A slot overflows when both operands have the same sign and the sum does not
+         if ((~(a ^ b) & (a ^ sum) & high_bits) != 0)
+         {
+            throw std::out_of_range("Exponent is outside the range of a dimension_signature");
+         }
+         return from_packed(sum);
+      }
+
+      /// @brief Signature of a quotient
+      /// @throws std::out_of_range if an exponent leaves the range of a slot
+      friend constexpr dimension_signature operator-(dimension_signature lhs, dimension_signature rhs)
+      {
+         const std::uint64_t a = lhs.bits;
+         const std::uint64_t b = rhs.bits;
+         const std::uint64_t difference = ((a | high_bits) - (b & ~high_bits)) ^ ((a ^ ~b) & high_bits);
+
+         // A slot overflows when the operands have different signs and the difference has the sign of b
+         if (((a ^ b) & (a ^ difference) & high_bits) != 0)
+         {
+            throw std::out_of_range("Exponent is outside the range of a dimension_signature");
+         }
+         return from_packed(difference);
+      }
+
+      /// @brief Signature of a reciprocal
+      friend constexpr dimension_signature operator-(dimension_signature rhs) { return dimension_signature{} - rhs; }
+
+      /// @brief Signature raised to num / den
+      /// @throws std::invalid_argument if an exponent is no longer a multiple of 1/denominator
+      /// @throws std::out_of_range if an exponent leaves the range of a slot
+      [[nodiscard]] constexpr dimension_signature power(int num, int den = 1) const
+      {
+         if (den == 0)
+         {
+            throw std::invalid_argument("Exponent denominator must not be zero");
+         }
+
+         std::uint64_t result = 0;
+         for (std::size_t slot = 0; slot < slots; ++slot)
+         {
+            const int scaled = steps(slot) * num;
+            if (scaled % den != 0)
+            {
+               throw std::invalid_argument("Exponent is not representable in a dimension_signature");
+            }
+            if (scaled / den < -128 || scaled / den > 127)
+            {
+               throw std::out_of_range("Exponent is outside the range of a dimension_signature");
+            }
+            result |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(scaled / den)) << (8 * slot);
+         }
+         return from_packed(result);
+      }
+
+      friend constexpr bool operator==(dimension_signature lhs, dimension_signature rhs) noexcept = default;
+
+   private:
+      static constexpr std::uint64_t high_bits = 0x8080808080808080u;
+
+      std::uint64_t bits = 0;
+   };
+
+   namespace dynamic_detail
+   {
+      template<typename Units>
+      struct primary_units;
+
+      template<typename... Units>
+      struct primary_units<std::tuple<Units...>>
+      {
+         using type = std::tuple<unit_exponent<typename Units::unit::Primary, Units::exponent::num, Units::exponent::den>...>;
+      };
+
+      template<typename Units>
+      struct signature_of;
+
+      template<typename... Units>
+      struct signature_of<std::tuple<Units...>>
+      {
+         static constexpr dimension_signature value = []
+         {
+            static_assert(((Units::exponent::num * dimension_signature::denominator % Units::exponent::den == 0) && ...),
+                          "Exponent is not representable in a dimension_signature");
+            static_assert(((fundamental_index(std::string_view(Units::unit::dimName.value.data())) < fundamental_dimensions.size()) && ...),
+                          "Unit does not belong to a fundamental dimension");
+
+            dimension_signature result;
+            ((result = result + dimension_signature::of(fundamental_index(std::string_view(Units::unit::dimName.value.data())),
+                                                        static_cast<int>(Units::exponent::num),
+                                                        static_cast<int>(Units::exponent::den))), ...);
+            return result;
+         }();
+      };
+
+      template<typename Dim>
+      using fundamental_units_t = typename FundamentalUnitExtractor<typename Dim::units>::units;
+   }
+
+   /// @brief Signature of the fundamental dimensions of a static dimension type
+   template<is_base_dimension Dim>
+   inline constexpr dimension_signature dimension_signature_v = dynamic_detail::signature_of<dynamic_detail::fundamental_units_t<Dim>>::value;
+
+   /// @brief Factor taking a raw value of a static dimension type to its primary units, coefficients included
+   template<is_base_dimension Dim>
+   inline constexpr PrecisionType primary_scale_v = coefficient_factor_v<Dim>
+      * conversion_factor_v<typename Dim::units, typename dynamic_detail::primary_units<dynamic_detail::fundamental_units_t<Dim>>::type>;
+
+   /// @brief A quantity whose dimension is only known at runtime
+   /// @details Holds a value, the factor taking it to the primary units of its dimensions, and the
+   ///    signature of those dimensions. Addition and comparison check the signatures at runtime,
+   ///    multiplication and division combine them. quantity_cast checks once and returns a static type.
+   class dynamic_quantity
+   {
+   public:
+      /// @brief A dimensionless zero
+      constexpr dynamic_quantity() noexcept = default;
+
+      /// @brief value in units that are scale times the primary units of signature
+      constexpr dynamic_quantity(PrecisionType value, PrecisionType scale, dimension_signature signature) noexcept
+         : val(value), factor(scale), sig(signature)
+      {
+      }
+
+      /// @brief A static dimension, keeping its units as the scale
+      template<is_base_dimension Dim>
+      explicit constexpr dynamic_quantity(const Dim& value)
+         : val(static_cast<PrecisionType>(value.template get_tuple_scalar<typename Dim::units>())),
+           factor(primary_scale_v<Dim>),
+           sig(dimension_signature_v<Dim>)
+      {
+      }
+
+      [[nodiscard]] constexpr PrecisionType value() const noexcept { return val; }
+      [[nodiscard]] constexpr PrecisionType scale() const noexcept { return factor; }
+      [[nodiscard]] constexpr dimension_signature signature() const noexcept { return sig; }
+
+      /// @brief The value in the primary units of the dimensions
+      [[nodiscard]] constexpr PrecisionType primary_value() const noexcept { return val * factor; }
+
+      /// @brief Add a quantity of the same dimensions, in the units of this one
+      /// @throws std::invalid_argument if the dimensions differ
+      constexpr dynamic_quantity& operator+=(const dynamic_quantity& rhs)
+      {
+         val += converted(rhs);
+         return *this;
+      }
+
+      /// @brief Subtract a quantity of the same dimensions, in the units of this one
+      /// @throws std::invalid_argument if the dimensions differ
+      constexpr dynamic_quantity& operator-=(const dynamic_quantity& rhs)
+      {
+         val -= converted(rhs);
+         return *this;
+      }
+
+      constexpr dynamic_quantity& operator*=(const dynamic_quantity& rhs)
+      {
+         sig = sig + rhs.sig;
+         val *= rhs.val;
+         factor *= rhs.factor;
+         return *this;
+      }
+
+      constexpr dynamic_quantity& operator/=(const dynamic_quantity& rhs)
+      {
+         sig = sig - rhs.sig;
+         val /= rhs.val;
+         factor /= rhs.factor;
+         return *this;
+      }
+
+      constexpr dynamic_quantity& operator*=(PrecisionType scalar) noexcept
+      {
+         val *= scalar;
+         return *this;
+      }
+
+      constexpr dynamic_quantity& operator/=(PrecisionType scalar) noexcept
+      {
+         val /= scalar;
+         return *this;
+      }
+
+      friend constexpr dynamic_quantity operator+(dynamic_quantity lhs, const dynamic_quantity& rhs) { return lhs += rhs; }
+      friend constexpr dynamic_quantity operator-(dynamic_quantity lhs, const dynamic_quantity& rhs) { return lhs -= rhs; }
+      friend constexpr dynamic_quantity operator*(dynamic_quantity lhs, const dynamic_quantity& rhs) { return lhs *= rhs; }
+      friend constexpr dynamic_quantity operator/(dynamic_quantity lhs, const dynamic_quantity& rhs) { return lhs /= rhs; }
+      friend constexpr dynamic_quantity operator*(dynamic_quantity lhs, PrecisionType rhs) noexcept { return lhs *= rhs; }
+      friend constexpr dynamic_quantity operator*(PrecisionType lhs, dynamic_quantity rhs) noexcept { return rhs *= lhs; }
+      friend constexpr dynamic_quantity operator/(dynamic_quantity lhs, PrecisionType rhs) noexcept { return lhs /= rhs; }
+      friend constexpr dynamic_quantity operator-(dynamic_quantity rhs) noexcept { return dynamic_quantity(-rhs.val, rhs.factor, rhs.sig); }
+
+      /// @brief Equality of dimensions and of the values in primary units
+      friend constexpr bool operator==(const dynamic_quantity& lhs, const dynamic_quantity& rhs) noexcept
+      {
+         return lhs.sig == rhs.sig && lhs.primary_value() == rhs.primary_value();
+      }
+
+      /// @brief Ordering of the values in primary units
+      /// @throws std::invalid_argument if the dimensions differ
+      friend constexpr bool operator<(const dynamic_quantity& lhs, const dynamic_quantity& rhs)
+      {
+         return lhs.val < lhs.converted(rhs);
+      }
+
+   private:
+      /// @brief Value of rhs in the units of this quantity
+      constexpr PrecisionType converted(const dynamic_quantity& rhs) const
+      {
+         if (sig != rhs.sig)
+         {
+            throw std::invalid_argument("Dimension mismatch between dynamic quantities");
+         }
+         return factor == rhs.factor ? rhs.val : rhs.val * (rhs.factor / factor);
+      }
+
+      PrecisionType val = 0.0;
+      PrecisionType factor = 1.0;
+      dimension_signature sig;
+   };
+
+   /// @brief Raise a dynamic quantity to an integral power
+   constexpr dynamic_quantity pow(const dynamic_quantity& base, int exponent)
+   {
+      dynamic_quantity result(1.0, 1.0, dimension_signature{});
+      const dynamic_quantity step = exponent < 0 ? dynamic_quantity(1.0, 1.0, dimension_signature{}) / base : base;
+      for (int i = 0; i < (exponent < 0 ? -exponent : exponent); ++i)
+      {
+         result *= step;
+      }
+      return result;
+   }
+
+   /// @brief Square root of a dynamic quantity, halving every exponent
+   /// @throws std::invalid_argument if an exponent cannot be halved
+   inline dynamic_quantity sqrt(const dynamic_quantity& value)
+   {
+      return dynamic_quantity(std::sqrt(value.value()), std::sqrt(value.scale()), value.signature().power(1, 2));
+   }
+
+   /// @brief Whether a dynamic quantity has the dimensions of a static type
+   template<is_base_dimension Target>
+   constexpr bool has_dimensions_of(const dynamic_quantity& value) noexcept
+   {
+      return value.signature() == dimension_signature_v<Target>;
+   }
+
+   /// @brief Convert a dynamic quantity to a static dimension type
+   /// @details The dimensions are checked once. The value is then scaled by one factor into the
+   ///    units of Target, and everything after is the compile-time path of Target.
+   /// @throws std::invalid_argument if the dimensions differ from those of Target
+   template<is_base_dimension Target>
+   constexpr Target quantity_cast(const dynamic_quantity& value)
+   {
+      if (!has_dimensions_of<Target>(value))
+      {
+         throw std::invalid_argument("Dimension mismatch in quantity_cast");
+      }
+      constexpr PrecisionType inverse = 1.0 / primary_scale_v<Target>;
+      return Target(static_cast<typename Target::rep>(value.value() * value.scale() * inverse));
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_DYNAMIC_QUANTITY_H
@@ -0,0 +1,389 @@
+#ifndef DIMENSION_EXACT_CONVERSION_H
+#define DIMENSION_EXACT_CONVERSION_H
+
+#include <bit> // For std::has_single_bit, std::countr_zero
+#include <cmath> // For std::trunc, std::round, std::floor, std::ceil, std::isnan
+#include <concepts>
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::intmax_t, std::int64_t
+#include <limits>
+#include <numeric> // For std::gcd
+#include <ratio>
+#include <stdexcept> // For std::out_of_range
+#include <tuple>
+#include <type_traits>
+
+#include "Coefficient.h"
+#include "Conversion.h"
+#include "PrecisionType.h"
+#include "TupleHandling.h"
+#include "UnitSimplifier.h"
+#include "UnitValidation.h"
+
+namespace dimension
+{
+
+   /// @brief How a conversion to an integral Rep rounds a result which is not a whole number
+   enum class rounding
+   {
+      toward_zero, ///< Truncate, as a cast from floating point does
+      to_nearest,  ///< Round to the nearest value, halfway cases away from zero
+      down,        ///< Round toward negative infinity
+      up           ///< Round toward positive infinity
+   };
+
+   /// @brief What a conversion to an integral Rep does with a result outside the range of that Rep
+   enum class overflow
+   {
+      unchecked, ///< No check, the result is unspecified
+      saturate,  ///< Clamp to the smallest or largest value of the Rep
+      checked    ///< Throw std::out_of_range
+   };
+
+   namespace exact_detail
+   {
+      /// @brief A rational factor evaluated at compile time, exact is false when no exact value is known
+      struct rational
+      {
+         std::intmax_t num = 1;
+         std::intmax_t den = 1;
+         bool exact = true;
+      };
+
+      inline constexpr rational inexact{1, 1, false};
+
+      constexpr bool multiply_overflows(std::intmax_t a, std::intmax_t b)
+      {
+         return a != 0 && (b > std::numeric_limits<std::intmax_t>::max() / a || b < std::numeric_limits<std::intmax_t>::min() / a);
+      }
+
+      /// @brief Product of two positive rationals, inexact when a reduced term overflows std::intmax_t
+      constexpr rational multiply(rational lhs, rational rhs)
+      {
+         if (!lhs.exact || !rhs.exact)
+         {
+            return inexact;
+         }
+
+         const std::intmax_t g1 = std::gcd(lhs.num, rhs.den);
+         const std::intmax_t g2 = std::gcd(rhs.num, lhs.den);
+         const std::intmax_t n1 = lhs.num / g1, d2 = rhs.den / g1;
+         const std::intmax_t n2 = rhs.num / g2, d1 = lhs.den / g2;
+         if (multiply_overflows(n1, n2) || multiply_overflows(d1, d2))
+         {
+            return inexact;
+         }
+         return {n1 * n2, d1 * d2, true};
+      }
+
+      constexpr rational reciprocal(rational value)
+      {
+         return {value.den, value.num, value.exact};
+      }
+
+      constexpr rational power(rational base, std::intmax_t exponent)
+      {
+         rational result{};
+         for (std::intmax_t i = 0; i < (exponent < 0 ? -exponent : exponent); ++i)
+         {
+            result = multiply(result, base);
+         }
+         return exponent < 0 ? reciprocal(result) : result;
+      }
+
+      template<typename Ratio>
+      constexpr rational from_ratio()
+      {
+         return {Ratio::num, Ratio::den, true};
+      }
+
+      template<typename Conv>
+      concept has_exact_ratio = requires { typename Conv::ratio; };
+
+      /// @brief Exact factor taking a value in Unit to its primary unit
+      /// @details Conversions declare their exact factor with a ratio alias next to the slope.
+      ///    A unit whose conversion only provides a floating slope has no exact factor.
+      template<typename Unit>
+      constexpr rational unit_to_primary()
+      {
+         if constexpr (!std::is_base_of_v<FundamentalUnitTag, Unit>)
+         {
+            return inexact;
+         }
+         else
+         {
+            using Primary = typename Unit::Primary;
+            if constexpr (std::is_same_v<Unit, Primary>)
+            {
+               return rational{};
+            }
+            else if constexpr (has_exact_ratio<Conversion<Unit, Primary>>)
+            {
+               return from_ratio<typename Conversion<Unit, Primary>::ratio>();
+            }
+            else if constexpr (has_exact_ratio<Conversion<Primary, Unit>>)
+            {
+               return reciprocal(from_ratio<typename Conversion<Primary, Unit>::ratio>());
+            }
+            else
+            {
+               return inexact;
+            }
+         }
+      }
+
+      /// @brief Exact factor taking a value in a tuple of unit_exponents to the primary units, only integral exponents are exact
+      template<typename Tuple>
+      struct tuple_to_primary;
+
+      template<typename... Units>
+      struct tuple_to_primary<std::tuple<Units...>>
+      {
+         static constexpr rational value = []
+         {
+            rational result{};
+            ((result = Units::exponent::den == 1
+                          ? multiply(result, power(unit_to_primary<typename Units::unit>(), Units::exponent::num))
+                          : inexact), ...);
+            return result;
+         }();
+      };
+
+      /// @brief Exact factor taking a raw value of From to a raw value of To, coefficients included
+      template<typename From, typename To>
+      inline constexpr rational dimension_factor = []
+      {
+         if constexpr (std::tuple_size_v<typename From::symbols> != 0 || std::tuple_size_v<typename To::symbols> != 0)
+         {
+            return inexact;
+         }
+         else
+         {
+            const rational units = multiply(tuple_to_primary<typename From::units>::value,
+                                            reciprocal(tuple_to_primary<typename To::units>::value));
+            return multiply(multiply(from_ratio<typename From::ratio>(), units), reciprocal(from_ratio<typename To::ratio>()));
+         }
+      }();
+
+#if defined(__SIZEOF_INT128__)
+      __extension__ using int128 = __int128;
+#endif
+
+      template<typename From, std::intmax_t Num, typename Wide>
+      inline constexpr bool product_fits = Num <= std::numeric_limits<Wide>::max() / static_cast<Wide>(std::numeric_limits<From>::max());
+
+      /// @brief Narrowest signed type holding any product of a From and Num
+      /// @details Narrow products keep the loop vectorizable, and dividing a 128-bit value is a library call
+      template<typename From, std::intmax_t Num>
+      using wide_t =
+#if defined(__SIZEOF_INT128__)
+         std::conditional_t<(sizeof(From) < sizeof(std::int64_t) && product_fits<From, Num, std::int32_t>), std::int32_t,
+         std::conditional_t<(sizeof(From) < sizeof(std::int64_t) && product_fits<From, Num, std::int64_t>), std::int64_t, int128>>;
+#else
+         std::conditional_t<(sizeof(From) < sizeof(std::int64_t) && product_fits<From, Num, std::int32_t>), std::int32_t, std::intmax_t>;
+#endif
+
+      /// @brief Narrow a signed Wide value to To, range checked as requested
+      /// @details Wide is chosen from the source Rep alone, so To may be the wider type. A bound of To
+      ///    is only compared against when Wide can represent it, otherwise every value of Wide already
+      ///    lies on that side of it.
+      template<overflow Overflow, std::integral To, typename Wide>
+      constexpr To narrow(Wide value)
+      {
+         constexpr bool checks_low = std::is_unsigned_v<To> || sizeof(To) <= sizeof(Wide);
+         constexpr bool checks_high = sizeof(To) < sizeof(Wide) || (std::is_signed_v<To> && sizeof(To) == sizeof(Wide));
+
+         if constexpr (Overflow == overflow::unchecked || (!checks_low && !checks_high))
+         {
+            return static_cast<To>(value);
+         }
+         else
+         {
+            constexpr auto low = checks_low ? static_cast<Wide>(std::numeric_limits<To>::min()) : Wide{0};
+            constexpr auto high = checks_high ? static_cast<Wide>(std::numeric_limits<To>::max()) : Wide{0};
+            const bool below = checks_low && value < low;
+            const bool above = checks_high && value > high;
+            if constexpr (Overflow == overflow::checked)
+            {
+               if (below || above)
+               {
+                  throw std::out_of_range("Exact conversion result is outside the range of the target Rep");
+               }
+               return static_cast<To>(value);
+            }
+            else
+            {
+               // Selects rather than branches, so saturating loops still vectorize
+               return static_cast<To>(below ? low : (above ? high : value));
+            }
+         }
+      }
+
+      /// @brief value * Num / Den in integer arithmetic, rounded and range checked as requested
+      /// @details The product is formed in a type wide enough that it never overflows for a
+      ///    factor which fits std::intmax_t on targets with 128-bit integers.
+      ///    The division is by a constant, which the compiler lowers to a multiply and shift,
+      ///    and a power of two denominator rounding down is an arithmetic shift.
+      template<std::intmax_t Num, std::intmax_t Den, rounding Rounding, overflow Overflow, std::integral To, std::integral From>
+      constexpr To scale(From value)
+      {
+         using wide = wide_t<From, Num>;
+
+         if constexpr (Overflow != overflow::unchecked && std::is_same_v<wide, std::intmax_t>)
+         {
+            constexpr std::intmax_t limit = std::numeric_limits<std::intmax_t>::max() / Num;
+            if (static_cast<std::intmax_t>(value) > limit || static_cast<std::intmax_t>(value) < -limit)
+            {
+               return narrow<Overflow, To>(value < From{0} ? std::numeric_limits<std::intmax_t>::min() : std::numeric_limits<std::intmax_t>::max());
+            }
+         }
+
+         const wide product = static_cast<wide>(value) * static_cast<wide>(Num);
+         if constexpr (Den == 1)
+         {
+            return narrow<Overflow, To>(product);
+         }
+         else if constexpr (Rounding == rounding::down && std::has_single_bit(static_cast<std::uintmax_t>(Den)))
+         {
+            constexpr int shift = std::countr_zero(static_cast<std::uintmax_t>(Den));
+            return narrow<Overflow, To>(product >> shift);
+         }
+         else
+         {
+            wide quotient = product / static_cast<wide>(Den);
+            const wide remainder = product % static_cast<wide>(Den);
+
+            if constexpr (Rounding == rounding::down)
+            {
+               quotient -= static_cast<wide>(remainder < 0);
+            }
+            else if constexpr (Rounding == rounding::up)
+            {
+               quotient += static_cast<wide>(remainder > 0);
+            }
+            else if constexpr (Rounding == rounding::to_nearest)
+            {
+               // The remainder takes the sign of the product, step away from zero when it is at least half
+               const wide magnitude = remainder < 0 ? -remainder : remainder;
+               const wide step = remainder < 0 ? wide{-1} : wide{1};
+               quotient += 2 * magnitude >= static_cast<wide>(Den) ? step : wide{0};
+            }
+            return narrow<Overflow, To>(quotient);
+         }
+      }
+
+      /// @brief Round a floating-point value to an integral To as requested
+      template<rounding Rounding, overflow Overflow, std::integral To, std::floating_point From>
+      To round_to(From value)
+      {
+         From rounded;
+         if constexpr (Rounding == rounding::toward_zero) { rounded = std::trunc(value); }
+         else if constexpr (Rounding == rounding::to_nearest) { rounded = std::round(value); }
+         else if constexpr (Rounding == rounding::down) { rounded = std::floor(value); }
+         else { rounded = std::ceil(value); }
+
+         if constexpr (Overflow == overflow::unchecked)
+         {
+            return static_cast<To>(rounded);
+         }
+         else
+         {
+            // The bounds are powers of two, or zero, so both are exact in From
+            constexpr auto low = static_cast<From>(std::numeric_limits<To>::min());
+            constexpr auto high = static_cast<From>(std::numeric_limits<To>::max()) + From{1};
+            if (rounded >= low && rounded < high)
+            {
+               return static_cast<To>(rounded);
+            }
+            if constexpr (Overflow == overflow::checked)
+            {
+               throw std::out_of_range("Conversion result is outside the range of the target Rep");
+            }
+            else
+            {
+               if (std::isnan(rounded)) { return To{0}; }
+               return rounded < low ? std::numeric_limits<To>::min() : std::numeric_limits<To>::max();
+            }
+         }
+      }
+   }
+
+   namespace kernels
+   {
+      /// @brief out[i] = in[i] * factor for n integral values, rounded and range checked as requested
+      /// @details For factors only known at run time, such as one read from a serialized header, where
+      ///    the exact rational path of convert_raw is not available. Each product is formed at
+      ///    PrecisionType. in and out may alias exactly (in-place), but must not otherwise overlap.
+      /// @throws std::out_of_range with overflow::checked, if a result does not fit T
+      template<rounding Rounding, overflow Overflow, std::integral T>
+      void round_scale(const T* in, T* out, std::size_t n, PrecisionType factor)
+      {
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            out[i] = exact_detail::round_to<Rounding, Overflow, T>(static_cast<PrecisionType>(in[i]) * factor);
+         }
+      }
+   }
+
+   /// @brief Whether a value of From converts to To by an exact rational factor
+   /// @details True when every unit on both sides converts to its primary unit by a conversion
+   ///    declaring a ratio, every exponent is integral, neither side carries a symbolic
+   ///    coefficient such as pi, and the reduced factor fits std::intmax_t.
+   template<typename From, typename To>
+   inline constexpr bool has_exact_factor_v = exact_detail::dimension_factor<From, To>.exact;
+
+   /// @brief Exact factor taking a raw value of From to a raw value of To, as a std::ratio
+   template<typename From, typename To>
+   requires has_exact_factor_v<From, To>
+   using exact_factor_t = std::ratio<exact_detail::dimension_factor<From, To>.num, exact_detail::dimension_factor<From, To>.den>;
+
+   /// @brief Convert a raw value of From to a raw value of To, exactly when both Reps are integral
+   /// @details Integral Reps with an exact factor convert with integer arithmetic only.
+   ///    Any other integral target converts at PrecisionType and is rounded as requested.
+   ///    A floating-point target converts as get_dimension_as does and ignores the policies.
+   template<typename To, rounding Rounding, overflow Overflow, typename From>
+   constexpr typename To::rep convert_raw(typename From::rep raw)
+   {
+      using to_rep = typename To::rep;
+      using from_rep = typename From::rep;
+
+      if constexpr (std::is_integral_v<to_rep> && std::is_integral_v<from_rep> && has_exact_factor_v<From, To>)
+      {
+         using factor = exact_factor_t<From, To>;
+         return exact_detail::scale<factor::num, factor::den, Rounding, Overflow, to_rep>(raw);
+      }
+      else
+      {
+         constexpr PrecisionType factor = coefficient_factor_v<From> *
+                                          conversion_factor_v<typename From::units, typename To::units> /
+                                          coefficient_factor_v<To>;
+         if constexpr (std::is_integral_v<to_rep>)
+         {
+            return exact_detail::round_to<Rounding, Overflow, to_rep>(static_cast<PrecisionType>(raw) * factor);
+         }
+         else
+         {
+            return static_cast<to_rep>(static_cast<conversion_precision_t<to_rep>>(raw) * static_cast<conversion_precision_t<to_rep>>(factor));
+         }
+      }
+   }
+
+   /// @brief Convert value to the units and Rep of Target, rounding and range checking as requested
+   /// @details Integral Reps with an exact factor, such as int32 millimetres to int16 metres,
+   ///    convert with integer multiply, divide and shift, never through floating point.
+   ///    Implicit conversion between integral Reps uses the same exact path with
+   ///    rounding::toward_zero and overflow::unchecked.
+   /// @tparam Target The dimension to convert to, such as length<std::int16_t, meters>
+   /// @tparam Rounding How a result which is not a whole number is rounded for an integral Target
+   /// @tparam Overflow What happens to a result outside the range of an integral Target
+   /// @throws std::out_of_range with overflow::checked, if the result does not fit the Rep of Target
+   template<is_base_dimension Target, rounding Rounding = rounding::toward_zero, overflow Overflow = overflow::unchecked, is_base_dimension Source>
+   requires matching_dimensions<Target, Source>
+   constexpr Target dimension_cast(const Source& value)
+   {
+      return Target(convert_raw<Target, Rounding, Overflow, Source>(value.template get_tuple_scalar<typename Source::units>()));
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_EXACT_CONVERSION_H
@@ -2,6 +2,7 @@
 #define DIMENSION_HASHING_H
 
 #include <cstdint> // for std::uint#_t
+#include <string_view>
 
 #include "StringLiteral.h"
 
@@ -49,7 +50,7 @@ namespace dimension
 
    /// @brief Hashing policy using FNV-1a algorithm resulting in 32-bit tag
    /// @details This method hashes a string to a 32-bit value.
-   ///   COLLISIONS ARE POSSIBLE WITH THIS METHOD
+   ///   COLLISIONS ARE POSSIBLE WITH THIS METHOD. Prefer FNV_1a_64Bit or XXHash64 where many types share a stream.
    struct FNV_1a_32Bit
    {
       using tag_type = TagWrapper<std::uint32_t>;
@@ -70,6 +71,137 @@ namespace dimension
       }
    };
 
+   /// @brief Hashing policy using FNV-1a algorithm resulting in 64-bit tag
+   /// @details Same algorithm as FNV_1a_32Bit with the 64-bit offset basis and prime.
+   struct FNV_1a_64Bit
+   {
+      using tag_type = TagWrapper<std::uint64_t>;
+
+      static constexpr size_t tag_size = tag_type::size;
+
+      /// @brief FNV-1a hash of a sequence of bytes
+      static constexpr std::uint64_t hash(std::string_view bytes) noexcept
+      {
+         std::uint64_t hash = 0xCBF29CE484222325;
+         for (char c : bytes)
+         {
+            hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+            hash *= 0x00000100000001B3;
+         }
+         return hash;
+      }
+
+      // FNV-1a hash function for `StringLiteral`, including its null terminator
+      template <std::size_t N>
+      static constexpr tag_type hash_string_literal(const StringLiteral<N>& str)
+      {
+         return tag_type(hash(std::string_view(str.value.data(), N)));
+      }
+   };
+
+   /// @brief Hashing policy using the xxHash64 algorithm resulting in 64-bit tag
+   /// @details Follows the XXH64 specification with a seed of zero, so tags match other xxHash64
+   ///    implementations given the same bytes. Stronger mixing than FNV-1a for long unit strings.
+   struct XXHash64
+   {
+      using tag_type = TagWrapper<std::uint64_t>;
+
+      static constexpr size_t tag_size = tag_type::size;
+
+   private:
+      static constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87;
+      static constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4F;
+      static constexpr std::uint64_t prime3 = 0x165667B19E3779F9;
+      static constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63;
+      static constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5;
+
+      static constexpr std::uint64_t rotl(std::uint64_t x, int r) noexcept { return (x << r) | (x >> (64 - r)); }
+
+      /// @brief Little-endian read of Bytes bytes, independent of the host byte order
+      template <std::size_t Bytes>
+      static constexpr std::uint64_t read(std::string_view bytes, std::size_t offset) noexcept
+      {
+         std::uint64_t value = 0;
+         for (std::size_t i = 0; i < Bytes; ++i)
+         {
+            value |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[offset + i])) << (8 * i);
+         }
+         return value;
+      }
+
+      static constexpr std::uint64_t round(std::uint64_t acc, std::uint64_t input) noexcept
+      {
+         return rotl(acc + input * prime2, 31) * prime1;
+      }
+
+      static constexpr std::uint64_t merge(std::uint64_t acc, std::uint64_t lane) noexcept
+      {
+         return (acc ^ round(0, lane)) * prime1 + prime4;
+      }
+
+   public:
+      /// @brief xxHash64 of a sequence of bytes
+      static constexpr std::uint64_t hash(std::string_view bytes, std::uint64_t seed = 0) noexcept
+      {
+         const std::size_t length = bytes.size();
+         std::size_t offset = 0;
+         std::uint64_t h;
+
+         if (length >= 32)
+         {
+            std::uint64_t v1 = seed + prime1 + prime2;
+            std::uint64_t v2 = seed + prime2;
+            std::uint64_t v3 = seed;
+            std::uint64_t v4 = seed - prime1;
+            for (; offset + 32 <= length; offset += 32)
+            {
+               v1 = round(v1, read<8>(bytes, offset));
+               v2 = round(v2, read<8>(bytes, offset + 8));
+               v3 = round(v3, read<8>(bytes, offset + 16));
+               v4 = round(v4, read<8>(bytes, offset + 24));
+            }
+            h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+            h = merge(h, v1);
+            h = merge(h, v2);
+            h = merge(h, v3);
+            h = merge(h, v4);
+         }
+         else
+         {
+            h = seed + prime5;
+         }
+
+         h += length;
+         for (; offset + 8 <= length; offset += 8)
+         {
+            h = rotl(h ^ round(0, read<8>(bytes, offset)), 27) * prime1 + prime4;
+         }
+         if (offset + 4 <= length)
+         {
+            h = rotl(h ^ (read<4>(bytes, offset) * prime1), 23) * prime2 + prime3;
+            offset += 4;
+         }
+         for (; offset < length; ++offset)
+         {
+            h = rotl(h ^ (read<1>(bytes, offset) * prime5), 11) * prime1;
+         }
+
+         h ^= h >> 33;
+         h *= prime2;
+         h ^= h >> 29;
+         h *= prime3;
+         h ^= h >> 32;
+         return h;
+      }
+
+      // xxHash64 hash function for `StringLiteral`, including its null terminator
+      template <std::size_t N>
+      static constexpr tag_type hash_string_literal(const StringLiteral<N>& str)
+      {
+         return tag_type(hash(std::string_view(str.value.data(), N)));
+      }
+   };
+
    /// @brief Provide a post-hashed tag based on string representation of data
    /// @details Sorts the string representation of each item in both the numerator and denominator
    ///   then concatenates the two. This string is the input for hashing.
@@ -79,7 +211,7 @@ namespace dimension
    template <is_base_dimension Dim, typename HashPolicy>
    struct TypeTagHelper 
    {
-      using SortedTuple = tuple_bubble_sort<typename InitialSimplifier<typename Dim::units>::units>::type;
+      using SortedTuple = tuple_sort_t<typename InitialSimplifier<typename Dim::units>::units>;
       static constexpr auto TupleString = TupleStringConcat<SortedTuple>::value();
 
       static constexpr HashPolicy::tag_type value()
@@ -2,11 +2,18 @@
 #ifndef DIMENSION_POINT_H
 #define DIMENSION_POINT_H
 
+#include <algorithm> // For std::copy
+#include <concepts>
+#include <ranges> // For std::ranges::contiguous_range
+#include <span>
+#include <stdexcept> // For std::invalid_argument
 #include <type_traits>
 #include <utility>
-#include <concepts>
 
+#include "BatchConversion.h"
 #include "Conversion.h"
+#include "RepTraits.h"
+#include "UnitSimplifier.h"
 #include "base_dimension_signature.h"
 
 namespace dimension {
@@ -19,37 +26,6 @@ namespace dimension {
       using unit = T;
    };
 
-   template<typename Target, typename Source>
-   struct get_point_as_impl;
-
-   // Entry point
-   template<typename Target, typename P>
-   constexpr double get_point_as(const P& obj) {
-      return get_point_as_impl<Target, typename P::frame_type>::convert(obj);
-   }
-
-
-   template<typename Frame, typename Dim>
-   class point {
-   public:
-      using frame_type = Frame;
-      using dimension = Dim;
-
-      constexpr explicit point(double val) : value_(val) {}
-
-      template<typename T>
-      //requires true; // Add a real constraint
-      // cppcheck-suppress noExplicitConstructor
-      constexpr point(point<T, Dim> obj) : value_(get_point_as<Frame>(obj)) {}
-
-   private:
-      double value_;
-
-      friend struct get_point_as_impl<Frame, Frame>;
-   };
-
-   // ===================== Conversions =====================
-
    template<typename T>
    concept HasDoubleOffset = requires {
       { T::offset } -> std::convertible_to<double>;
@@ -68,84 +44,146 @@ namespace dimension {
       return 0.0;
    }
 
-   // Case 1: Same frame
-   template<typename Frame>
-   struct get_point_as_impl<Frame, Frame> {
-       template<typename P>
-       static constexpr double convert(const P& obj) {
-           return obj.value_;
-       }
+   /// @brief The unit a point is measured in, for either a reference frame or a unit
+   template<typename T>
+   struct point_unit
+   {
+      using type = typename T::unit;
    };
-   
-   // Case 2: Target is the unit of the source's frame
-   template<typename Unit, typename Frame>
-   requires std::is_same_v<Unit, typename Frame::unit>
-   struct get_point_as_impl<Unit, Frame> {
-       template<typename P>
-       static constexpr double convert(const P& obj) {
-           return get_point_as_impl<Frame, Frame>::convert(obj) + point_offset<Frame>();
-       }
+
+   template<typename T>
+   requires (std::is_base_of_v<FundamentalUnitTag, T>)
+   struct point_unit<T>
+   {
+      using type = T;
    };
-   
-   // Case 3: Target is a different unit entirely
-   template<typename TargetUnit, typename SourceFrame>
-   requires (
-       std::is_base_of_v<FundamentalUnitTag, TargetUnit> &&
-       !std::is_same_v<TargetUnit, typename SourceFrame::unit>
-   )
-   struct get_point_as_impl<TargetUnit, SourceFrame> {
-      template<typename P>
-      static constexpr double convert(const P& obj) {
-         double raw = get_point_as_impl<SourceFrame, SourceFrame>::convert(obj) + point_offset<SourceFrame>();
-         return DoConversion<TargetUnit,  unit_exponent<typename SourceFrame::unit>>(raw);
-      }
+
+   /// @brief Conversion of a point between two reference frames or units, resolved at compile time
+   /// @details Converting adds the source offset, converts to the target unit, then subtracts
+   ///    the target offset. All three steps are folded into out = in * slope + offset.
+   /// @tparam Target Reference frame or unit to convert to
+   /// @tparam Source Reference frame or unit to convert from
+   template<typename Target, typename Source>
+   struct point_conversion
+   {
+      static constexpr PrecisionType slope = GetSlope<typename point_unit<Source>::type, typename point_unit<Target>::type>();
+      static constexpr PrecisionType offset = point_offset<Source>() * slope - point_offset<Target>();
    };
-   
-   // Case 4: Target is a different frame
-   template<typename TargetFrame, typename SourceFrame>
-   requires (
-       !std::is_base_of_v<FundamentalUnitTag, TargetFrame> &&
-       !std::is_base_of_v<FundamentalUnitTag, SourceFrame> &&
-       !std::is_same_v<TargetFrame, SourceFrame>
-   )
-   struct get_point_as_impl<TargetFrame, SourceFrame> {
-      template<typename P>
-      static constexpr double convert(const P& obj) {
-         double raw = get_point_as_impl<SourceFrame, SourceFrame>::convert(obj) + point_offset<SourceFrame>();
-         double in_target_unit = DoConversion<typename TargetFrame::unit, unit_exponent<typename SourceFrame::unit>>(raw);
-         return in_target_unit - point_offset<TargetFrame>();
+
+   /// @brief Apply a point conversion to one value at the precision of Rep
+   template<typename Target, typename Source, typename Rep>
+   constexpr Rep apply_point_conversion(const Rep& value)
+   {
+      using conversion = point_conversion<Target, Source>;
+
+      if constexpr (std::is_integral_v<Rep>)
+      {
+         return static_cast<Rep>(static_cast<PrecisionType>(value) * conversion::slope + conversion::offset);
       }
-   };
-   
-   // Case 5: Target is a frame of this unit
-   template<typename TargetFrame, typename SourceUnit>
-   requires (
-       std::is_base_of_v<FundamentalUnitTag, SourceUnit> &&
-       std::is_same_v<SourceUnit, typename TargetFrame::unit>
-   )
-   struct get_point_as_impl<TargetFrame, SourceUnit> {
-      template<typename P>
-      static constexpr double convert(const P& obj) {
-         double raw = get_point_as_impl<SourceUnit, SourceUnit>::convert(obj);
-         return raw - point_offset<TargetFrame>();
+      else
+      {
+         Rep result = value;
+         if constexpr (conversion::slope != PrecisionType{1})
+         {
+            result = rep_traits<Rep>::scale(result, conversion::slope);
+         }
+         if constexpr (conversion::offset != PrecisionType{0})
+         {
+            result += static_cast<typename rep_traits<Rep>::value_type>(conversion::offset);
+         }
+         return result;
       }
+   }
+
+   template<typename Target, typename P>
+   constexpr typename P::rep get_point_as(const P& obj);
+
+   /// @brief A position measured relative to a reference frame, such as a temperature in celsius
+   /// @tparam Frame Reference frame, or unit, the value is measured in
+   /// @tparam Dim Dimension tag of the point
+   /// @tparam Rep Type used to store the value
+   template<typename Frame, typename Dim, typename Rep = double>
+   class point {
+   public:
+      using frame_type = Frame;
+      using dimension = Dim;
+      using rep = Rep;
+
+      constexpr explicit point(Rep val) : value_(val) {}
+
+      template<typename T>
+      //requires true; // Add a real constraint
+      // cppcheck-suppress noExplicitConstructor
+      constexpr point(point<T, Dim, Rep> obj) : value_(get_point_as<Frame>(obj)) {}
+
+      /// @brief The stored value, in terms of Frame
+      [[nodiscard]] constexpr Rep raw() const { return value_; }
+
+   private:
+      Rep value_;
    };
 
-   // Case 6: Target is a frame of a different unit
-   template<typename TargetFrame, typename SourceUnit>
-   requires (
-       std::is_base_of_v<FundamentalUnitTag, SourceUnit> &&
-       !std::is_same_v<SourceUnit, typename TargetFrame::unit>
-   )
-   struct get_point_as_impl<TargetFrame, SourceUnit> {
-      template<typename P>
-      static constexpr double convert(const P& obj) {
-         double raw = get_point_as_impl<SourceUnit, SourceUnit>::convert(obj);
-         double in_target_unit = DoConversion<typename TargetFrame::unit, unit_exponent<typename SourceUnit::unit>>(raw);
-         return in_target_unit - point_offset<TargetFrame>();
+   /// @brief Retrieve the value of a point in terms of another reference frame or unit
+   /// @tparam Target Reference frame or unit to convert to
+   /// @param obj Point to convert
+   /// @return The converted value, in the Rep of the point
+   template<typename Target, typename P>
+   constexpr typename P::rep get_point_as(const P& obj) {
+      return apply_point_conversion<Target, typename P::frame_type>(obj.raw());
+   }
+
+   /// @brief Convert a contiguous array of raw point values between reference frames
+   /// @details The source offset, unit slope and target offset are folded at compile time
+   ///    into one affine transform, applied with the vectorized convert_span kernels.
+   /// @tparam TargetFrame Reference frame or unit to convert to
+   /// @tparam SourceFrame Reference frame or unit the input values are measured in
+   /// @param in Values to convert, any contiguous range such as std::span or std::vector
+   /// @param out Destination for converted values, must be the same size as in
+   template<typename TargetFrame, typename SourceFrame, std::ranges::contiguous_range In, std::ranges::contiguous_range Out>
+   requires (std::is_same_v<std::ranges::range_value_t<In>, std::ranges::range_value_t<Out>> &&
+             std::is_floating_point_v<std::ranges::range_value_t<Out>>)
+   void convert_points(const In& in, Out&& out)
+   {
+      using T = std::ranges::range_value_t<Out>;
+
+      const std::span<const T> src(std::ranges::data(in), std::ranges::size(in));
+      const std::span<T> dst(std::ranges::data(out), std::ranges::size(out));
+
+      if (src.size() != dst.size())
+      {
+         throw std::invalid_argument("convert_points input and output must be the same size");
       }
-   };
 
+      using conversion = point_conversion<TargetFrame, SourceFrame>;
+      constexpr T slope = static_cast<T>(conversion::slope);
+      constexpr T offset = static_cast<T>(conversion::offset);
+
+      if constexpr (conversion::offset == PrecisionType{0} && conversion::slope == PrecisionType{1})
+      {
+         if (src.data() != dst.data())
+         {
+            std::copy(src.begin(), src.end(), dst.begin());
+         }
+      }
+      else if constexpr (conversion::offset == PrecisionType{0})
+      {
+         kernels::scale<T>(src.data(), dst.data(), src.size(), slope);
+      }
+      else
+      {
+         kernels::affine<T>(src.data(), dst.data(), src.size(), slope, offset);
+      }
+   }
+
+   /// @brief Convert a contiguous array of raw point values between reference frames in place
+   /// @tparam TargetFrame Reference frame or unit to convert to
+   /// @tparam SourceFrame Reference frame or unit the values are measured in
+   /// @param values Values to convert, any contiguous range such as std::span or std::vector
+   template<typename TargetFrame, typename SourceFrame, std::ranges::contiguous_range R>
+   void convert_points(R&& values)
+   {
+      convert_points<TargetFrame, SourceFrame>(values, values);
+   }
 
    // ===================== Addition/Subtraction =====================
 
@@ -153,65 +191,65 @@ namespace dimension {
    // point + point -> INVALID
 
    // point + unit -> point
-   template<typename T, typename U, typename Dim>
+   template<typename T, typename U, typename Dim, typename Rep>
    requires true // Requires a basedimension which matches lhs
-   constexpr point<T, Dim> operator+(point<T, Dim> lhs, base_dimension_impl<double, unit_exponent<U>> rhs)
+   constexpr point<T, Dim, Rep> operator+(point<T, Dim, Rep> lhs, base_dimension_impl<Rep, unit_exponent<U>> rhs)
    {
-      return point<T, Dim>(get_point_as<T>(lhs) + get_dimension_as<unit_exponent<typename T::unit>>(rhs));
+      return point<T, Dim, Rep>(get_point_as<T>(lhs) + get_dimension_as<unit_exponent<typename T::unit>>(rhs));
    }
 
    // unit + point -> point
-   template<typename T, typename U, typename Dim>
+   template<typename T, typename U, typename Dim, typename Rep>
    requires true // Requires a basedimension which matches lhs
-   constexpr point<T, Dim> operator+(base_dimension_impl<double, unit_exponent<U>> lhs, point<T, Dim> rhs)
+   constexpr point<T, Dim, Rep> operator+(base_dimension_impl<Rep, unit_exponent<U>> lhs, point<T, Dim, Rep> rhs)
    {
-      return point<T, Dim>(get_point_as<T>(rhs) + get_dimension_as<unit_exponent<typename T::unit>>(lhs));
+      return point<T, Dim, Rep>(get_point_as<T>(rhs) + get_dimension_as<unit_exponent<typename T::unit>>(lhs));
    }
 
    // point - unit -> point
-   template<typename T, typename U, typename Dim>
+   template<typename T, typename U, typename Dim, typename Rep>
    requires true // Requires a basedimension which matches lhs
-   constexpr point<T, Dim> operator-(point<T, Dim> lhs, base_dimension_impl<double, unit_exponent<U>> rhs)
+   constexpr point<T, Dim, Rep> operator-(point<T, Dim, Rep> lhs, base_dimension_impl<Rep, unit_exponent<U>> rhs)
    {
-      return point<T, Dim>(get_point_as<T>(lhs) - get_dimension_as<unit_exponent<typename T::unit>>(rhs));
+      return point<T, Dim, Rep>(get_point_as<T>(lhs) - get_dimension_as<unit_exponent<typename T::unit>>(rhs));
    }
 
    // point - point
-   template<typename T, typename U, typename Dim>
+   template<typename T, typename U, typename Dim, typename Rep>
    requires true // Requires a basedimension which matches lhs
-   constexpr base_dimension_impl<double, unit_exponent<typename T::unit>> operator-(point<T, Dim> lhs, point<U, Dim> rhs)
+   constexpr base_dimension_impl<Rep, unit_exponent<typename T::unit>> operator-(point<T, Dim, Rep> lhs, point<U, Dim, Rep> rhs)
    {
-      return base_dimension_impl<double, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(lhs) - get_point_as<typename T::unit>(rhs));
+      return base_dimension_impl<Rep, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(lhs) - get_point_as<typename T::unit>(rhs));
    }
 
    // Need to figure out the return type, probably using auto
    // ===================== Multiplication/Division =====================
-   template<typename T, is_base_dimension Rhs, typename Dim>
+   template<typename T, is_base_dimension Rhs, typename Dim, typename Rep>
    requires true // Requires a basedimension which matches lhs
-   constexpr auto operator*(point<T, Dim> lhs, Rhs rhs)
+   constexpr auto operator*(point<T, Dim, Rep> lhs, Rhs rhs)
    {
-      return base_dimension_impl<double, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(lhs)) * rhs;
+      return base_dimension_impl<Rep, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(lhs)) * rhs;
    }
 
-   template<typename T, is_base_dimension Lhs, typename Dim>
+   template<typename T, is_base_dimension Lhs, typename Dim, typename Rep>
    requires true // Requires a basedimension which matches lhs
-   constexpr auto operator*(Lhs lhs, point<T, Dim> rhs)
+   constexpr auto operator*(Lhs lhs, point<T, Dim, Rep> rhs)
    {
-      return lhs * base_dimension_impl<double, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(rhs));
+      return lhs * base_dimension_impl<Rep, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(rhs));
    }
 
-   template<typename T, is_base_dimension Rhs, typename Dim>
+   template<typename T, is_base_dimension Rhs, typename Dim, typename Rep>
    requires true // Requires a basedimension which matches lhs
-   constexpr auto operator/(point<T, Dim> lhs, Rhs rhs)
+   constexpr auto operator/(point<T, Dim, Rep> lhs, Rhs rhs)
    {
-      return base_dimension_impl<double, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(lhs)) / rhs;
+      return base_dimension_impl<Rep, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(lhs)) / rhs;
    }
 
-   template<typename T, is_base_dimension Lhs, typename Dim>
+   template<typename T, is_base_dimension Lhs, typename Dim, typename Rep>
    requires true // Requires a basedimension which matches lhs
-   constexpr auto operator/(Lhs lhs, point<T, Dim> rhs)
+   constexpr auto operator/(Lhs lhs, point<T, Dim, Rep> rhs)
    {
-      return lhs / base_dimension_impl<double, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(rhs));
+      return lhs / base_dimension_impl<Rep, unit_exponent<typename T::unit>>(get_point_as<typename T::unit>(rhs));
    }
 
 }
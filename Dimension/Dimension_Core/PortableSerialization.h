@@ -0,0 +1,334 @@
+#ifndef DIMENSION_PORTABLE_SERIALIZATION_H
+#define DIMENSION_PORTABLE_SERIALIZATION_H
+
+#include <array>
+#include <bit> // For std::endian
+#include <cstddef> // For std::byte, std::size_t
+#include <cstdint> // For std::uint#_t
+#include <cstring> // For std::memcpy
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept> // For std::invalid_argument
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "ByteOrder.h"
+#include "ConvertibleSerialization.h"
+#include "Hashing.h"
+#include "SerializationPolicies.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief Serialization policy with a fixed byte order on the wire, for exchanging data between platforms
+   /// @details Writes blocks of values, as BlockSerializationPolicy does, but every field is written in
+   ///   WireOrder whatever the byte order of the host, and the kind and width of Rep are recorded.
+   ///   Values of the same width are converted with a vectorized byte swap, or copied as they are when the
+   ///   host already uses WireOrder. A block may be read with a wider Rep of the same kind, such as values
+   ///   logged as float and analysed as double. Single values are written as blocks of one.
+   ///   Layout: [tag (HashPolicy::tag_size bytes)][rep kind (char)][sizeof(Rep) (uint8_t)]['L' or 'B' (char)][0]
+   ///   [count (uint32_t)][zero padding up to header_size][count * sizeof(Rep) bytes].
+   ///   The header is padded to a multiple of 8 bytes, so values written at an aligned address stay aligned.
+   /// @tparam HashPolicy Policy used to hash the type into a tag to serialize alongside the data
+   /// @tparam WireOrder Byte order of the serialized data
+   template<typename HashPolicy = FNV_1a_32Bit, std::endian WireOrder = std::endian::little>
+   struct PortableSerializationPolicy
+   {
+      static_assert(WireOrder == std::endian::little || WireOrder == std::endian::big, "The wire byte order must be little or big endian");
+
+      using count_type = std::uint32_t;
+
+      static constexpr std::endian wire_order = WireOrder;
+
+      /// @brief Size in bytes of the header preceding the values
+      static constexpr std::size_t header_size = (HashPolicy::tag_size + 4 + sizeof(count_type) + 7) / 8 * 8;
+
+      /// @brief Size in bytes of a block holding count values of Dim
+      template <is_base_dimension Dim>
+      [[nodiscard]] static constexpr std::size_t block_size(std::size_t count) noexcept
+      {
+         return header_size + count * sizeof(typename Dim::rep);
+      }
+
+   private:
+      static constexpr char order_mark = WireOrder == std::endian::little ? 'L' : 'B';
+
+      struct header
+      {
+         std::size_t count;
+         std::size_t rep_size;
+      };
+
+      template <typename Rep>
+      static constexpr void check_rep()
+      {
+         static_assert(std::is_arithmetic_v<Rep>, "Portable serialization requires an arithmetic Rep");
+         static_assert(sizeof(Rep) == 1 || sizeof(Rep) == 2 || sizeof(Rep) == 4 || sizeof(Rep) == 8,
+                       "Portable serialization requires a Rep of 1, 2, 4 or 8 bytes");
+      }
+
+      template <typename T>
+      static void store(std::byte* out, T value) noexcept
+      {
+         value = to_byte_order<WireOrder>(value);
+         std::memcpy(out, &value, sizeof(T));
+      }
+
+      template <typename T>
+      static T load(const std::byte* in) noexcept
+      {
+         T value;
+         std::memcpy(&value, in, sizeof(T));
+         return to_byte_order<WireOrder>(value);
+      }
+
+      template <is_base_dimension Dim>
+      static std::byte* write_header(std::span<std::byte> bytes, std::size_t count)
+      {
+         using rep = typename Dim::rep;
+         check_rep<rep>();
+
+         serialization_detail::check_block_output(count, bytes.size(), block_size<Dim>(count));
+
+         std::byte* out = bytes.data();
+         if constexpr(!std::is_void_v<typename HashPolicy::tag_type::type>)
+         {
+            store(out, TypeTagHelper<Dim, HashPolicy>::value().get());
+            out += HashPolicy::tag_size;
+         }
+
+         const std::array<char, 4> repInfo{serialization_detail::rep_kind_v<rep>, static_cast<char>(sizeof(rep)), order_mark, 0};
+         std::memcpy(out, repInfo.data(), repInfo.size());
+         store(out + repInfo.size(), static_cast<count_type>(count));
+
+         std::byte* data = bytes.data() + header_size;
+         out += repInfo.size() + sizeof(count_type);
+         std::memset(out, 0, static_cast<std::size_t>(data - out));
+         return data;
+      }
+
+      template <is_base_dimension Dim>
+      static header read_header(std::span<const std::byte> bytes)
+      {
+         using rep = typename Dim::rep;
+         check_rep<rep>();
+
+         serialization_detail::check_block_header(bytes.size(), header_size);
+
+         const std::byte* in = bytes.data();
+         if constexpr(!std::is_void_v<typename HashPolicy::tag_type::type>)
+         {
+            using tag_type = typename HashPolicy::tag_type::type;
+            if (load<tag_type>(in) != TypeTagHelper<Dim, HashPolicy>::value().get())
+            {
+               throw std::invalid_argument("Type tag mismatch during deserialization");
+            }
+            in += HashPolicy::tag_size;
+         }
+
+         std::array<char, 4> repInfo;
+         std::memcpy(repInfo.data(), in, repInfo.size());
+         if (repInfo[2] != order_mark)
+         {
+            throw std::invalid_argument("Serialized block was written with another byte order");
+         }
+         const auto repSize = static_cast<std::size_t>(repInfo[1]);
+         const bool knownSize = std::is_floating_point_v<rep> ? (repSize == 4 || repSize == 8)
+                                                              : (repSize == 1 || repSize == 2 || repSize == 4 || repSize == 8);
+         if (repInfo[0] != serialization_detail::rep_kind_v<rep> || !knownSize || repSize > sizeof(rep))
+         {
+            throw std::invalid_argument("Serialized block Rep cannot be read without loss as the requested Rep");
+         }
+
+         const std::size_t count = load<count_type>(in + repInfo.size());
+         serialization_detail::check_block_input(bytes.size(), header_size + count * repSize);
+         return {count, repSize};
+      }
+
+      /// @brief Pass each value of a block written with a narrower Rep of the same kind to the sink, as Rep
+      template <typename Rep, typename Sink>
+      static void widen(const std::byte* data, const header& hdr, Sink&& sink)
+      {
+         const auto widenFrom = [&]<typename Wire>()
+         {
+            if constexpr (sizeof(Wire) < sizeof(Rep))
+            {
+               for (std::size_t i = 0; i < hdr.count; ++i)
+               {
+                  sink(i, static_cast<Rep>(load<Wire>(data + i * sizeof(Wire))));
+               }
+            }
+         };
+
+         if constexpr (std::is_floating_point_v<Rep>)
+         {
+            widenFrom.template operator()<float>();
+         }
+         else
+         {
+            using narrow = std::conditional_t<std::is_signed_v<Rep>, std::tuple<std::int8_t, std::int16_t, std::int32_t>,
+                                                                     std::tuple<std::uint8_t, std::uint16_t, std::uint32_t>>;
+            switch (hdr.rep_size)
+            {
+               case 1: widenFrom.template operator()<std::tuple_element_t<0, narrow>>(); break;
+               case 2: widenFrom.template operator()<std::tuple_element_t<1, narrow>>(); break;
+               default: widenFrom.template operator()<std::tuple_element_t<2, narrow>>(); break;
+            }
+         }
+      }
+
+   public:
+      /// @brief serialize packed values in the units of Dim into a passed buffer
+      /// @tparam Dim The dimension type of the values
+      /// @tparam OutputBuf The buffer type
+      /// @param out The buffer to serialize into
+      /// @param values The values to serialize
+      /// @return The number of bytes written
+      template <is_base_dimension Dim, typename OutputBuf>
+      static std::size_t serialize(OutputBuf&& out, std::span<const typename Dim::rep> values)
+      {
+         using rep = typename Dim::rep;
+
+         std::byte* data = write_header<Dim>(serialization_detail::output_bytes(out), values.size());
+         kernels::byte_order_copy<WireOrder, sizeof(rep)>(reinterpret_cast<const std::byte*>(values.data()), data, values.size());
+         return block_size<Dim>(values.size());
+      }
+
+      /// @brief serialize a range of base_dimension objects into a passed buffer
+      /// @tparam Dim The dimension type to serialize
+      /// @tparam OutputBuf The buffer type
+      /// @param out The buffer to serialize into
+      /// @param objs The objects to serialize
+      /// @return The number of bytes written
+      template <is_base_dimension Dim, typename OutputBuf>
+      static std::size_t serialize(OutputBuf&& out, std::span<const Dim> objs)
+      {
+         using rep = typename Dim::rep;
+
+         std::byte* data = write_header<Dim>(serialization_detail::output_bytes(out), objs.size());
+         for (const Dim& obj : objs)
+         {
+            store<rep>(data, obj.template get_tuple_scalar<typename Dim::units>());
+            data += sizeof(rep);
+         }
+         return block_size<Dim>(objs.size());
+      }
+
+      /// @brief serialize a base_dimension object into a passed buffer, as a block of one
+      /// @tparam Dim The dimension type to serialize
+      /// @tparam OutputBuf The buffer type
+      /// @param out The buffer to serialize into
+      /// @param obj The object to serialize
+      template <is_base_dimension Dim, typename OutputBuf>
+      static void serialize(OutputBuf& out, const Dim& obj)
+      {
+         serialize<Dim>(out, std::span<const Dim>(&obj, 1));
+      }
+
+      /// @brief serialize a base_dimension object, as a block of one, and return the buffer
+      /// @tparam Dim The dimension type to serialize
+      /// @tparam OutputBuf The buffer type
+      /// @param obj The object to serialize
+      /// @return A new buffer populated with data from serializing obj
+      template <is_base_dimension Dim, typename OutputBuf = std::vector<uint8_t>>
+      static OutputBuf serialize(const Dim& obj)
+      {
+         constexpr std::size_t elementSize = sizeof(typename OutputBuf::value_type);
+
+         OutputBuf out;
+         out.resize((block_size<Dim>(1) + elementSize - 1) / elementSize);
+         serialize<Dim>(out, std::span<const Dim>(&obj, 1));
+         return out;
+      }
+
+      /// @brief Validate the header of a serialized block and return its number of values
+      /// @tparam Dim The dimension type expected in the block
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @return The number of values in the block
+      template <is_base_dimension Dim, typename InputBuf>
+      [[nodiscard]] static std::size_t count(const InputBuf& in)
+      {
+         return read_header<Dim>(serialization_detail::input_bytes(in)).count;
+      }
+
+      /// @brief deserialize a block into packed values in the units of Dim, in native byte order
+      /// @tparam Dim The dimension type expected in the block
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @param values Destination for the values. Must hold at least count<Dim>(in) values.
+      /// @return The number of values read
+      template <is_base_dimension Dim, typename InputBuf>
+      static std::size_t deserialize(const InputBuf& in, std::span<typename Dim::rep> values)
+      {
+         using rep = typename Dim::rep;
+
+         const std::span<const std::byte> bytes = serialization_detail::input_bytes(in);
+         const header hdr = read_header<Dim>(bytes);
+         serialization_detail::check_destination(values.size(), hdr.count);
+
+         const std::byte* data = bytes.data() + header_size;
+         if (hdr.rep_size == sizeof(rep)) [[likely]]
+         {
+            kernels::byte_order_copy<WireOrder, sizeof(rep)>(data, reinterpret_cast<std::byte*>(values.data()), hdr.count);
+         }
+         else
+         {
+            widen<rep>(data, hdr, [&](std::size_t i, rep value) { values[i] = value; });
+         }
+         return hdr.count;
+      }
+
+      /// @brief deserialize a block into base_dimension objects
+      /// @tparam Dim The dimension type expected in the block
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @param objs Destination for the objects. Must hold at least count<Dim>(in) objects.
+      /// @return The number of objects read
+      template <is_base_dimension Dim, typename InputBuf>
+      static std::size_t deserialize(const InputBuf& in, std::span<Dim> objs)
+      {
+         using rep = typename Dim::rep;
+
+         const std::span<const std::byte> bytes = serialization_detail::input_bytes(in);
+         const header hdr = read_header<Dim>(bytes);
+         serialization_detail::check_destination(objs.size(), hdr.count);
+
+         const std::byte* data = bytes.data() + header_size;
+         if (hdr.rep_size == sizeof(rep)) [[likely]]
+         {
+            for (std::size_t i = 0; i < hdr.count; ++i)
+            {
+               objs[i] = Dim(load<rep>(data + i * sizeof(rep)));
+            }
+         }
+         else
+         {
+            widen<rep>(data, hdr, [&](std::size_t i, rep value) { objs[i] = Dim(value); });
+         }
+         return hdr.count;
+      }
+
+      /// @brief deserialize a block of one and return the corresponding object
+      /// @tparam Dim The dimension type expected in the block
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer to deserialize
+      /// @return A new base_dimension object populated with data from deserializing input buffer
+      template <is_base_dimension Dim, typename InputBuf>
+      static Dim deserialize(const InputBuf& in)
+      {
+         Dim obj;
+         if (deserialize<Dim>(in, std::span<Dim>(&obj, 1)) != 1)
+         {
+            throw std::invalid_argument("Serialized block does not hold a single value");
+         }
+         return obj;
+      }
+   };
+
+} // end Dimension
+
+#endif // DIMENSION_PORTABLE_SERIALIZATION_H
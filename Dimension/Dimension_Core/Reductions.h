@@ -0,0 +1,587 @@
+#ifndef DIMENSION_REDUCTIONS_H
+#define DIMENSION_REDUCTIONS_H
+
+#include <algorithm> // For std::min
+#include <cmath> // For std::sqrt, std::ceil, std::floor, std::isnan
+#include <cstddef> // For std::size_t
+#include <exception> // For std::exception_ptr
+#include <functional> // For std::greater, std::less
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept> // For std::invalid_argument
+#include <thread>
+#include <type_traits>
+#include <utility> // For std::pair
+#include <vector>
+
+#include "Coefficient.h"
+#include "DimensionArray.h"
+#include "ExactConversion.h"
+#include "SimdRep.h"
+#include "UnitSimplifier.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   namespace execution
+   {
+      /// @brief Run a reduction on the calling thread
+      struct sequenced_policy {};
+
+      /// @brief Split a reduction across threads
+      struct parallel_policy
+      {
+         /// @brief Maximum number of threads, 0 uses std::thread::hardware_concurrency
+         std::size_t threads = 0;
+      };
+
+      inline constexpr sequenced_policy seq{};
+      inline constexpr parallel_policy par{};
+
+      /// @brief Concept for the execution policies accepted by the reductions
+      template<typename T>
+      concept execution_policy = std::is_same_v<std::remove_cvref_t<T>, sequenced_policy> ||
+                                 std::is_same_v<std::remove_cvref_t<T>, parallel_policy>;
+   }
+
+   /// @brief How floating-point sums are accumulated
+   enum class summation
+   {
+      standard, ///< Plain addition
+      neumaier  ///< Compensated (Neumaier) addition, the error does not grow with the number of elements
+   };
+
+   namespace reduction_detail
+   {
+      /// @brief Elements reduced by one task
+      /// @details Blocks are fixed, and partial results are always combined in block order,
+      ///    so a reduction returns the same bits whatever the policy or thread count.
+      inline constexpr std::size_t block_size = 4096;
+
+      /// @brief Independent accumulators within a block, held in one simd_rep
+      inline constexpr std::size_t lanes = 8;
+
+      template<typename T>
+      using lane_vector = simd_rep<T, lanes>;
+
+      /// @brief Gather load(i) .. load(i + lanes - 1) into one vector
+      template<typename T, typename Load>
+      constexpr lane_vector<T> load_lanes(std::size_t i, const Load& load)
+      {
+         lane_vector<T> values;
+         for (std::size_t j = 0; j < lanes; ++j) { values.set(j, load(i + j)); }
+         return values;
+      }
+
+      /// @brief Fewest blocks given to each thread
+      inline constexpr std::size_t min_blocks_per_thread = 16;
+
+      inline std::size_t thread_count(const execution::sequenced_policy&, std::size_t)
+      {
+         return 1;
+      }
+
+      inline std::size_t thread_count(const execution::parallel_policy& policy, std::size_t blocks)
+      {
+         const std::size_t available = policy.threads != 0 ? policy.threads : std::thread::hardware_concurrency();
+         return std::max<std::size_t>(1, std::min(available, blocks / min_blocks_per_thread));
+      }
+
+      /// @brief Reduce every block of [0, count) with reduce_block(begin, end), in parallel if the policy allows
+      /// @return One partial result per block, in block order
+      template<typename Partial, execution::execution_policy Policy, typename F>
+      std::vector<Partial> reduce_blocks(const Policy& policy, std::size_t count, const F& reduce_block)
+      {
+         const std::size_t blocks = (count + block_size - 1) / block_size;
+         std::vector<Partial> partials(blocks);
+
+         const auto run = [&](std::size_t first, std::size_t last)
+         {
+            for (std::size_t b = first; b < last; ++b)
+            {
+               partials[b] = reduce_block(b * block_size, std::min(count, (b + 1) * block_size));
+            }
+         };
+
+         const std::size_t threads = thread_count(policy, blocks);
+         if (threads == 1)
+         {
+            run(0, blocks);
+            return partials;
+         }
+
+         std::exception_ptr error;
+         std::mutex error_mutex;
+         {
+            std::vector<std::jthread> workers;
+            workers.reserve(threads - 1);
+
+            const std::size_t per_thread = blocks / threads;
+            const std::size_t remainder = blocks % threads;
+            std::size_t first = 0;
+            for (std::size_t t = 0; t < threads; ++t)
+            {
+               const std::size_t last = first + per_thread + (t < remainder ? 1 : 0);
+               const auto task = [&, first, last]
+               {
+                  try
+                  {
+                     run(first, last);
+                  }
+                  catch (...)
+                  {
+                     const std::lock_guard<std::mutex> lock(error_mutex);
+                     if (!error) { error = std::current_exception(); }
+                  }
+               };
+
+               // The calling thread takes the last range
+               if (t + 1 == threads) { task(); }
+               else { workers.emplace_back(task); }
+               first = last;
+            }
+         } // Workers join here
+
+         if (error)
+         {
+            std::rethrow_exception(error);
+         }
+         return partials;
+      }
+
+      /// @brief Running sum with its Neumaier compensation term
+      template<typename T>
+      struct sum_partial
+      {
+         T sum{};
+         T compensation{};
+      };
+
+      /// @brief Exact rounding error of sum + value, without branches (Knuth's TwoSum)
+      template<typename T>
+      constexpr T two_sum_error(const T& sum, const T& value, const T& total)
+      {
+         const T value_part = total - sum;
+         return (sum - (total - value_part)) + (value - value_part);
+      }
+
+      template<summation Method, typename T>
+      constexpr void accumulate(T& sum, T& compensation, T value)
+      {
+         const T total = sum + value;
+         if constexpr (Method == summation::neumaier && std::is_floating_point_v<T>)
+         {
+            compensation += two_sum_error(sum, value, total);
+         }
+         else
+         {
+            static_cast<void>(compensation);
+         }
+         sum = total;
+      }
+
+      template<summation Method, typename T>
+      constexpr void merge(sum_partial<T>& into, const sum_partial<T>& from)
+      {
+         accumulate<Method>(into.sum, into.compensation, from.sum);
+         into.compensation += from.compensation;
+      }
+
+      /// @brief Sums and compensations of each lane
+      template<typename T>
+      struct lane_sums
+      {
+         lane_vector<T> sums;
+         lane_vector<T> compensations;
+      };
+
+      /// @brief Add every full group of lanes from index onwards, leaving index at the tail
+      /// @details Kept apart from the scalar tail and lane merge in sum_block, which otherwise
+      ///    stop the compiler keeping the accumulators in vector registers.
+      template<summation Method, typename T, typename Load>
+      lane_sums<T> sum_lanes(std::size_t& index, std::size_t end, const Load& load)
+      {
+         lane_vector<T> sums(T{0});
+         lane_vector<T> compensations(T{0});
+         for (; index + lanes <= end; index += lanes)
+         {
+            const auto values = load_lanes<T>(index, load);
+            const auto totals = sums + values;
+            if constexpr (Method == summation::neumaier && std::is_floating_point_v<T>)
+            {
+               compensations += two_sum_error(sums, values, totals);
+            }
+            sums = totals;
+         }
+         return lane_sums<T>{sums, compensations};
+      }
+
+      /// @brief Sum load(i) over [begin, end) in fixed lanes, merged pairwise
+      template<summation Method, typename T, typename Load>
+      sum_partial<T> sum_block(std::size_t begin, std::size_t end, const Load& load)
+      {
+         std::size_t i = begin;
+         const auto vectors = sum_lanes<Method, T>(i, end, load);
+
+         sum_partial<T> lane_partials[lanes];
+         for (std::size_t j = 0; j < lanes; ++j)
+         {
+            lane_partials[j] = sum_partial<T>{vectors.sums[j], vectors.compensations[j]};
+         }
+         for (; i < end; ++i)
+         {
+            accumulate<Method>(lane_partials[0].sum, lane_partials[0].compensation, load(i));
+         }
+         for (std::size_t width = lanes / 2; width > 0; width /= 2)
+         {
+            for (std::size_t j = 0; j < width; ++j)
+            {
+               merge<Method>(lane_partials[j], lane_partials[j + width]);
+            }
+         }
+         return lane_partials[0];
+      }
+
+      /// @brief Sum load(i) over [0, count), as a tree of blocks and lanes
+      template<summation Method, typename T, execution::execution_policy Policy, typename Load>
+      T sum(const Policy& policy, std::size_t count, const Load& load)
+      {
+         const auto partials = reduce_blocks<sum_partial<T>>(policy, count,
+            [&](std::size_t begin, std::size_t end) { return sum_block<Method, T>(begin, end, load); });
+
+         sum_partial<T> total{};
+         for (const auto& partial : partials)
+         {
+            merge<Method>(total, partial);
+         }
+         return total.sum + total.compensation;
+      }
+
+      /// @brief Count the elements of [0, count) for which test(i) holds
+      template<execution::execution_policy Policy, typename Test>
+      std::size_t count(const Policy& policy, std::size_t count, const Test& test)
+      {
+         const auto partials = reduce_blocks<std::size_t>(policy, count,
+            [&](std::size_t begin, std::size_t end)
+            {
+               std::size_t matches = 0;
+               for (std::size_t i = begin; i < end; ++i)
+               {
+                  matches += static_cast<std::size_t>(test(i));
+               }
+               return matches;
+            });
+
+         std::size_t total = 0;
+         for (const std::size_t partial : partials)
+         {
+            total += partial;
+         }
+         return total;
+      }
+
+      template<typename T>
+      void require_not_empty(const T& values, const char* message)
+      {
+         if (values.size() == 0)
+         {
+            throw std::invalid_argument(message);
+         }
+      }
+   }
+
+   /// @brief Comparison of each element against a fixed dimension value
+   /// @details Reductions convert the threshold to the units of the array once, then compare
+   ///    raw values. Called directly with a dimension, the comparison converts as usual.
+   /// @tparam Dim The dimension type of the threshold
+   /// @tparam Compare Comparison applied as Compare{}(element, threshold)
+   template<is_base_dimension Dim, typename Compare>
+   class threshold_predicate
+   {
+   public:
+      using dimension_type = Dim;
+
+      constexpr explicit threshold_predicate(const Dim& value) : threshold(value) {}
+
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      [[nodiscard]] constexpr bool operator()(const Other& value) const
+      {
+         return Compare{}(get_dimension_tuple<typename Dim::units>(value), get_dimension_tuple<typename Dim::units>(threshold));
+      }
+
+      /// @brief The threshold as a raw value of an element of type Target
+      /// @details For an integral Rep the threshold is rounded in the direction which keeps the
+      ///    comparison exact, up for < and >=, down for > and <=. If the rounded threshold lies
+      ///    outside the range of the Rep, uniform_result gives the outcome instead.
+      template<is_base_dimension Target>
+      requires matching_dimensions<Dim, Target>
+      [[nodiscard]] constexpr typename Target::rep raw_threshold() const
+      {
+         using target_rep = typename Target::rep;
+         if constexpr (std::is_integral_v<target_rep>)
+         {
+            return exact_detail::round_to<integral_rounding, overflow::saturate, target_rep>(precise_threshold<Target>());
+         }
+         else
+         {
+            return static_cast<target_rep>(get_dimension_tuple<typename Target::units>(threshold) / coefficient_factor_v<Target>);
+         }
+      }
+
+      /// @brief The outcome for every element of type Target, when the threshold lies outside the range of its Rep
+      /// @return true or false if every element compares the same way, otherwise std::nullopt
+      template<is_base_dimension Target>
+      requires matching_dimensions<Dim, Target>
+      [[nodiscard]] constexpr std::optional<bool> uniform_result() const
+      {
+         using target_rep = typename Target::rep;
+         if constexpr (std::is_integral_v<target_rep>)
+         {
+            const PrecisionType precise = precise_threshold<Target>();
+            const PrecisionType bound = integral_rounding == rounding::up ? std::ceil(precise) : std::floor(precise);
+
+            // Above every element, < and <= always hold. Below every element, they never do.
+            constexpr bool holdsAbove = std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less_equal<>>;
+            if (std::isnan(bound))
+            {
+               return false;
+            }
+            if (bound > static_cast<PrecisionType>(std::numeric_limits<target_rep>::max()))
+            {
+               return holdsAbove;
+            }
+            if (bound < static_cast<PrecisionType>(std::numeric_limits<target_rep>::min()))
+            {
+               return !holdsAbove;
+            }
+         }
+         return std::nullopt;
+      }
+
+      /// @brief Compare two raw values in the same units
+      template<typename T>
+      [[nodiscard]] static constexpr bool compare(const T& value, const T& bound)
+      {
+         return Compare{}(value, bound);
+      }
+
+   private:
+      // x < t is x < ceil(t) and x >= t is x >= ceil(t) for integral x, while > and <= round down
+      static constexpr rounding integral_rounding =
+         std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::greater_equal<>> ? rounding::up : rounding::down;
+
+      template<is_base_dimension Target>
+      [[nodiscard]] constexpr PrecisionType precise_threshold() const
+      {
+         constexpr PrecisionType factor = coefficient_factor_v<Dim> * conversion_factor_v<typename Dim::units, typename Target::units> /
+                                          coefficient_factor_v<Target>;
+         return static_cast<PrecisionType>(threshold.template get_tuple_scalar<typename Dim::units>()) * factor;
+      }
+
+      Dim threshold;
+   };
+
+   template<typename T>
+   struct is_threshold_predicate : std::false_type {};
+
+   template<typename Dim, typename Compare>
+   struct is_threshold_predicate<threshold_predicate<Dim, Compare>> : std::true_type {};
+
+   /// @brief Predicate holding for elements greater than value
+   template<is_base_dimension Dim>
+   [[nodiscard]] constexpr auto greater_than(const Dim& value) { return threshold_predicate<Dim, std::greater<>>(value); }
+
+   /// @brief Predicate holding for elements greater than or equal to value
+   template<is_base_dimension Dim>
+   [[nodiscard]] constexpr auto greater_equal(const Dim& value) { return threshold_predicate<Dim, std::greater_equal<>>(value); }
+
+   /// @brief Predicate holding for elements less than value
+   template<is_base_dimension Dim>
+   [[nodiscard]] constexpr auto less_than(const Dim& value) { return threshold_predicate<Dim, std::less<>>(value); }
+
+   /// @brief Predicate holding for elements less than or equal to value
+   template<is_base_dimension Dim>
+   [[nodiscard]] constexpr auto less_equal(const Dim& value) { return threshold_predicate<Dim, std::less_equal<>>(value); }
+
+   /// @brief Sum of every element, in the units of the array
+   /// @details Raw values are summed directly, without a conversion per element. The array is
+   ///    split into fixed blocks of independent accumulators which are merged pairwise, so the
+   ///    result does not depend on the policy or the number of threads.
+   /// @tparam Method summation::neumaier to compensate for rounding error, summation::standard by default
+   /// @param policy execution::seq or execution::par
+   /// @param values The array to sum
+   /// @return The sum, zero for an empty array
+   template<summation Method = summation::standard, execution::execution_policy Policy, is_base_dimension Dim, typename Allocator>
+   [[nodiscard]] Dim sum(const Policy& policy, const dimension_array<Dim, Allocator>& values)
+   {
+      using rep = typename Dim::rep;
+      const rep* const data = values.data();
+      return Dim(reduction_detail::sum<Method, rep>(policy, values.size(), [data](std::size_t i) { return data[i]; }));
+   }
+
+   template<summation Method = summation::standard, is_base_dimension Dim, typename Allocator>
+   [[nodiscard]] Dim sum(const dimension_array<Dim, Allocator>& values)
+   {
+      return sum<Method>(execution::seq, values);
+   }
+
+   /// @brief Arithmetic mean of every element, in the units of the array
+   /// @throws std::invalid_argument if values is empty
+   template<summation Method = summation::standard, execution::execution_policy Policy, is_base_dimension Dim, typename Allocator>
+   [[nodiscard]] Dim mean(const Policy& policy, const dimension_array<Dim, Allocator>& values)
+   {
+      using rep = typename Dim::rep;
+      reduction_detail::require_not_empty(values, "mean of an empty dimension_array");
+
+      const rep* const data = values.data();
+      const rep total = reduction_detail::sum<Method, rep>(policy, values.size(), [data](std::size_t i) { return data[i]; });
+      return Dim(static_cast<rep>(total / static_cast<rep>(values.size())));
+   }
+
+   template<summation Method = summation::standard, is_base_dimension Dim, typename Allocator>
+   [[nodiscard]] Dim mean(const dimension_array<Dim, Allocator>& values)
+   {
+      return mean<Method>(execution::seq, values);
+   }
+
+   /// @brief Smallest and largest element, in the units of the array
+   /// @details The result is unspecified if the array holds NaN.
+   /// @throws std::invalid_argument if values is empty
+   template<execution::execution_policy Policy, is_base_dimension Dim, typename Allocator>
+   [[nodiscard]] std::pair<Dim, Dim> minmax(const Policy& policy, const dimension_array<Dim, Allocator>& values)
+   {
+      using rep = typename Dim::rep;
+      using bounds = std::pair<rep, rep>;
+      reduction_detail::require_not_empty(values, "minmax of an empty dimension_array");
+
+      const rep* const data = values.data();
+      const auto partials = reduction_detail::reduce_blocks<bounds>(policy, values.size(),
+         [data](std::size_t begin, std::size_t end)
+         {
+            using vector = reduction_detail::lane_vector<rep>;
+            const auto load = [data](std::size_t i) { return data[i]; };
+
+            vector lows(data[begin]);
+            vector highs(data[begin]);
+            std::size_t i = begin;
+            for (; i + reduction_detail::lanes <= end; i += reduction_detail::lanes)
+            {
+               const auto group = reduction_detail::load_lanes<rep>(i, load);
+               lows = min(lows, group);
+               highs = max(highs, group);
+            }
+
+            bounds result{lows[0], highs[0]};
+            for (std::size_t j = 1; j < reduction_detail::lanes; ++j)
+            {
+               result.first = lows[j] < result.first ? lows[j] : result.first;
+               result.second = highs[j] > result.second ? highs[j] : result.second;
+            }
+            for (; i < end; ++i)
+            {
+               result.first = data[i] < result.first ? data[i] : result.first;
+               result.second = data[i] > result.second ? data[i] : result.second;
+            }
+            return result;
+         });
+
+      bounds total{data[0], data[0]};
+      for (const auto& partial : partials)
+      {
+         total.first = partial.first < total.first ? partial.first : total.first;
+         total.second = partial.second > total.second ? partial.second : total.second;
+      }
+      return {Dim(total.first), Dim(total.second)};
+   }
+
+   template<is_base_dimension Dim, typename Allocator>
+   [[nodiscard]] std::pair<Dim, Dim> minmax(const dimension_array<Dim, Allocator>& values)
+   {
+      return minmax(execution::seq, values);
+   }
+
+   /// @brief Sum of the element-wise products of two arrays
+   /// @details The result has the dimension of the product of an element of each array,
+   ///    so the dot product of a force array and a length array is an energy.
+   ///    Raw values are multiplied directly, in the units of each array.
+   /// @throws std::invalid_argument if the arrays are not the same size
+   template<summation Method = summation::standard, execution::execution_policy Policy,
+            is_base_dimension LhsDim, typename LhsAlloc, is_base_dimension RhsDim, typename RhsAlloc>
+   [[nodiscard]] auto dot(const Policy& policy, const dimension_array<LhsDim, LhsAlloc>& lhs, const dimension_array<RhsDim, RhsAlloc>& rhs)
+   {
+      // operator* between two dimensions multiplies their raw values, the product type is reused as is
+      using result_type = decltype(std::declval<LhsDim>() * std::declval<RhsDim>());
+      using rep = typename result_type::rep;
+
+      if (lhs.size() != rhs.size())
+      {
+         throw std::invalid_argument("dot operands must be the same size");
+      }
+
+      const auto* const left = lhs.data();
+      const auto* const right = rhs.data();
+      return result_type(reduction_detail::sum<Method, rep>(policy, lhs.size(),
+         [left, right](std::size_t i) { return static_cast<rep>(left[i]) * static_cast<rep>(right[i]); }));
+   }
+
+   template<summation Method = summation::standard, is_base_dimension LhsDim, typename LhsAlloc, is_base_dimension RhsDim, typename RhsAlloc>
+   [[nodiscard]] auto dot(const dimension_array<LhsDim, LhsAlloc>& lhs, const dimension_array<RhsDim, RhsAlloc>& rhs)
+   {
+      return dot<Method>(execution::seq, lhs, rhs);
+   }
+
+   /// @brief Euclidean norm, the square root of the sum of squared elements, in the units of the array
+   template<summation Method = summation::standard, execution::execution_policy Policy, is_base_dimension Dim, typename Allocator>
+   [[nodiscard]] Dim norm(const Policy& policy, const dimension_array<Dim, Allocator>& values)
+   {
+      using rep = typename Dim::rep;
+      const rep* const data = values.data();
+      const rep squares = reduction_detail::sum<Method, rep>(policy, values.size(), [data](std::size_t i) { return data[i] * data[i]; });
+      return Dim(static_cast<rep>(std::sqrt(squares)));
+   }
+
+   template<summation Method = summation::standard, is_base_dimension Dim, typename Allocator>
+   [[nodiscard]] Dim norm(const dimension_array<Dim, Allocator>& values)
+   {
+      return norm<Method>(execution::seq, values);
+   }
+
+   /// @brief Number of elements for which pred holds
+   /// @details Threshold predicates such as greater_than(length<meters>(5.0)) are converted to the
+   ///    units of the array once and compared against raw values. Any other predicate is called
+   ///    with each element as a Dim.
+   template<execution::execution_policy Policy, is_base_dimension Dim, typename Allocator, typename Predicate>
+   [[nodiscard]] std::size_t count_if(const Policy& policy, const dimension_array<Dim, Allocator>& values, const Predicate& pred)
+   {
+      using rep = typename Dim::rep;
+      const rep* const data = values.data();
+
+      if constexpr (is_threshold_predicate<Predicate>::value)
+      {
+         if (const std::optional<bool> uniform = pred.template uniform_result<Dim>())
+         {
+            return *uniform ? values.size() : 0;
+         }
+         const rep bound = pred.template raw_threshold<Dim>();
+         return reduction_detail::count(policy, values.size(),
+            [data, bound](std::size_t i) { return Predicate::compare(data[i], bound); });
+      }
+      else
+      {
+         return reduction_detail::count(policy, values.size(),
+            [data, &pred](std::size_t i) { return static_cast<bool>(pred(Dim(data[i]))); });
+      }
+   }
+
+   template<is_base_dimension Dim, typename Allocator, typename Predicate>
+   [[nodiscard]] std::size_t count_if(const dimension_array<Dim, Allocator>& values, const Predicate& pred)
+   {
+      return count_if(execution::seq, values, pred);
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_REDUCTIONS_H
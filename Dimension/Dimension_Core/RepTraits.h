@@ -0,0 +1,123 @@
+#ifndef DIMENSION_REP_TRAITS_H
+#define DIMENSION_REP_TRAITS_H
+
+#include <cmath> // For std::hypot
+#include <cstddef> // For std::size_t
+#include <type_traits>
+#include <utility> // For std::declval
+
+#include "PrecisionType.h"
+
+namespace dimension
+{
+
+   template<typename T, std::size_t N>
+   class simd_rep;
+
+   /// @brief Check if a type is a simd_rep
+   template<typename T>
+   struct is_simd_rep : std::false_type {};
+
+   template<typename T, std::size_t N>
+   struct is_simd_rep<simd_rep<T, N>> : std::true_type {};
+
+   template<typename T>
+   inline constexpr bool is_simd_rep_v = is_simd_rep<std::remove_cvref_t<T>>::value;
+
+   /// @brief Concept for a unitless value which can scale a dimension, either arithmetic or a simd_rep
+   template<typename T>
+   concept scalar_operand = std::is_arithmetic_v<std::remove_cvref_t<T>> || is_simd_rep_v<T>;
+
+   /// @brief Rep of a dimension with Rep scaled by a scalar of type Scalar
+   /// @details Floating-point and simd Reps keep their own precision when scaled by an
+   ///    arithmetic scalar, so a float dimension times 2.0 stays float. Other combinations,
+   ///    such as an integral Rep scaled by a double, follow the usual arithmetic conversions.
+   template<typename Rep, typename Scalar>
+   using scaled_rep_t = std::conditional_t<
+      std::is_arithmetic_v<std::remove_cvref_t<Scalar>> && !std::is_integral_v<Rep>,
+      Rep,
+      decltype(std::declval<Rep>() * std::declval<Scalar>())
+   >;
+
+   /// @brief Operations on a Rep which cannot be written with its arithmetic operators alone
+   /// @details The primary template covers arithmetic types and any other single-value Rep.
+   ///    Specialize this for custom Rep types which hold several lanes or need their own math.
+   /// @tparam Rep The representation type of a dimension
+   template<typename Rep>
+   struct rep_traits
+   {
+      /// @brief The type of a single element of Rep
+      using value_type = Rep;
+
+      /// @brief Number of values processed by one operation on Rep
+      static constexpr std::size_t lanes = 1;
+
+      /// @brief Multiply a value by a compile-time factor
+      /// @details Floating-point values are scaled at their own precision,
+      ///    integral values are scaled at PrecisionType and truncated.
+      static constexpr Rep scale(const Rep& value, PrecisionType factor)
+      {
+         if constexpr (std::is_integral_v<Rep>)
+         {
+            return static_cast<Rep>(static_cast<PrecisionType>(value) * factor);
+         }
+         else
+         {
+            return value * static_cast<Rep>(factor);
+         }
+      }
+
+      static constexpr Rep abs(const Rep& value)
+      {
+         return value < Rep{0} ? -value : value;
+      }
+
+      /// @brief Round down, constexpr for values within the range of int
+      static constexpr Rep floor(const Rep& value)
+      {
+         if constexpr (std::is_integral_v<Rep>)
+         {
+            return value;
+         }
+         else
+         {
+            return static_cast<Rep>(static_cast<int>(value) - (value < static_cast<int>(value)));
+         }
+      }
+
+      /// @brief Round up, constexpr for values within the range of int
+      static constexpr Rep ceil(const Rep& value)
+      {
+         if constexpr (std::is_integral_v<Rep>)
+         {
+            return value;
+         }
+         else
+         {
+            return static_cast<Rep>(static_cast<int>(value) + (value > static_cast<int>(value)));
+         }
+      }
+
+      /// @brief Round half up, constexpr for values within the range of int
+      static constexpr Rep round(const Rep& value)
+      {
+         if constexpr (std::is_integral_v<Rep>)
+         {
+            return value;
+         }
+         else
+         {
+            const auto floor_val = static_cast<Rep>(static_cast<int>(value));
+            return (value - floor_val < static_cast<Rep>(0.5)) ? floor_val : floor_val + Rep{1};
+         }
+      }
+
+      static Rep hypot(const Rep& lhs, const Rep& rhs)
+      {
+         return static_cast<Rep>(std::hypot(lhs, rhs));
+      }
+   };
+
+} // end Dimension
+
+#endif // DIMENSION_REP_TRAITS_H
@@ -1,6 +1,8 @@
 #ifndef DIMENSION_SI_MACRO_H
 #define DIMENSION_SI_MACRO_H
 
+#include <ratio>
+
 namespace dimension
 {
     // Macro for SI prefixes
@@ -17,28 +19,29 @@ namespace dimension
     struct giga {};
     struct tera {};
 
-    // SI prefix factors
+    // SI prefix factors, as a double and as an exact std::ratio
     template <typename Prefix>
     struct SIFactor;
 
-    #define DEFINE_SI_FACTOR(Prefix, Factor) \
+    #define DEFINE_SI_FACTOR(Prefix, Factor, Ratio) \
     template <> struct SIFactor<Prefix> { \
         static constexpr double value = Factor; \
+        using ratio = Ratio; \
     };
 
     // Define the conversion factors for SI prefixes
-    DEFINE_SI_FACTOR(pico, 1e-12)
-    DEFINE_SI_FACTOR(nano, 1e-9)
-    DEFINE_SI_FACTOR(micro, 1e-6)
-    DEFINE_SI_FACTOR(milli, 1e-3)
-    DEFINE_SI_FACTOR(centi, 1e-2)
-    DEFINE_SI_FACTOR(deci, 1e-1)
-    DEFINE_SI_FACTOR(deca, 1e1)
-    DEFINE_SI_FACTOR(hecto, 1e2)
-    DEFINE_SI_FACTOR(kilo, 1e3)
-    DEFINE_SI_FACTOR(mega, 1e6)
-    DEFINE_SI_FACTOR(giga, 1e9)
-    DEFINE_SI_FACTOR(tera, 1e12)
+    DEFINE_SI_FACTOR(pico, 1e-12, std::pico)
+    DEFINE_SI_FACTOR(nano, 1e-9, std::nano)
+    DEFINE_SI_FACTOR(micro, 1e-6, std::micro)
+    DEFINE_SI_FACTOR(milli, 1e-3, std::milli)
+    DEFINE_SI_FACTOR(centi, 1e-2, std::centi)
+    DEFINE_SI_FACTOR(deci, 1e-1, std::deci)
+    DEFINE_SI_FACTOR(deca, 1e1, std::deca)
+    DEFINE_SI_FACTOR(hecto, 1e2, std::hecto)
+    DEFINE_SI_FACTOR(kilo, 1e3, std::kilo)
+    DEFINE_SI_FACTOR(mega, 1e6, std::mega)
+    DEFINE_SI_FACTOR(giga, 1e9, std::giga)
+    DEFINE_SI_FACTOR(tera, 1e12, std::tera)
 /*
     #define STRINGIFY(x) #x
     #define CONCAT_AND_STRINGIFY(x, y) STRINGIFY(x##y)
@@ -57,8 +60,8 @@ namespace dimension
 
     #define SI_PREFIX(baseName, baseAbbr, UnitType, Prefix, Abbr) \
     struct CONCAT3(Prefix, _, baseName) : public UnitType<CONCAT3(Prefix, _, baseName), CONCAT_AND_STRINGIFY(Prefix, baseName), Abbr baseAbbr> { public: using UnitType::UnitType; }; \
-    template<> struct Conversion<baseName, CONCAT3(Prefix, _, baseName)> { static constexpr PrecisionType slope = 1.0 / SIFactor<Prefix>::value; }; \
-    template<> struct Conversion<CONCAT3(Prefix, _, baseName), baseName> { static constexpr PrecisionType slope = SIFactor<Prefix>::value; };
+    template<> struct Conversion<baseName, CONCAT3(Prefix, _, baseName)> { static constexpr PrecisionType slope = 1.0 / SIFactor<Prefix>::value; using ratio = std::ratio_divide<std::ratio<1>, SIFactor<Prefix>::ratio>; }; \
+    template<> struct Conversion<CONCAT3(Prefix, _, baseName), baseName> { static constexpr PrecisionType slope = SIFactor<Prefix>::value; using ratio = SIFactor<Prefix>::ratio; };
 
 
     #define ALL_SI_PREFIXES(baseName, baseAbbr, UnitType) \
@@ -2,6 +2,7 @@
 #define DIMENSION_SERIALIZATION_H
 
 #include <cstring>
+#include <span>
 #include <vector>
 
 #include "StringLiteral.h"
@@ -60,6 +61,30 @@ namespace dimension
       {
          return Policy::template deserialize<Dim, InputBuf>(in, obj);
       }
+
+      /// @brief serialize a block of base_dimension objects into a passed buffer
+      /// @details Requires a block policy such as BlockSerializationPolicy
+      /// @tparam OutputBuf The buffer type
+      /// @param out The buffer to serialize into
+      /// @param objs The objects to serialize
+      /// @return The number of bytes written
+      template<typename OutputBuf>
+      static std::size_t serialize(OutputBuf&& out, std::span<const Dim> objs)
+      {
+         return Policy::template serialize<Dim>(out, objs);
+      }
+
+      /// @brief deserialize a block into base_dimension objects
+      /// @details Requires a block policy such as BlockSerializationPolicy
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer to deserialize
+      /// @param objs Destination for the objects
+      /// @return The number of objects read
+      template <typename InputBuf>
+      static std::size_t deserialize(const InputBuf& in, std::span<Dim> objs)
+      {
+         return Policy::template deserialize<Dim>(in, objs);
+      }
    };
 
    /// @brief serialize a base_dimension object into a passed buffer
@@ -101,6 +126,72 @@ namespace dimension
       return Serializer<Dim, Policy>::deserialize(in);
    }
 
+   /// @brief serialize a block of base_dimension objects into a caller-provided buffer
+   /// @details The tag and count are written once, followed by the packed values. Nothing is allocated.
+   /// @tparam Dim The dimension type to serialize
+   /// @tparam OutputBuf The buffer type, any contiguous range such as std::span<std::byte> or std::array
+   /// @tparam Policy Block serialization policy
+   /// @param out The buffer to serialize into
+   /// @param objs The objects to serialize
+   /// @return The number of bytes written
+   template <is_base_dimension Dim, typename OutputBuf, typename Policy = BlockSerializationPolicy<FNV_1a_32Bit>>
+   std::size_t serialize_block(OutputBuf&& out, std::span<const Dim> objs)
+   {
+      return Policy::template serialize<Dim>(out, objs);
+   }
+
+   /// @brief serialize a block of raw values in the units of Dim into a caller-provided buffer
+   /// @details Intended for the storage of a dimension_array, through values()
+   /// @tparam Dim The dimension type of the values
+   /// @tparam OutputBuf The buffer type, any contiguous range such as std::span<std::byte> or std::array
+   /// @tparam Policy Block serialization policy
+   /// @param out The buffer to serialize into
+   /// @param values The values to serialize
+   /// @return The number of bytes written
+   template <is_base_dimension Dim, typename OutputBuf, typename Policy = BlockSerializationPolicy<FNV_1a_32Bit>>
+   std::size_t serialize_block(OutputBuf&& out, std::span<const typename Dim::rep> values)
+   {
+      return Policy::template serialize<Dim>(out, values);
+   }
+
+   /// @brief Validate the header of a serialized block and return its number of values
+   /// @tparam Dim The dimension type expected in the block
+   /// @tparam InputBuf The buffer type
+   /// @tparam Policy Block serialization policy
+   /// @param in The buffer holding the block
+   /// @return The number of values in the block
+   template <is_base_dimension Dim, typename InputBuf, typename Policy = BlockSerializationPolicy<FNV_1a_32Bit>>
+   [[nodiscard]] std::size_t block_count(const InputBuf& in)
+   {
+      return Policy::template count<Dim>(in);
+   }
+
+   /// @brief deserialize a block into caller-provided base_dimension objects
+   /// @tparam Dim The dimension type expected in the block
+   /// @tparam InputBuf The buffer type
+   /// @tparam Policy Block serialization policy
+   /// @param in The buffer holding the block
+   /// @param objs Destination for the objects
+   /// @return The number of objects read
+   template <is_base_dimension Dim, typename InputBuf, typename Policy = BlockSerializationPolicy<FNV_1a_32Bit>>
+   std::size_t deserialize_block(const InputBuf& in, std::span<Dim> objs)
+   {
+      return Policy::template deserialize<Dim>(in, objs);
+   }
+
+   /// @brief deserialize a block into caller-provided raw values in the units of Dim
+   /// @tparam Dim The dimension type expected in the block
+   /// @tparam InputBuf The buffer type
+   /// @tparam Policy Block serialization policy
+   /// @param in The buffer holding the block
+   /// @param values Destination for the values
+   /// @return The number of values read
+   template <is_base_dimension Dim, typename InputBuf, typename Policy = BlockSerializationPolicy<FNV_1a_32Bit>>
+   std::size_t deserialize_block(const InputBuf& in, std::span<typename Dim::rep> values)
+   {
+      return Policy::template deserialize<Dim>(in, values);
+   }
+
 } // end Dimension
 
 #endif // DIMENSION_SERIALIZATION_H
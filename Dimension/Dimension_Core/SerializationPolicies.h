@@ -1,8 +1,15 @@
 #ifndef DIMENSION_SERIALIZATION_POLICIES_H
 #define DIMENSION_SERIALIZATION_POLICIES_H
 
+#include <cstddef> // For std::byte, std::size_t
+#include <cstdint> // For std::uint32_t
 #include <cstring>
 #include <concepts>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept> // For std::invalid_argument
+#include <type_traits>
 #include <vector>
 
 #include "StringLiteral.h"
@@ -36,6 +43,7 @@ namespace dimension
    }
 
    /// @brief Default serialization policy
+   /// @details Writes the type tag followed by the raw Rep value in the units of Dim, in native byte order.
    /// @tparam HashPolicy Policy used to hash the type into a tag to serialize alongside the data
    template<typename HashPolicy>
    struct DefaultSerializationPolicy
@@ -51,13 +59,13 @@ namespace dimension
             out += (HashPolicy::tag_size / sizeof(BufferSizeType));
          }
 
-         // Write the double scalar
-         PrecisionType temp = get_dimension_tuple<typename Dim::units>(obj);
-         std::memcpy(&*out, &temp, sizeof(PrecisionType));
+         // Stored raw, without the coefficients, as deserialize and tag_registry expect
+         const typename Dim::rep value = obj.template get_tuple_scalar<typename Dim::units>();
+         std::memcpy(&*out, &value, sizeof(value));
       }
 
       template <is_base_dimension Dim, typename InputIt, typename BufferSizeType>
-      static PrecisionType deserialize_impl(InputIt in)
+      static typename Dim::rep deserialize_impl(InputIt in)
       {
          if (!validateTag<Dim, InputIt, HashPolicy>(in))
          {
@@ -66,7 +74,7 @@ namespace dimension
 
          in += (HashPolicy::tag_size / sizeof(BufferSizeType));
 
-         double val;
+         typename Dim::rep val;
          std::memcpy(&val, &*in, sizeof(val));
 
          return val;
@@ -82,7 +90,8 @@ namespace dimension
       template <is_base_dimension Dim, typename OutputBuf>
       static void serialize(OutputBuf& out, const Dim& obj)
       {
-         constexpr size_t required_size = HashPolicy::tag_size + sizeof(PrecisionType);
+         static_assert(std::is_trivially_copyable_v<typename Dim::rep>, "Serialization requires a trivially copyable Rep");
+         constexpr size_t required_size = HashPolicy::tag_size + sizeof(typename Dim::rep);
 
          if (out.size() * sizeof(typename OutputBuf::value_type) < required_size)
          {
@@ -101,8 +110,9 @@ namespace dimension
       static OutputBuf serialize(const Dim& obj)
       {
          // Generate the unique type tag based on `NumTuple` and `DenTuple`
+         static_assert(std::is_trivially_copyable_v<typename Dim::rep>, "Serialization requires a trivially copyable Rep");
          OutputBuf out;
-         out.resize(HashPolicy::tag_size + sizeof(PrecisionType));
+         out.resize(HashPolicy::tag_size + sizeof(typename Dim::rep));
 
          serialize_impl<Dim, decltype(out.begin()), typename OutputBuf::value_type>(out.begin(), obj);
 
@@ -118,12 +128,238 @@ namespace dimension
       template <is_base_dimension Dim, typename InputBuf>
       static Dim deserialize(const InputBuf& in)
       {
-         PrecisionType val = deserialize_impl<Dim, decltype(in.begin()), typename InputBuf::value_type>(in.begin());
+         const typename Dim::rep val = deserialize_impl<Dim, decltype(in.begin()), typename InputBuf::value_type>(in.begin());
          return Dim(val);
       }
 
    };
 
+   namespace serialization_detail
+   {
+      /// @brief View a caller supplied contiguous buffer as writable bytes
+      template <typename Buf>
+      std::span<std::byte> output_bytes(Buf& out)
+      {
+         static_assert(std::ranges::contiguous_range<Buf>, "Block serialization requires a contiguous output buffer");
+         return std::as_writable_bytes(std::span(std::ranges::data(out), std::ranges::size(out)));
+      }
+
+      /// @brief View a caller supplied contiguous buffer as bytes
+      template <typename Buf>
+      std::span<const std::byte> input_bytes(const Buf& in)
+      {
+         static_assert(std::ranges::contiguous_range<Buf>, "Block deserialization requires a contiguous input buffer");
+         return std::as_bytes(std::span(std::ranges::data(in), std::ranges::size(in)));
+      }
+
+      /// @brief Throw std::invalid_argument for a malformed block
+      /// @details Kept out of line so the checks below stay small enough to inline, which lets the compiler
+      ///   see the buffer bounds they establish at the copies that follow.
+      [[noreturn]] inline void block_error(const char* message)
+      {
+         throw std::invalid_argument(message);
+      }
+
+      /// @brief Check that count values fit the uint32_t count of a block header and that the block fits the buffer
+      /// @param count The number of values to write
+      /// @param available The size of the output buffer in bytes
+      /// @param required The size of the block in bytes
+      inline void check_block_output(std::size_t count, std::size_t available, std::size_t required)
+      {
+         if (count > std::numeric_limits<std::uint32_t>::max())
+         {
+            block_error("Block serialization supports at most 2^32 - 1 values per block.");
+         }
+         if (available < required)
+         {
+            block_error("Buffer size is too small for the serialized block.");
+         }
+      }
+
+      /// @brief Check that the input buffer holds a whole block header
+      inline void check_block_header(std::size_t available, std::size_t header_size)
+      {
+         if (available < header_size)
+         {
+            block_error("Buffer size is too small for a serialized block header.");
+         }
+      }
+
+      /// @brief Check that the input buffer holds every value its header announces
+      inline void check_block_input(std::size_t available, std::size_t required)
+      {
+         if (available < required)
+         {
+            block_error("Buffer is shorter than the serialized block.");
+         }
+      }
+
+      /// @brief Check that the destination holds every value of the block
+      inline void check_destination(std::size_t available, std::size_t count)
+      {
+         if (available < count)
+         {
+            block_error("Destination is too small for the serialized block.");
+         }
+      }
+   }
+
+   /// @brief Block serialization policy
+   /// @details Writes the type tag and element count once, followed by the packed Rep values.
+   ///   Layout: [tag (HashPolicy::tag_size bytes)][count (uint32_t)][count * sizeof(Rep) bytes].
+   ///   Values are written in the units of Dim and in native byte order, as in DefaultSerializationPolicy.
+   ///   Buffers are supplied by the caller as any contiguous range, such as std::span<std::byte>,
+   ///   std::array or std::vector, and are never resized, so no memory is allocated.
+   ///   The tag is validated once per block on deserialization.
+   /// @tparam HashPolicy Policy used to hash the type into a tag to serialize alongside the data
+   template<typename HashPolicy>
+   struct BlockSerializationPolicy
+   {
+      using count_type = std::uint32_t;
+
+      /// @brief Size in bytes of the tag and count preceding the values
+      static constexpr std::size_t header_size = HashPolicy::tag_size + sizeof(count_type);
+
+      /// @brief Size in bytes of a block holding count values of Dim
+      template <is_base_dimension Dim>
+      [[nodiscard]] static constexpr std::size_t block_size(std::size_t count) noexcept
+      {
+         return header_size + count * sizeof(typename Dim::rep);
+      }
+
+   private:
+      template <is_base_dimension Dim>
+      static std::byte* write_header(std::span<std::byte> bytes, std::size_t count)
+      {
+         serialization_detail::check_block_output(count, bytes.size(), block_size<Dim>(count));
+
+         std::byte* out = bytes.data();
+         if constexpr(!std::is_void_v<typename HashPolicy::tag_type::type>)
+         {
+            constexpr auto tagData = TypeTagHelper<Dim, HashPolicy>::value().get();
+            std::memcpy(out, &tagData, HashPolicy::tag_size);
+            out += HashPolicy::tag_size;
+         }
+
+         const auto blockCount = static_cast<count_type>(count);
+         std::memcpy(out, &blockCount, sizeof(count_type));
+         return out + sizeof(count_type);
+      }
+
+      template <is_base_dimension Dim>
+      static std::size_t read_header(std::span<const std::byte> bytes)
+      {
+         serialization_detail::check_block_header(bytes.size(), header_size);
+         if (!validateTag<Dim, const std::byte*, HashPolicy>(bytes.data()))
+         {
+            throw std::invalid_argument("Type tag mismatch during deserialization");
+         }
+
+         count_type count;
+         std::memcpy(&count, bytes.data() + HashPolicy::tag_size, sizeof(count_type));
+         serialization_detail::check_block_input(bytes.size(), block_size<Dim>(count));
+         return count;
+      }
+
+   public:
+      /// @brief serialize packed values in the units of Dim into a passed buffer
+      /// @tparam Dim The dimension type of the values
+      /// @tparam OutputBuf The buffer type
+      /// @param out The buffer to serialize into
+      /// @param values The values to serialize
+      /// @return The number of bytes written
+      template <is_base_dimension Dim, typename OutputBuf>
+      static std::size_t serialize(OutputBuf&& out, std::span<const typename Dim::rep> values)
+      {
+         static_assert(std::is_trivially_copyable_v<typename Dim::rep>, "Block serialization requires a trivially copyable Rep");
+
+         std::byte* data = write_header<Dim>(serialization_detail::output_bytes(out), values.size());
+         if (!values.empty())
+         {
+            std::memcpy(data, values.data(), values.size_bytes());
+         }
+         return block_size<Dim>(values.size());
+      }
+
+      /// @brief serialize a range of base_dimension objects into a passed buffer
+      /// @tparam Dim The dimension type to serialize
+      /// @tparam OutputBuf The buffer type
+      /// @param out The buffer to serialize into
+      /// @param objs The objects to serialize
+      /// @return The number of bytes written
+      template <is_base_dimension Dim, typename OutputBuf>
+      static std::size_t serialize(OutputBuf&& out, std::span<const Dim> objs)
+      {
+         using rep = typename Dim::rep;
+         static_assert(std::is_trivially_copyable_v<rep>, "Block serialization requires a trivially copyable Rep");
+
+         std::byte* data = write_header<Dim>(serialization_detail::output_bytes(out), objs.size());
+         for (const Dim& obj : objs)
+         {
+            // Stored raw, without the coefficients, as the value overloads and serialized_view expect
+            const rep value = obj.template get_tuple_scalar<typename Dim::units>();
+            std::memcpy(data, &value, sizeof(rep));
+            data += sizeof(rep);
+         }
+         return block_size<Dim>(objs.size());
+      }
+
+      /// @brief Validate the header of a serialized block and return its number of values
+      /// @tparam Dim The dimension type expected in the block
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @return The number of values in the block
+      template <is_base_dimension Dim, typename InputBuf>
+      [[nodiscard]] static std::size_t count(const InputBuf& in)
+      {
+         return read_header<Dim>(serialization_detail::input_bytes(in));
+      }
+
+      /// @brief deserialize a block into packed values in the units of Dim
+      /// @tparam Dim The dimension type expected in the block
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @param values Destination for the values. Must hold at least count<Dim>(in) values.
+      /// @return The number of values read
+      template <is_base_dimension Dim, typename InputBuf>
+      static std::size_t deserialize(const InputBuf& in, std::span<typename Dim::rep> values)
+      {
+         const std::span<const std::byte> bytes = serialization_detail::input_bytes(in);
+         const std::size_t blockCount = read_header<Dim>(bytes);
+         serialization_detail::check_destination(values.size(), blockCount);
+         if (blockCount > 0)
+         {
+            std::memcpy(values.data(), bytes.data() + header_size, blockCount * sizeof(typename Dim::rep));
+         }
+         return blockCount;
+      }
+
+      /// @brief deserialize a block into base_dimension objects
+      /// @tparam Dim The dimension type expected in the block
+      /// @tparam InputBuf The buffer type
+      /// @param in The buffer holding the block
+      /// @param objs Destination for the objects. Must hold at least count<Dim>(in) objects.
+      /// @return The number of objects read
+      template <is_base_dimension Dim, typename InputBuf>
+      static std::size_t deserialize(const InputBuf& in, std::span<Dim> objs)
+      {
+         using rep = typename Dim::rep;
+
+         const std::span<const std::byte> bytes = serialization_detail::input_bytes(in);
+         const std::size_t blockCount = read_header<Dim>(bytes);
+         serialization_detail::check_destination(objs.size(), blockCount);
+
+         const std::byte* data = bytes.data() + header_size;
+         for (std::size_t i = 0; i < blockCount; ++i)
+         {
+            rep value;
+            std::memcpy(&value, data, sizeof(rep));
+            objs[i] = Dim(value);
+            data += sizeof(rep);
+         }
+         return blockCount;
+      }
+   };
 
 } // end Dimension
 
@@ -0,0 +1,171 @@
+#ifndef DIMENSION_SERIALIZED_VIEW_H
+#define DIMENSION_SERIALIZED_VIEW_H
+
+#include <cstddef> // For std::byte, std::size_t, std::ptrdiff_t
+#include <cstdint> // For std::uintptr_t
+#include <cstring> // For std::memcpy
+#include <iterator> // For std::random_access_iterator_tag
+#include <ranges>
+#include <span>
+#include <stdexcept> // For std::invalid_argument, std::out_of_range
+#include <type_traits>
+
+#include "Hashing.h"
+#include "SerializationPolicies.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief Read-only view of a serialized block, yielding Dim values without copying the buffer
+   /// @details Views a block written by serialize_block, such as a memory-mapped file or a shared
+   ///    memory region. The tag and length are validated once on construction, after which elements
+   ///    are read in place. Each element is loaded with memcpy, so the buffer needs no alignment.
+   ///    When the values are aligned for Rep, values() also exposes them as a span of raw Reps.
+   ///    The view does not own the buffer, which must outlive it.
+   /// @tparam Dim The dimension type of the serialized values
+   /// @tparam HashPolicy The hash policy used when the block was serialized
+   template<is_base_dimension Dim, typename HashPolicy = FNV_1a_32Bit>
+   class serialized_view
+   {
+   public:
+      using dimension_type = Dim;
+      using rep = typename Dim::rep;
+      using policy = BlockSerializationPolicy<HashPolicy>;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+
+      static_assert(std::is_trivially_copyable_v<rep>, "serialized_view requires a trivially copyable Rep");
+
+      /// @brief Random access iterator yielding Dim objects by value
+      class const_iterator
+      {
+      public:
+         // Elements are produced by value, so only input iteration is advertised to legacy algorithms
+         using iterator_concept = std::random_access_iterator_tag;
+         using iterator_category = std::input_iterator_tag;
+         using value_type = Dim;
+         using difference_type = std::ptrdiff_t;
+         using pointer = void;
+         using reference = Dim;
+
+         constexpr const_iterator() = default;
+         constexpr explicit const_iterator(const std::byte* ptr) : current(ptr) {}
+
+         Dim operator*() const { return Dim(load(current)); }
+         Dim operator[](difference_type n) const { return Dim(load(current + n * stride)); }
+
+         constexpr const_iterator& operator++() { current += stride; return *this; }
+         constexpr const_iterator operator++(int) { const_iterator tmp = *this; current += stride; return tmp; }
+         constexpr const_iterator& operator--() { current -= stride; return *this; }
+         constexpr const_iterator operator--(int) { const_iterator tmp = *this; current -= stride; return tmp; }
+
+         constexpr const_iterator& operator+=(difference_type n) { current += n * stride; return *this; }
+         constexpr const_iterator& operator-=(difference_type n) { current -= n * stride; return *this; }
+
+         friend constexpr const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+         friend constexpr const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+         friend constexpr const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+         friend constexpr difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) { return (lhs.current - rhs.current) / stride; }
+
+         friend constexpr bool operator==(const const_iterator& lhs, const const_iterator& rhs) = default;
+         friend constexpr auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) = default;
+
+      private:
+         static constexpr difference_type stride = sizeof(rep);
+
+         const std::byte* current = nullptr;
+      };
+
+      using iterator = const_iterator;
+
+      serialized_view() = default;
+
+      /// @brief View a serialized block
+      /// @details Throws std::invalid_argument if the tag does not match Dim or the buffer is shorter than the block
+      /// @param bytes The buffer holding the block
+      explicit serialized_view(std::span<const std::byte> bytes)
+         : count(policy::template count<Dim>(bytes)), first(bytes.data() + policy::header_size)
+      {
+      }
+
+      /// @brief View a serialized block held in any contiguous buffer
+      /// @tparam Buf The buffer type, such as std::vector<uint8_t> or std::array<std::byte, N>
+      /// @param buffer The buffer holding the block
+      template<std::ranges::contiguous_range Buf>
+      requires (!std::is_same_v<std::remove_cvref_t<Buf>, std::span<const std::byte>>)
+      explicit serialized_view(const Buf& buffer)
+         : serialized_view(std::as_bytes(std::span(std::ranges::data(buffer), std::ranges::size(buffer))))
+      {
+      }
+
+      [[nodiscard]] size_type size() const noexcept { return count; }
+      [[nodiscard]] bool empty() const noexcept { return count == 0; }
+
+      /// @brief Size in bytes of the viewed block, including its header
+      [[nodiscard]] size_type size_bytes() const noexcept { return policy::template block_size<Dim>(count); }
+
+      [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(first); }
+      [[nodiscard]] const_iterator end() const noexcept { return const_iterator(first + count * sizeof(rep)); }
+      [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+      [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+      Dim operator[](size_type index) const { return Dim(raw(index)); }
+
+      /// @brief Bounds-checked element access
+      Dim at(size_type index) const
+      {
+         if (index >= count)
+         {
+            throw std::out_of_range("serialized_view index out of range");
+         }
+         return Dim(raw(index));
+      }
+
+      Dim front() const { return Dim(raw(0)); }
+      Dim back() const { return Dim(raw(count - 1)); }
+
+      /// @brief Raw value at an index, in the units of Dim
+      [[nodiscard]] rep raw(size_type index) const { return load(first + index * sizeof(rep)); }
+
+      /// @brief Whether the values are aligned for Rep, so that values() is available
+      [[nodiscard]] bool is_aligned() const noexcept
+      {
+         return reinterpret_cast<std::uintptr_t>(first) % alignof(rep) == 0;
+      }
+
+      /// @brief The values as a span of raw Reps, in the units of Dim
+      /// @details Throws std::invalid_argument if the values are not aligned for Rep.
+      ///    Blocks written by serialize_block at an address aligned for Rep keep that alignment,
+      ///    as long as the header size is a multiple of it.
+      [[nodiscard]] std::span<const rep> values() const
+      {
+         if (!is_aligned())
+         {
+            throw std::invalid_argument("Serialized values are not aligned for their representation type");
+         }
+         return std::span<const rep>(reinterpret_cast<const rep*>(first), count);
+      }
+
+      /// @brief The first byte after the viewed block, where a subsequent block may start
+      [[nodiscard]] const std::byte* block_end() const noexcept { return first + count * sizeof(rep); }
+
+   private:
+      static rep load(const std::byte* ptr)
+      {
+         rep value;
+         std::memcpy(&value, ptr, sizeof(rep));
+         return value;
+      }
+
+      size_type count = 0;
+      const std::byte* first = nullptr;
+   };
+
+} // end Dimension
+
+/// @brief serialized_view does not own its buffer, so its iterators may outlive it
+template<typename Dim, typename HashPolicy>
+inline constexpr bool std::ranges::enable_borrowed_range<dimension::serialized_view<Dim, HashPolicy>> = true;
+
+#endif // DIMENSION_SERIALIZED_VIEW_H
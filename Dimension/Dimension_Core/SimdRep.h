@@ -0,0 +1,396 @@
+#ifndef DIMENSION_SIMD_REP_H
+#define DIMENSION_SIMD_REP_H
+
+#include <array>
+#include <cmath> // For std::sqrt, std::hypot
+#include <cstddef> // For std::size_t
+#include <stdexcept> // For std::out_of_range
+#include <type_traits>
+
+#include "base_dimension_signature.h"
+#include "Coefficient.h"
+#include "DimensionArray.h"
+#include "PrecisionType.h"
+#include "RepTraits.h"
+#include "UnitSimplifier.h"
+
+namespace dimension
+{
+
+   /// @brief Result of a lanewise comparison between two simd_reps
+   /// @details Does not convert to bool, since neither reduction keeps a != b equivalent to
+   ///    !(a == b) for every lane. Reduce with all() or any(), or use select() when lanes
+   ///    need to be treated independently.
+   /// @tparam N Number of lanes
+   template<std::size_t N>
+   class simd_mask
+   {
+   public:
+      constexpr simd_mask() noexcept = default;
+
+      explicit constexpr simd_mask(bool value) noexcept
+      {
+         lanes.fill(value);
+      }
+
+      [[nodiscard]] constexpr bool operator[](std::size_t i) const { return lanes[i]; }
+
+      constexpr void set(std::size_t i, bool value) { lanes[i] = value; }
+
+      [[nodiscard]] constexpr bool all() const noexcept
+      {
+         bool result = true;
+         for (std::size_t i = 0; i < N; ++i) { result = result && lanes[i]; }
+         return result;
+      }
+
+      [[nodiscard]] constexpr bool any() const noexcept
+      {
+         bool result = false;
+         for (std::size_t i = 0; i < N; ++i) { result = result || lanes[i]; }
+         return result;
+      }
+
+      [[nodiscard]] constexpr bool none() const noexcept { return !any(); }
+
+      constexpr simd_mask operator!() const noexcept
+      {
+         simd_mask result;
+         for (std::size_t i = 0; i < N; ++i) { result.lanes[i] = !lanes[i]; }
+         return result;
+      }
+
+      friend constexpr simd_mask operator&(const simd_mask& lhs, const simd_mask& rhs) noexcept
+      {
+         simd_mask result;
+         for (std::size_t i = 0; i < N; ++i) { result.lanes[i] = lhs.lanes[i] && rhs.lanes[i]; }
+         return result;
+      }
+
+      friend constexpr simd_mask operator|(const simd_mask& lhs, const simd_mask& rhs) noexcept
+      {
+         simd_mask result;
+         for (std::size_t i = 0; i < N; ++i) { result.lanes[i] = lhs.lanes[i] || rhs.lanes[i]; }
+         return result;
+      }
+
+   private:
+      std::array<bool, N> lanes{};
+   };
+
+   /// @brief Alignment of a simd_rep, the full vector width when it is a power of two up to 64 bytes
+   template<typename T, std::size_t N>
+   constexpr std::size_t simd_alignment()
+   {
+      constexpr std::size_t bytes = sizeof(T) * N;
+      if constexpr (bytes <= 64 && (bytes & (bytes - 1)) == 0)
+      {
+         return bytes;
+      }
+      else
+      {
+         return alignof(T);
+      }
+   }
+
+   /// @brief A fixed-width pack of N arithmetic values usable as the Rep of a dimension
+   /// @details Every operation is applied lanewise in a plain loop over aligned storage,
+   ///    which the compiler maps onto SSE, AVX or NEON registers without intrinsics.
+   ///    speed<simd_rep<double, 8>, meters, seconds> therefore computes eight speeds at once
+   ///    with the same unit checking and compile-time conversion factors as speed<meters, seconds>.
+   /// @tparam T Arithmetic type of each lane
+   /// @tparam N Number of lanes
+   template<typename T, std::size_t N>
+   class alignas(simd_alignment<T, N>()) simd_rep
+   {
+      static_assert(std::is_arithmetic_v<T>, "simd_rep lanes must be an arithmetic type");
+      static_assert(N > 0, "simd_rep must have at least one lane");
+
+   public:
+      using value_type = T;
+      using mask_type = simd_mask<N>;
+
+      static constexpr std::size_t size() noexcept { return N; }
+
+      constexpr simd_rep() noexcept = default;
+
+      /// @brief Broadcast one value to every lane
+      // Implicit broadcast lets scalars and literals mix with simd_reps, as they do with double
+      // cppcheck-suppress noExplicitConstructor
+      constexpr simd_rep(T value) noexcept
+      {
+         lanes.fill(value);
+      }
+
+      /// @brief Broadcast a value of another arithmetic type to every lane
+      template<typename U>
+      requires (std::is_arithmetic_v<U> && !std::is_same_v<U, T>)
+      // cppcheck-suppress noExplicitConstructor
+      constexpr simd_rep(U value) noexcept : simd_rep(static_cast<T>(value))
+      {
+      }
+
+      /// @brief Load N consecutive values starting at ptr
+      [[nodiscard]] static constexpr simd_rep load(const T* ptr) noexcept
+      {
+         simd_rep result;
+         for (std::size_t i = 0; i < N; ++i) { result.lanes[i] = ptr[i]; }
+         return result;
+      }
+
+      /// @brief Store all lanes to N consecutive values starting at ptr
+      constexpr void store(T* ptr) const noexcept
+      {
+         for (std::size_t i = 0; i < N; ++i) { ptr[i] = lanes[i]; }
+      }
+
+      [[nodiscard]] constexpr T operator[](std::size_t i) const { return lanes[i]; }
+
+      constexpr void set(std::size_t i, T value) { lanes[i] = value; }
+
+      constexpr simd_rep& operator+=(const simd_rep& rhs) noexcept
+      {
+         for (std::size_t i = 0; i < N; ++i) { lanes[i] += rhs.lanes[i]; }
+         return *this;
+      }
+
+      constexpr simd_rep& operator-=(const simd_rep& rhs) noexcept
+      {
+         for (std::size_t i = 0; i < N; ++i) { lanes[i] -= rhs.lanes[i]; }
+         return *this;
+      }
+
+      constexpr simd_rep& operator*=(const simd_rep& rhs) noexcept
+      {
+         for (std::size_t i = 0; i < N; ++i) { lanes[i] *= rhs.lanes[i]; }
+         return *this;
+      }
+
+      constexpr simd_rep& operator/=(const simd_rep& rhs) noexcept
+      {
+         for (std::size_t i = 0; i < N; ++i) { lanes[i] /= rhs.lanes[i]; }
+         return *this;
+      }
+
+      constexpr simd_rep operator-() const noexcept
+      {
+         simd_rep result;
+         for (std::size_t i = 0; i < N; ++i) { result.lanes[i] = -lanes[i]; }
+         return result;
+      }
+
+      constexpr simd_rep operator+() const noexcept { return *this; }
+
+      // Binary operators are hidden friends so scalars on either side broadcast implicitly
+      friend constexpr simd_rep operator+(simd_rep lhs, const simd_rep& rhs) noexcept { return lhs += rhs; }
+      friend constexpr simd_rep operator-(simd_rep lhs, const simd_rep& rhs) noexcept { return lhs -= rhs; }
+      friend constexpr simd_rep operator*(simd_rep lhs, const simd_rep& rhs) noexcept { return lhs *= rhs; }
+      friend constexpr simd_rep operator/(simd_rep lhs, const simd_rep& rhs) noexcept { return lhs /= rhs; }
+
+      friend constexpr mask_type operator==(const simd_rep& lhs, const simd_rep& rhs) noexcept
+      {
+         return compare(lhs, rhs, [](T a, T b) { return a == b; });
+      }
+
+      friend constexpr mask_type operator!=(const simd_rep& lhs, const simd_rep& rhs) noexcept
+      {
+         return compare(lhs, rhs, [](T a, T b) { return a != b; });
+      }
+
+      friend constexpr mask_type operator<(const simd_rep& lhs, const simd_rep& rhs) noexcept
+      {
+         return compare(lhs, rhs, [](T a, T b) { return a < b; });
+      }
+
+      friend constexpr mask_type operator<=(const simd_rep& lhs, const simd_rep& rhs) noexcept
+      {
+         return compare(lhs, rhs, [](T a, T b) { return a <= b; });
+      }
+
+      friend constexpr mask_type operator>(const simd_rep& lhs, const simd_rep& rhs) noexcept
+      {
+         return compare(lhs, rhs, [](T a, T b) { return a > b; });
+      }
+
+      friend constexpr mask_type operator>=(const simd_rep& lhs, const simd_rep& rhs) noexcept
+      {
+         return compare(lhs, rhs, [](T a, T b) { return a >= b; });
+      }
+
+      /// @brief Apply a unary function to every lane
+      template<typename Func>
+      [[nodiscard]] constexpr simd_rep apply(Func func) const
+      {
+         simd_rep result;
+         for (std::size_t i = 0; i < N; ++i) { result.lanes[i] = func(lanes[i]); }
+         return result;
+      }
+
+      /// @brief Apply a binary function to every pair of lanes
+      template<typename Func>
+      [[nodiscard]] static constexpr simd_rep apply(const simd_rep& lhs, const simd_rep& rhs, Func func)
+      {
+         simd_rep result;
+         for (std::size_t i = 0; i < N; ++i) { result.lanes[i] = func(lhs.lanes[i], rhs.lanes[i]); }
+         return result;
+      }
+
+   private:
+      template<typename Pred>
+      static constexpr mask_type compare(const simd_rep& lhs, const simd_rep& rhs, Pred pred) noexcept
+      {
+         mask_type result;
+         for (std::size_t i = 0; i < N; ++i) { result.set(i, pred(lhs.lanes[i], rhs.lanes[i])); }
+         return result;
+      }
+
+      std::array<T, N> lanes{};
+   };
+
+   /// @brief Pick lanes from on_true where mask is set, and from on_false elsewhere
+   template<typename T, std::size_t N>
+   [[nodiscard]] constexpr simd_rep<T, N> select(const simd_mask<N>& mask, const simd_rep<T, N>& on_true, const simd_rep<T, N>& on_false)
+   {
+      simd_rep<T, N> result;
+      for (std::size_t i = 0; i < N; ++i) { result.set(i, mask[i] ? on_true[i] : on_false[i]); }
+      return result;
+   }
+
+   template<typename T, std::size_t N>
+   [[nodiscard]] constexpr simd_rep<T, N> min(const simd_rep<T, N>& lhs, const simd_rep<T, N>& rhs)
+   {
+      return simd_rep<T, N>::apply(lhs, rhs, [](T a, T b) { return b < a ? b : a; });
+   }
+
+   template<typename T, std::size_t N>
+   [[nodiscard]] constexpr simd_rep<T, N> max(const simd_rep<T, N>& lhs, const simd_rep<T, N>& rhs)
+   {
+      return simd_rep<T, N>::apply(lhs, rhs, [](T a, T b) { return a < b ? b : a; });
+   }
+
+   template<typename T, std::size_t N>
+   [[nodiscard]] simd_rep<T, N> sqrt(const simd_rep<T, N>& value)
+   {
+      return value.apply([](T a) { return static_cast<T>(std::sqrt(a)); });
+   }
+
+   /// @brief Sum of all lanes
+   template<typename T, std::size_t N>
+   [[nodiscard]] constexpr T reduce_add(const simd_rep<T, N>& value)
+   {
+      T result{0};
+      for (std::size_t i = 0; i < N; ++i) { result += value[i]; }
+      return result;
+   }
+
+   /// @brief rep_traits for simd_rep, applying the scalar trait of each lane
+   /// @details Lanes round and scale exactly as a dimension with Rep T would
+   template<typename T, std::size_t N>
+   struct rep_traits<simd_rep<T, N>>
+   {
+      using value_type = T;
+      static constexpr std::size_t lanes = N;
+
+      static constexpr simd_rep<T, N> scale(const simd_rep<T, N>& value, PrecisionType factor)
+      {
+         return value.apply([factor](T a) { return rep_traits<T>::scale(a, factor); });
+      }
+
+      static constexpr simd_rep<T, N> abs(const simd_rep<T, N>& value)
+      {
+         return value.apply([](T a) { return rep_traits<T>::abs(a); });
+      }
+
+      static constexpr simd_rep<T, N> floor(const simd_rep<T, N>& value)
+      {
+         return value.apply([](T a) { return rep_traits<T>::floor(a); });
+      }
+
+      static constexpr simd_rep<T, N> ceil(const simd_rep<T, N>& value)
+      {
+         return value.apply([](T a) { return rep_traits<T>::ceil(a); });
+      }
+
+      static constexpr simd_rep<T, N> round(const simd_rep<T, N>& value)
+      {
+         return value.apply([](T a) { return rep_traits<T>::round(a); });
+      }
+
+      static simd_rep<T, N> hypot(const simd_rep<T, N>& lhs, const simd_rep<T, N>& rhs)
+      {
+         return simd_rep<T, N>::apply(lhs, rhs, [](T a, T b) { return rep_traits<T>::hypot(a, b); });
+      }
+   };
+
+   /// @brief The dimension type holding N lanes of Dim
+   template<typename Dim, std::size_t N>
+   using simd_dimension = typename base_dimensionFromTuple<simd_rep<typename Dim::rep, N>, typename Dim::ratio, typename Dim::units, typename Dim::symbols>::dim;
+
+   /// @brief Load N consecutive raw values into a dimension with a simd_rep
+   /// @tparam SimdDim Dimension type with a simd_rep Rep, for example speed<simd_rep<double, 8>, meters, seconds>
+   /// @param ptr Start of N values expressed in the units of SimdDim
+   template<typename SimdDim>
+   requires is_simd_rep_v<typename SimdDim::rep>
+   [[nodiscard]] constexpr SimdDim simd_load(const typename SimdDim::rep::value_type* ptr)
+   {
+      return SimdDim(SimdDim::rep::load(ptr));
+   }
+
+   /// @brief Store a dimension with a simd_rep to N consecutive raw values in its own units
+   template<typename SimdDim>
+   requires is_simd_rep_v<typename SimdDim::rep>
+   constexpr void simd_store(const SimdDim& value, typename SimdDim::rep::value_type* ptr)
+   {
+      value.template get_tuple_scalar<typename SimdDim::units>().store(ptr);
+   }
+
+   /// @brief Load N consecutive elements of a dimension_array as one dimension with a simd_rep
+   /// @tparam N Number of lanes
+   /// @param arr Array to read from
+   /// @param index Index of the first element to read
+   /// @return The elements, in the units of the array
+   template<std::size_t N, typename Dim, typename Allocator>
+   [[nodiscard]] simd_dimension<Dim, N> simd_load(const dimension_array<Dim, Allocator>& arr, std::size_t index)
+   {
+      if (index > arr.size() || arr.size() - index < N)
+      {
+         throw std::out_of_range("simd_load reads past the end of the dimension_array");
+      }
+
+      return simd_load<simd_dimension<Dim, N>>(arr.data() + index);
+   }
+
+   /// @brief Store a dimension with a simd_rep into N consecutive elements of a dimension_array
+   /// @details Values are converted to the units of the array with one compile-time factor
+   /// @param value Lanes to store
+   /// @param arr Array to write to
+   /// @param index Index of the first element to write
+   template<typename SimdDim, typename Dim, typename Allocator>
+   requires (is_simd_rep_v<typename SimdDim::rep> &&
+             std::is_same_v<typename SimdDim::rep::value_type, typename Dim::rep> &&
+             matching_dimensions<SimdDim, Dim>)
+   void simd_store(const SimdDim& value, dimension_array<Dim, Allocator>& arr, std::size_t index)
+   {
+      using rep = typename SimdDim::rep;
+      constexpr std::size_t N = rep::size();
+
+      if (index > arr.size() || arr.size() - index < N)
+      {
+         throw std::out_of_range("simd_store writes past the end of the dimension_array");
+      }
+
+      // Coefficients of both types and the unit conversion fold into one factor
+      constexpr PrecisionType factor = coefficient_factor_v<SimdDim> *
+         conversion_factor_v<typename SimdDim::units, typename Dim::units> / coefficient_factor_v<Dim>;
+
+      rep raw = value.template get_tuple_scalar<typename SimdDim::units>();
+      if constexpr (factor != PrecisionType{1})
+      {
+         raw = rep_traits<rep>::scale(raw, factor);
+      }
+      raw.store(arr.data() + index);
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_SIMD_REP_H
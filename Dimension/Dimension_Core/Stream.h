@@ -1,11 +1,19 @@
 #ifndef DIMENSION_STREAM_H
 #define DIMENSION_STREAM_H
 
+#include <array>
+#include <charconv> // For std::to_chars, std::chars_format
 #include <concepts>
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::intmax_t
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <system_error> // For std::errc
+#include <type_traits>
 
+#include "StringLiteral.h"
 #include "TupleHandling.h"
 #include "base_dimension_signature.h"
 
@@ -79,44 +87,205 @@ namespace dimension
 
 
 
+   namespace stream_detail
+   {
+      constexpr std::size_t int_length(std::intmax_t value)
+      {
+         std::size_t length = value < 0 ? 2 : 1;
+         for (value /= 10; value != 0; value /= 10)
+         {
+            ++length;
+         }
+         return length;
+      }
+
+      constexpr std::size_t write_int(char* out, std::intmax_t value)
+      {
+         const std::size_t length = int_length(value);
+         std::size_t pos = length;
+         const bool negative = value < 0;
+         do
+         {
+            const std::intmax_t digit = value % 10;
+            out[--pos] = static_cast<char>('0' + (digit < 0 ? -digit : digit));
+            value /= 10;
+         } while (value != 0);
+         if (negative)
+         {
+            out[0] = '-';
+         }
+         return length;
+      }
+
+      constexpr std::size_t write_text(char* out, std::string_view text)
+      {
+         for (std::size_t i = 0; i < text.size(); ++i)
+         {
+            out[i] = text[i];
+         }
+         return text.size();
+      }
+
+      /// @brief Write one unit_exponent as stream_one_unit does, returning the length, nullptr only measures
+      template<typename UE>
+      constexpr std::size_t write_unit(char* out)
+      {
+         using Exponent = typename UE::exponent;
+         std::array<char, 48> buffer{};
+         std::size_t length = write_text(buffer.data(), std::string_view(UE::unit::abbr.value.data(), UE::unit::abbr.size - 1));
+
+         if constexpr (!(Exponent::num == 1 && Exponent::den == 1))
+         {
+            buffer[length++] = '^';
+            if constexpr (Exponent::den == 1)
+            {
+               length += write_int(buffer.data() + length, Exponent::num);
+            }
+            else
+            {
+               buffer[length++] = '(';
+               length += write_int(buffer.data() + length, Exponent::num);
+               buffer[length++] = '/';
+               length += write_int(buffer.data() + length, Exponent::den);
+               buffer[length++] = ')';
+            }
+         }
+
+         if (out != nullptr)
+         {
+            write_text(out, std::string_view(buffer.data(), length));
+         }
+         return length;
+      }
+
+      /// @brief Write " [" units joined by " * " "]", returning the length, nullptr only measures
+      template<typename Tuple>
+      struct suffix_writer;
+
+      template<typename... Units>
+      struct suffix_writer<std::tuple<Units...>>
+      {
+         static constexpr std::size_t write(char* out)
+         {
+            std::size_t length = 0;
+            const auto text = [&](std::string_view part)
+            {
+               if (out != nullptr)
+               {
+                  write_text(out + length, part);
+               }
+               length += part.size();
+            };
+
+            text(" [");
+            bool first = true;
+            ((text(first ? std::string_view() : std::string_view(" * ")), first = false,
+              length += write_unit<Units>(out == nullptr ? nullptr : out + length)), ...);
+            text("]");
+            return length;
+         }
+      };
+
+      template<typename Tuple>
+      constexpr auto make_suffix()
+      {
+         constexpr std::size_t length = suffix_writer<Tuple>::write(nullptr);
+         std::array<char, length + 1> text{};
+         suffix_writer<Tuple>::write(text.data());
+         return StringLiteral<length + 1>(text);
+      }
+   }
+
+   /// @brief The unit suffix written after the value of a Dim, such as " [m * s^-1]", as one constant
+   template<is_base_dimension Dim>
+   inline constexpr auto unit_suffix_v = stream_detail::make_suffix<typename Dim::units>();
+
+   /// @brief The unit suffix of a Dim as a string_view
+   template<is_base_dimension Dim>
+   constexpr std::string_view unit_suffix()
+   {
+      return std::string_view(unit_suffix_v<Dim>.value.data(), unit_suffix_v<Dim>.size - 1);
+   }
+
+   namespace stream_detail
+   {
+      /// @brief Append the unit suffix of Dim after a written number
+      template<typename Dim>
+      std::to_chars_result append_suffix(std::to_chars_result number, char* last)
+      {
+         constexpr std::size_t length = unit_suffix_v<Dim>.size - 1;
+         if (number.ec != std::errc{} || static_cast<std::size_t>(last - number.ptr) < length)
+         {
+            return {last, std::errc::value_too_large};
+         }
+         return {write_text(number.ptr, std::string_view(unit_suffix_v<Dim>.value.data(), length)) + number.ptr, std::errc{}};
+      }
+   }
+
+   /// @brief Write the value of obj and its unit suffix into [first, last) without allocating
+   /// @details The value is written by std::to_chars with the given format and precision.
+   /// @return The end of the written characters, or last with std::errc::value_too_large
+   template<is_base_dimension Dim>
+   requires std::is_arithmetic_v<typename Dim::rep>
+   std::to_chars_result to_chars(char* first, char* last, const Dim& obj, std::chars_format fmt, int precision)
+   {
+      const auto number = std::to_chars(first, last, get_dimension_tuple<typename Dim::units>(obj), fmt, precision);
+      return stream_detail::append_suffix<Dim>(number, last);
+   }
+
+   /// @brief Write the value of obj in its shortest round trip form and its unit suffix into [first, last)
+   /// @return The end of the written characters, or last with std::errc::value_too_large
+   template<is_base_dimension Dim>
+   requires std::is_arithmetic_v<typename Dim::rep>
+   std::to_chars_result to_chars(char* first, char* last, const Dim& obj)
+   {
+      const auto number = std::to_chars(first, last, get_dimension_tuple<typename Dim::units>(obj));
+      return stream_detail::append_suffix<Dim>(number, last);
+   }
+
    /// @brief Write dimension object to stream
-   /// @tparam NumTuple Numerator unit tuple
-   /// @tparam DenTuple Denominator unit tuple
+   /// @tparam Dim The dimension type
    /// @param os stream to write to
    /// @param obj object to write
    /// @return reference to stream written
    template<is_base_dimension Dim>
    std::ostream& to_stream(std::ostream& os, const Dim& obj)
    {
-      //using NumTuple = base_dimension<NumTupleT, DenTupleT>::NumTuple;
-      //using DenTuple = base_dimension<NumTupleT, DenTupleT>::DenTuple;
-      using units = typename Dim::units;
-
-      os << get_dimension_tuple<units>(obj) << " [";
-
-      stream_units_tuple<std::ostream, units>(os);
-
-      os << "]";
-
-      return os;
+      // The value follows the flags of the stream, the suffix is one precomputed write
+      os << get_dimension_tuple<typename Dim::units>(obj);
+      return os.write(unit_suffix_v<Dim>.value.data(), static_cast<std::streamsize>(unit_suffix_v<Dim>.size - 1));
    }
 
    /// @brief Write dimension object to std::string
-   /// @tparam NumTuple Numerator unit tuple
-   /// @tparam DenTuple Denominator unit tuple
+   /// @details Matches to_stream on a default formatted stream, built with to_chars when Rep is arithmetic.
    /// @param obj Dimension object to write
    /// @return string representation of object
    template<is_base_dimension Dim>
    std::string to_string(const Dim& obj)
    {
-      std::ostringstream os;
-      to_stream(os, obj);
-      return os.str();
+      if constexpr (std::is_floating_point_v<typename Dim::rep>)
+      {
+         // A default formatted stream writes floating-point values like %g with precision 6
+         std::array<char, 32 + unit_suffix_v<Dim>.size> buffer;
+         const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), obj, std::chars_format::general, 6);
+         return std::string(buffer.data(), result.ptr);
+      }
+      else if constexpr (std::is_integral_v<typename Dim::rep>)
+      {
+         std::array<char, 24 + unit_suffix_v<Dim>.size> buffer;
+         const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), obj);
+         return std::string(buffer.data(), result.ptr);
+      }
+      else
+      {
+         std::ostringstream os;
+         to_stream(os, obj);
+         return os.str();
+      }
    }
 
    /// @brief Stream operator from base_dimension to ostream
-   /// @tparam NumTuple Numerator tuple
-   /// @tparam DenTuple Denominator tuple
+   /// @tparam Dim The dimension type
    /// @param os stream object
    /// @param obj dimension object
    /// @return reference to stream object
@@ -0,0 +1,505 @@
+#ifndef DIMENSION_STREAMING_SERIALIZATION_H
+#define DIMENSION_STREAMING_SERIALIZATION_H
+
+#include <algorithm> // For std::min
+#include <atomic>
+#include <bit> // For std::bit_ceil, std::endian
+#include <concepts>
+#include <cstddef> // For std::byte, std::size_t
+#include <cstdint> // For std::uint32_t
+#include <cstring> // For std::memcpy
+#include <istream>
+#include <memory> // For std::unique_ptr
+#include <ostream>
+#include <span>
+#include <stdexcept> // For std::invalid_argument, std::runtime_error
+#include <thread> // For std::this_thread::yield
+#include <type_traits>
+#include <vector>
+
+#include "ByteOrder.h"
+#include "SerializationPolicies.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief Bounded lock-free byte queue between one producer thread and one consumer thread
+   /// @details The storage is allocated once, on construction. Each side owns one index and keeps a
+   ///    cached copy of the other, so the indices are only shared when the cache runs out.
+   ///    Only one thread may call the producer functions, and only one the consumer functions.
+   class spsc_ring
+   {
+   public:
+      /// @param capacity Minimum capacity in bytes, rounded up to a power of two
+      explicit spsc_ring(std::size_t capacity)
+         : size(std::bit_ceil(std::max<std::size_t>(capacity, 64))), storage(std::make_unique<std::byte[]>(size))
+      {
+      }
+
+      spsc_ring(const spsc_ring&) = delete;
+      spsc_ring& operator=(const spsc_ring&) = delete;
+
+      [[nodiscard]] std::size_t capacity() const noexcept { return size; }
+
+      //------------------------------------------------------------------
+      // Producer
+      //------------------------------------------------------------------
+
+      /// @brief Bytes that can be written without waiting
+      [[nodiscard]] std::size_t write_available() noexcept
+      {
+         return free_space(tail.load(std::memory_order_relaxed), size);
+      }
+
+      /// @brief Write all of the bytes, or none of them if they do not fit
+      bool try_write(std::span<const std::byte> bytes) noexcept
+      {
+         const std::size_t t = tail.load(std::memory_order_relaxed);
+         if (free_space(t, bytes.size()) < bytes.size())
+         {
+            return false;
+         }
+         copy_in(t, bytes);
+         tail.store(t + bytes.size(), std::memory_order_release);
+         return true;
+      }
+
+      /// @brief Write as many of the bytes as fit
+      /// @return The number of bytes written
+      std::size_t write_some(std::span<const std::byte> bytes) noexcept
+      {
+         const std::size_t t = tail.load(std::memory_order_relaxed);
+         const std::size_t count = std::min(bytes.size(), free_space(t, bytes.size()));
+         if (count > 0)
+         {
+            copy_in(t, bytes.first(count));
+            tail.store(t + count, std::memory_order_release);
+         }
+         return count;
+      }
+
+      /// @brief Mark the end of the stream. The consumer still reads the bytes already written.
+      void close() noexcept { isClosed.store(true, std::memory_order_release); }
+
+      //------------------------------------------------------------------
+      // Consumer
+      //------------------------------------------------------------------
+
+      /// @brief Bytes that can be read without waiting
+      [[nodiscard]] std::size_t read_available() noexcept
+      {
+         return used_space(head.load(std::memory_order_relaxed), size);
+      }
+
+      /// @brief Read as many bytes as are available, up to the size of out
+      /// @return The number of bytes read
+      std::size_t read_some(std::span<std::byte> out) noexcept
+      {
+         const std::size_t h = head.load(std::memory_order_relaxed);
+         const std::size_t count = std::min(out.size(), used_space(h, out.size()));
+         if (count > 0)
+         {
+            copy_out(h, out.first(count));
+            head.store(h + count, std::memory_order_release);
+         }
+         return count;
+      }
+
+      /// @brief Whether the producer closed the stream. Bytes may remain to be read.
+      [[nodiscard]] bool closed() const noexcept { return isClosed.load(std::memory_order_acquire); }
+
+   private:
+      /// @brief Free bytes seen by the producer, reloading head only when the cached copy shows fewer than wanted
+      std::size_t free_space(std::size_t t, std::size_t wanted) noexcept
+      {
+         if (size - (t - cachedHead) < wanted)
+         {
+            cachedHead = head.load(std::memory_order_acquire);
+         }
+         return size - (t - cachedHead);
+      }
+
+      /// @brief Readable bytes seen by the consumer, reloading tail only when the cached copy shows fewer than wanted
+      std::size_t used_space(std::size_t h, std::size_t wanted) noexcept
+      {
+         if (cachedTail - h < wanted)
+         {
+            cachedTail = tail.load(std::memory_order_acquire);
+         }
+         return cachedTail - h;
+      }
+
+      void copy_in(std::size_t position, std::span<const std::byte> bytes) noexcept
+      {
+         const std::size_t offset = position & (size - 1);
+         const std::size_t first = std::min(bytes.size(), size - offset);
+         std::memcpy(storage.get() + offset, bytes.data(), first);
+         std::memcpy(storage.get(), bytes.data() + first, bytes.size() - first);
+      }
+
+      void copy_out(std::size_t position, std::span<std::byte> out) const noexcept
+      {
+         const std::size_t offset = position & (size - 1);
+         const std::size_t first = std::min(out.size(), size - offset);
+         std::memcpy(out.data(), storage.get() + offset, first);
+         std::memcpy(out.data() + first, storage.get(), out.size() - first);
+      }
+
+      const std::size_t size;
+      const std::unique_ptr<std::byte[]> storage;
+
+      // Indices grow without wrapping, and are masked on access
+      alignas(64) std::atomic<std::size_t> head{0}; ///< Read position, written by the consumer
+      std::size_t cachedTail = 0;                   ///< Consumer copy of tail
+      alignas(64) std::atomic<std::size_t> tail{0}; ///< Write position, written by the producer
+      std::size_t cachedHead = 0;                   ///< Producer copy of head
+      alignas(64) std::atomic<bool> isClosed{false};
+   };
+
+   /// @brief What a producer does when the consumer falls behind
+   enum class backpressure
+   {
+      block, ///< Wait until there is room for the batch
+      drop   ///< Discard the whole batch, and count its records as dropped
+   };
+
+   /// @brief Sink writing frames to an spsc_ring
+   /// @details With backpressure::drop, frames larger than the ring are always dropped
+   class ring_sink
+   {
+   public:
+      explicit ring_sink(spsc_ring& ring, backpressure policy = backpressure::block) : target(ring), mode(policy) {}
+
+      /// @brief Write a frame
+      /// @return false if the frame was dropped
+      bool write(std::span<const std::byte> frame)
+      {
+         if (mode == backpressure::drop)
+         {
+            return target.try_write(frame);
+         }
+         while (!frame.empty())
+         {
+            const std::size_t written = target.write_some(frame);
+            if (written == 0)
+            {
+               std::this_thread::yield();
+            }
+            frame = frame.subspan(written);
+         }
+         return true;
+      }
+
+      /// @brief Frames are visible to the consumer as soon as they are written
+      void flush() noexcept {}
+
+      /// @brief Mark the end of the stream
+      void close() noexcept { target.close(); }
+
+   private:
+      spsc_ring& target;
+      backpressure mode;
+   };
+
+   /// @brief Source reading frames from an spsc_ring
+   class ring_source
+   {
+   public:
+      explicit ring_source(spsc_ring& queue) : ring(queue) {}
+
+      /// @brief Read exactly out.size() bytes, waiting for the producer if needed
+      /// @details Throws std::runtime_error if the stream ends part way through
+      /// @return false if the stream ended before any byte was read
+      bool read(std::span<std::byte> out)
+      {
+         std::size_t done = 0;
+         while (done < out.size())
+         {
+            const std::size_t count = ring.read_some(out.subspan(done));
+            if (count == 0)
+            {
+               // Check for more bytes after seeing the close, since they are written before it
+               if (ring.closed() && ring.read_available() == 0)
+               {
+                  if (done == 0)
+                  {
+                     return false;
+                  }
+                  throw std::runtime_error("Stream ended in the middle of a frame");
+               }
+               std::this_thread::yield();
+            }
+            done += count;
+         }
+         return true;
+      }
+
+   private:
+      spsc_ring& ring;
+   };
+
+   /// @brief Sink writing frames to a std::ostream, which blocks when the stream does
+   class ostream_sink
+   {
+   public:
+      explicit ostream_sink(std::ostream& stream) : os(stream) {}
+
+      bool write(std::span<const std::byte> frame)
+      {
+         os.write(reinterpret_cast<const char*>(frame.data()), static_cast<std::streamsize>(frame.size()));
+         if (!os)
+         {
+            throw std::runtime_error("Failed to write to the output stream");
+         }
+         return true;
+      }
+
+      void flush() { os.flush(); }
+
+   private:
+      std::ostream& os;
+   };
+
+   /// @brief Source reading frames from a std::istream
+   class istream_source
+   {
+   public:
+      explicit istream_source(std::istream& stream) : is(stream) {}
+
+      /// @brief Read exactly out.size() bytes
+      /// @details Throws std::runtime_error if the stream ends part way through
+      /// @return false if the stream ended before any byte was read
+      bool read(std::span<std::byte> out)
+      {
+         is.read(reinterpret_cast<char*>(out.data()), static_cast<std::streamsize>(out.size()));
+         const auto count = static_cast<std::size_t>(is.gcount());
+         if (count == out.size())
+         {
+            return true;
+         }
+         if (count == 0 && is.eof())
+         {
+            return false;
+         }
+         throw std::runtime_error("Stream ended in the middle of a frame");
+      }
+
+   private:
+      std::istream& is;
+   };
+
+   namespace streaming_detail
+   {
+      /// @brief Each frame is a block preceded by its size in bytes, as a little endian uint32_t
+      using frame_size_type = std::uint32_t;
+      inline constexpr std::size_t frame_prefix = sizeof(frame_size_type);
+   }
+
+   /// @brief Concept for the sinks accepted by stream_writer
+   template<typename T>
+   concept stream_sink = requires(T& sink, std::span<const std::byte> frame)
+   {
+      { sink.write(frame) } -> std::convertible_to<bool>;
+      sink.flush();
+   };
+
+   /// @brief Concept for the sources accepted by stream_reader
+   template<typename T>
+   concept stream_source = requires(T& source, std::span<std::byte> out)
+   {
+      { source.read(out) } -> std::convertible_to<bool>;
+   };
+
+   /// @brief Writes records of Dim to a sink, in batches serialized as one block each
+   /// @details Records are collected into a batch, which is serialized with the block policy and written
+   ///    to the sink as one frame once it holds batch_size records, or on flush(). All buffers are
+   ///    allocated on construction, so pushing a record does not allocate or lock. Whether a full sink
+   ///    blocks or drops the batch is decided by the sink, such as ring_sink.
+   /// @tparam Dim The dimension type of the records
+   /// @tparam Sink The sink, such as ring_sink or ostream_sink
+   /// @tparam Policy Block serialization policy, such as BlockSerializationPolicy or PortableSerializationPolicy
+   template<is_base_dimension Dim, stream_sink Sink, typename Policy = BlockSerializationPolicy<FNV_1a_32Bit>>
+   class stream_writer
+   {
+   public:
+      using rep = typename Dim::rep;
+
+      /// @param sink The sink, which must outlive the writer
+      /// @param batchSize Records per frame, written once reached
+      explicit stream_writer(Sink& sink, std::size_t batchSize = 1024)
+         : target(sink), batch(batchSize), frame(streaming_detail::frame_prefix + Policy::template block_size<Dim>(batchSize))
+      {
+         if (batchSize == 0)
+         {
+            throw std::invalid_argument("A stream batch must hold at least one record");
+         }
+      }
+
+      stream_writer(const stream_writer&) = delete;
+      stream_writer& operator=(const stream_writer&) = delete;
+
+      /// @brief Writes any pending records. Errors are ignored, call flush() to see them.
+      ~stream_writer()
+      {
+         try
+         {
+            flush();
+         }
+         catch (...)
+         {
+         }
+      }
+
+      /// @brief Add one record, writing the batch once it is full
+      void push(const Dim& obj)
+      {
+         batch[count++] = obj.template get_tuple_scalar<typename Dim::units>();
+         if (count == batch.size())
+         {
+            write_batch();
+         }
+      }
+
+      /// @brief Add several records, writing each batch as it fills
+      void push(std::span<const Dim> objs)
+      {
+         for (const Dim& obj : objs)
+         {
+            push(obj);
+         }
+      }
+
+      /// @brief Write the pending records, even if the batch is not full, and flush the sink
+      /// @return false if the sink dropped the batch
+      bool flush()
+      {
+         const bool accepted = count == 0 || write_batch();
+         target.flush();
+         return accepted;
+      }
+
+      /// @brief Records accepted by the sink
+      [[nodiscard]] std::size_t written() const noexcept { return writtenCount; }
+
+      /// @brief Records dropped by the sink under backpressure
+      [[nodiscard]] std::size_t dropped() const noexcept { return droppedCount; }
+
+      /// @brief Records waiting for the batch to fill
+      [[nodiscard]] std::size_t pending() const noexcept { return count; }
+
+   private:
+      bool write_batch()
+      {
+         const std::size_t blockBytes = Policy::template serialize<Dim>(std::span(frame).subspan(streaming_detail::frame_prefix),
+                                                                        std::span<const rep>(batch).first(count));
+         const auto prefix = to_byte_order<std::endian::little>(static_cast<streaming_detail::frame_size_type>(blockBytes));
+         std::memcpy(frame.data(), &prefix, streaming_detail::frame_prefix);
+
+         const bool accepted = target.write(std::span<const std::byte>(frame).first(streaming_detail::frame_prefix + blockBytes));
+         (accepted ? writtenCount : droppedCount) += count;
+         count = 0;
+         return accepted;
+      }
+
+      Sink& target;
+      std::vector<rep> batch;
+      std::vector<std::byte> frame;
+      std::size_t count = 0;
+      std::size_t writtenCount = 0;
+      std::size_t droppedCount = 0;
+   };
+
+   /// @brief Reads records of Dim written by a stream_writer from a source
+   /// @details Frames are read and deserialized one at a time, into buffers allocated on construction.
+   /// @tparam Dim The dimension type of the records
+   /// @tparam Source The source, such as ring_source or istream_source
+   /// @tparam Policy Block serialization policy the records were written with
+   template<is_base_dimension Dim, stream_source Source, typename Policy = BlockSerializationPolicy<FNV_1a_32Bit>>
+   class stream_reader
+   {
+   public:
+      using rep = typename Dim::rep;
+
+      /// @param source The source, which must outlive the reader
+      /// @param maxBatchSize Largest batch the writer uses. Larger frames throw std::runtime_error.
+      explicit stream_reader(Source& source, std::size_t maxBatchSize = 1024)
+         : input(source), batch(maxBatchSize), frame(Policy::template block_size<Dim>(maxBatchSize))
+      {
+      }
+
+      stream_reader(const stream_reader&) = delete;
+      stream_reader& operator=(const stream_reader&) = delete;
+
+      /// @brief Read the next record
+      /// @return false at the end of the stream
+      bool next(Dim& obj)
+      {
+         if (position == available && !read_frame())
+         {
+            return false;
+         }
+         obj = Dim(batch[position++]);
+         return true;
+      }
+
+      /// @brief Read up to objs.size() records
+      /// @return The number of records read, fewer than objs.size() only at the end of the stream
+      std::size_t read(std::span<Dim> objs)
+      {
+         std::size_t done = 0;
+         while (done < objs.size())
+         {
+            if (position == available && !read_frame())
+            {
+               break;
+            }
+            const std::size_t count = std::min(objs.size() - done, available - position);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+               objs[done + i] = Dim(batch[position + i]);
+            }
+            position += count;
+            done += count;
+         }
+         return done;
+      }
+
+   private:
+      bool read_frame()
+      {
+         // Skip empty frames
+         do
+         {
+            streaming_detail::frame_size_type prefix;
+            if (!input.read(std::as_writable_bytes(std::span(&prefix, 1))))
+            {
+               return false;
+            }
+            const std::size_t blockBytes = to_byte_order<std::endian::little>(prefix);
+            if (blockBytes > frame.size())
+            {
+               throw std::runtime_error("Stream frame is larger than the reader's maximum batch");
+            }
+
+            const std::span<std::byte> block = std::span(frame).first(blockBytes);
+            if (!input.read(block))
+            {
+               throw std::runtime_error("Stream ended in the middle of a frame");
+            }
+            available = Policy::template deserialize<Dim>(block, std::span<rep>(batch));
+            position = 0;
+         } while (available == 0);
+         return true;
+      }
+
+      Source& input;
+      std::vector<rep> batch;
+      std::vector<std::byte> frame;
+      std::size_t position = 0;
+      std::size_t available = 0;
+   };
+
+} // end Dimension
+
+#endif // DIMENSION_STREAMING_SERIALIZATION_H
@@ -0,0 +1,306 @@
+#ifndef DIMENSION_TAG_REGISTRY_H
+#define DIMENSION_TAG_REGISTRY_H
+
+#include <algorithm> // For std::min
+#include <array>
+#include <cstddef> // For std::byte, std::size_t
+#include <cstdint> // For std::uint#_t
+#include <cstring> // For std::memcpy
+#include <span>
+#include <stdexcept> // For std::invalid_argument
+#include <tuple>
+#include <type_traits>
+#include <utility> // For std::index_sequence
+
+#include "DynamicQuantity.h"
+#include "Hashing.h"
+#include "PrecisionType.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief A record whose type tag is not in a tag_registry
+   struct unknown_record
+   {
+      std::uint64_t tag = 0;
+      PrecisionType value = 0.0;
+   };
+
+   /// @brief Compile-time registry from type tags to dimension types, for decoding mixed streams
+   /// @details Decodes records written by DefaultSerializationPolicy<HashPolicy>, a tag followed by a
+   ///    PrecisionType, without knowing their type in advance. A seed is searched at compile time so that
+   ///    every tag lands in its own slot, so finding the type of a record is one multiply, two loads
+   ///    and one compare, with no branch. dispatch_all then branches to the inlined handler for that
+   ///    type, while dispatch_grouped orders each batch by type first.
+   ///    Each record is passed to the visitor as its Dim when the visitor accepts it, otherwise as a
+   ///    dynamic_quantity. Records with unknown tags are passed as an unknown_record, or throw
+   ///    std::invalid_argument if the visitor does not accept one.
+   /// @tparam HashPolicy The hash policy the records were serialized with
+   /// @tparam Dims The dimension types to recognize, which must have distinct tags
+   template<typename HashPolicy, is_base_dimension... Dims>
+   class tag_registry
+   {
+   public:
+      using tag_type = typename HashPolicy::tag_type::type;
+
+      static_assert(!std::is_void_v<tag_type>, "A tag_registry requires a hash policy producing tags");
+      static_assert(sizeof...(Dims) > 0 && sizeof...(Dims) < 255, "A tag_registry holds between 1 and 254 types");
+      static_assert((std::is_same_v<typename Dims::rep, PrecisionType> && ...), "Records of a tag_registry hold a PrecisionType, so each type must use it as its Rep");
+
+      /// @brief Size in bytes of one serialized record
+      static constexpr std::size_t record_size = HashPolicy::tag_size + sizeof(PrecisionType);
+
+      /// @brief Tags of the registered types, in the order of Dims
+      static constexpr std::array<tag_type, sizeof...(Dims)> tags{TypeTagHelper<Dims, HashPolicy>::value().get()...};
+
+      /// @brief The registered type at an index
+      template<std::size_t I>
+      using dimension_type = std::tuple_element_t<I, std::tuple<Dims...>>;
+
+      [[nodiscard]] static constexpr std::size_t size() noexcept { return sizeof...(Dims); }
+
+      /// @brief Index of the type with a tag, or size() if the tag is unknown
+      /// @details Branch-free: one multiply, and two loads from the slot the tag hashes to
+      [[nodiscard]] static constexpr std::size_t find(tag_type tag) noexcept
+      {
+         const std::size_t s = slot(tag, table.seed);
+         return table.tags[s] == tag ? table.index[s] : size();
+      }
+
+      /// @brief Decode one record and pass it to the visitor
+      /// @param record The record, at least record_size bytes
+      /// @param visitor Callable with each Dim or a dynamic_quantity, and optionally an unknown_record
+      template<typename Visitor>
+      static void dispatch(std::span<const std::byte> record, Visitor&& visitor)
+      {
+         if (record.size() < record_size)
+         {
+            throw std::invalid_argument("Buffer size is too small for a serialized record.");
+         }
+         dispatch_record(record.data(), visitor);
+      }
+
+      /// @brief Decode a buffer of consecutive records, passing each to the visitor in stream order
+      /// @param records The records, a whole number of record_size bytes
+      /// @param visitor Callable with each Dim or a dynamic_quantity, and optionally an unknown_record
+      /// @return The number of records decoded
+      template<typename Visitor>
+      static std::size_t dispatch_all(std::span<const std::byte> records, Visitor&& visitor)
+      {
+         check_records(records);
+
+         const std::byte* end = records.data() + records.size();
+         for (const std::byte* record = records.data(); record != end; record += record_size)
+         {
+            dispatch_record(record, visitor);
+         }
+         return records.size() / record_size;
+      }
+
+      /// @brief Decode a buffer of consecutive records, passing them to the visitor grouped by type
+      /// @details Records are taken in batches of group_size. The types of a batch are found without
+      ///    branching, the batch is ordered by type, and each type is then decoded in its own loop.
+      ///    This avoids a mispredicted branch per record when types are mixed. Records of one type
+      ///    arrive in stream order, but records of different types within a batch do not, and
+      ///    unknown records of a batch arrive after the known ones.
+      /// @param records The records, a whole number of record_size bytes
+      /// @param visitor Callable with each Dim or a dynamic_quantity, and optionally an unknown_record
+      /// @return The number of records decoded
+      template<typename Visitor>
+      static std::size_t dispatch_grouped(std::span<const std::byte> records, Visitor&& visitor)
+      {
+         check_records(records);
+
+         const std::size_t count = records.size() / record_size;
+         for (std::size_t first = 0; first < count; first += group_size)
+         {
+            dispatch_group(records.data() + first * record_size, std::min(group_size, count - first), visitor);
+         }
+         return count;
+      }
+
+      /// @brief Number of records ordered together by dispatch_grouped
+      static constexpr std::size_t group_size = 256;
+
+   private:
+      // At least four slots per type keeps the seed search short
+      static constexpr std::size_t slot_bits = [] {
+         std::size_t bits = 4;
+         while ((std::size_t{1} << bits) < 4 * sizeof...(Dims))
+         {
+            ++bits;
+         }
+         return bits;
+      }();
+
+      static constexpr std::size_t slot(tag_type tag, std::uint64_t seed) noexcept
+      {
+         return static_cast<std::size_t>((static_cast<std::uint64_t>(tag) * seed) >> (64 - slot_bits));
+      }
+
+      /// @brief For each slot, the tag stored there and the index of its type, or size() if empty
+      /// @details An empty slot holds a tag hashing to another slot, so no tag can match it.
+      struct slot_table
+      {
+         std::uint64_t seed = 1;
+         std::array<tag_type, std::size_t{1} << slot_bits> tags{};
+         std::array<std::uint8_t, std::size_t{1} << slot_bits> index{};
+      };
+
+      static consteval slot_table make_table()
+      {
+         for (std::size_t i = 0; i < tags.size(); ++i)
+         {
+            for (std::size_t j = i + 1; j < tags.size(); ++j)
+            {
+               if (tags[i] == tags[j])
+               {
+                  throw std::invalid_argument("Two types in a tag_registry share a tag");
+               }
+            }
+         }
+
+         slot_table result;
+         for (std::uint64_t attempt = 1; attempt < 4096; ++attempt)
+         {
+            result.seed = (attempt * 0x9e3779b97f4a7c15u) | 1u;
+            result.index.fill(static_cast<std::uint8_t>(size()));
+
+            bool collision = false;
+            for (std::size_t i = 0; i < tags.size() && !collision; ++i)
+            {
+               auto& entry = result.index[slot(tags[i], result.seed)];
+               collision = entry != size();
+               entry = static_cast<std::uint8_t>(i);
+            }
+
+            if (!collision)
+            {
+               for (std::size_t s = 0; s < result.tags.size(); ++s)
+               {
+                  result.tags[s] = result.index[s] != size() ? tags[result.index[s]] : tags[0];
+               }
+               return result;
+            }
+         }
+         throw std::invalid_argument("No perfect hash seed found for the tag_registry");
+      }
+
+      static constexpr slot_table table = make_table();
+
+      static void check_records(std::span<const std::byte> records)
+      {
+         if (records.size() % record_size != 0)
+         {
+            throw std::invalid_argument("Buffer does not hold a whole number of serialized records.");
+         }
+      }
+
+      static tag_type load_tag(const std::byte* record) noexcept
+      {
+         tag_type tag;
+         std::memcpy(&tag, record, HashPolicy::tag_size);
+         return tag;
+      }
+
+      static PrecisionType load_value(const std::byte* record) noexcept
+      {
+         PrecisionType value;
+         std::memcpy(&value, record + HashPolicy::tag_size, sizeof(PrecisionType));
+         return value;
+      }
+
+      template<is_base_dimension Dim, typename Visitor>
+      static void invoke(PrecisionType value, Visitor& visitor)
+      {
+         if constexpr (std::is_invocable_v<Visitor&, Dim>)
+         {
+            visitor(Dim(value));
+         }
+         else
+         {
+            static_assert(std::is_invocable_v<Visitor&, dynamic_quantity>, "The visitor must accept each registered type or a dynamic_quantity");
+            visitor(dynamic_quantity(Dim(value)));
+         }
+      }
+
+      template<typename Visitor>
+      static void invoke_unknown(tag_type tag, PrecisionType value, Visitor& visitor)
+      {
+         if constexpr (std::is_invocable_v<Visitor&, unknown_record>)
+         {
+            visitor(unknown_record{static_cast<std::uint64_t>(tag), value});
+         }
+         else
+         {
+            throw std::invalid_argument("Type tag mismatch during deserialization");
+         }
+      }
+
+      template<typename Visitor, std::size_t... Is>
+      static bool invoke_at(std::size_t index, PrecisionType value, Visitor& visitor, std::index_sequence<Is...>)
+      {
+         return ((index == Is && (invoke<Dims, Visitor>(value, visitor), true)) || ...);
+      }
+
+      template<typename Visitor>
+      static void dispatch_record(const std::byte* record, Visitor& visitor)
+      {
+         const tag_type tag = load_tag(record);
+         const PrecisionType value = load_value(record);
+         if (!invoke_at(find(tag), value, visitor, std::index_sequence_for<Dims...>{}))
+         {
+            invoke_unknown(tag, value, visitor);
+         }
+      }
+
+      template<typename Visitor>
+      static void dispatch_group(const std::byte* records, std::size_t count, Visitor& visitor)
+      {
+         // Counting sort of the batch by type, unknown records last. begin holds a slot per type and
+         // one for unknown records, offset by two for the prefix sum and the scatter
+         std::array<std::uint8_t, group_size> kinds;
+         std::array<std::uint16_t, sizeof...(Dims) + 3> begin{};
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            kinds[i] = static_cast<std::uint8_t>(find(load_tag(records + i * record_size)));
+            ++begin[kinds[i] + 2];
+         }
+         for (std::size_t k = 2; k < begin.size(); ++k)
+         {
+            begin[k] += begin[k - 1];
+         }
+
+         std::array<std::uint16_t, group_size> order;
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            order[begin[kinds[i] + 1]++] = static_cast<std::uint16_t>(i);
+         }
+
+         // begin[k] now holds the start of type k
+         [&]<std::size_t... Is>(std::index_sequence<Is...>)
+         {
+            ((decode_run<Dims>(records, order.data() + begin[Is], order.data() + begin[Is + 1], visitor)), ...);
+         }(std::index_sequence_for<Dims...>{});
+
+         for (std::size_t k = begin[sizeof...(Dims)]; k < count; ++k)
+         {
+            const std::byte* record = records + order[k] * record_size;
+            invoke_unknown(load_tag(record), load_value(record), visitor);
+         }
+      }
+
+      template<is_base_dimension Dim, typename Visitor>
+      static void decode_run(const std::byte* records, const std::uint16_t* first, const std::uint16_t* last, Visitor& visitor)
+      {
+         for (; first != last; ++first)
+         {
+            invoke<Dim, Visitor>(load_value(records + *first * record_size), visitor);
+         }
+      }
+   };
+
+} // end Dimension
+
+#endif // DIMENSION_TAG_REGISTRY_H
@@ -1,7 +1,9 @@
 #ifndef DIMENSION_RATIO_UTILS_H
 #define DIMENSION_RATIO_UTILS_H
 
+#include <limits>
 #include <ratio>
+#include <type_traits>
 
 namespace dimension
 {
@@ -52,19 +54,49 @@ namespace dimension
       return negative ? T(1) / result : result;
    }
 
+   /// @brief Compile-time N-th root of x
+   /// @details x is first scaled by powers of 2^N so its root lies in [1, 2), which makes
+   ///    the scaling exact and gives a close initial guess. Newton's method then runs until
+   ///    the iterate stops decreasing, which leaves the result within 1 ULP of the true root.
+   /// @tparam T Floating-point type
+   /// @param x Value to take the root of
+   /// @param N Degree of the root, must be positive
+   /// @param max_iterations Upper bound on Newton iterations, only reached for pathological input
    template<typename T>
-   constexpr T constexpr_root(T x, int N, int iterations = 20) {
+   constexpr T constexpr_root(T x, int N, int max_iterations = 100) {
       static_assert(std::is_floating_point_v<T>, "T must be a floating-point type");
 
-      if (x == T(0)) return T(0);
-      if (x < T(0) && N % 2 == 0)
+      if (N <= 0)
          return std::numeric_limits<T>::quiet_NaN();
+      if (N == 1 || x == T(0))
+         return x;
+      if (x < T(0))
+         return (N % 2 == 0) ? std::numeric_limits<T>::quiet_NaN() : -constexpr_root(-x, N, max_iterations);
+      if (x != x || x == std::numeric_limits<T>::infinity())
+         return x;
+
+      // Scale x into [1, 2^N), accumulating the matching power of two for the root
+      const T step = constexpr_int_pow(T(2), N);
+      T scale = T(1);
+      while (x >= step) { x /= step; scale *= T(2); }
+      while (x < T(1)) { x *= step; scale /= T(2); }
+
+      // Linear interpolation of the root between 1 and 2
+      T guess = T(1) + (x - T(1)) / (step - T(1));
+
+      const T n = static_cast<T>(N);
+
+      // The first Newton step lands at or above the root, after which iterates decrease monotonically
+      guess = ((n - T(1)) * guess + x / constexpr_int_pow(guess, N - 1)) / n;
+      for (int i = 0; i < max_iterations; ++i)
+      {
+         const T next = ((n - T(1)) * guess + x / constexpr_int_pow(guess, N - 1)) / n;
+         if (!(next < guess))
+            break;
+         guess = next;
+      }
 
-      T guess = x / N;
-      for (int i = 0; i < iterations; ++i)
-         guess = ((N - 1) * guess + x / constexpr_int_pow(guess, N - 1)) / N;
-
-      return guess;
+      return guess * scale;
    }
 
    template<typename T>
@@ -73,7 +105,7 @@ namespace dimension
       if (den == 1)
          return raised;
       else
-         return constexpr_root<T>(raised, den); // placeholder, will fail to compile
+         return constexpr_root<T>(raised, den);
    }
 
    template<typename T>
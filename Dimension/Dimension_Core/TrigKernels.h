@@ -0,0 +1,261 @@
+#ifndef DIMENSION_TRIG_KERNELS_H
+#define DIMENSION_TRIG_KERNELS_H
+
+#include <cmath> // For std::sin, std::cos, std::atan2, std::copysign
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::int32_t
+#include <type_traits>
+
+namespace dimension
+{
+
+   namespace kernels
+   {
+      namespace trig_detail
+      {
+         /// @brief Reduction constants and minimax coefficients for the trig kernels
+         template<typename T>
+         struct constants;
+
+         template<>
+         struct constants<double>
+         {
+            using reduce_type = double;
+
+            static constexpr double two_over_pi = 0.63661977236758134308;
+
+            // pi/2 split into 33-bit pieces, so k * piece is exact for |k| < 2^20
+            static constexpr double pio2_1 = 1.57079632673412561417e+00;
+            static constexpr double pio2_2 = 6.07710050630396597660e-11;
+            static constexpr double pio2_3 = 2.02226624871116645580e-21;
+
+            /// @brief Largest |x| reduced by the kernel, larger values fall back to libm
+            static constexpr double max_reduced = 1.0e5;
+
+            /// @brief Adding and subtracting 1.5 * 2^52 rounds to the nearest integer
+            static constexpr double round_magic = 6755399441055744.0;
+
+            // sin(r) = r + r * z * S(z), cos(r) = 1 - z / 2 + z * z * C(z), z = r * r, |r| <= pi / 4
+            static constexpr double s0 = 1.58962301576546568060E-10;
+            static constexpr double s1 = -2.50507477628578072866E-8;
+            static constexpr double s2 = 2.75573136213857245213E-6;
+            static constexpr double s3 = -1.98412698295895385996E-4;
+            static constexpr double s4 = 8.33333333332211858878E-3;
+            static constexpr double s5 = -1.66666666666666307295E-1;
+
+            static constexpr double c0 = -1.13585365213876817300E-11;
+            static constexpr double c1 = 2.08757008419747316778E-9;
+            static constexpr double c2 = -2.75573141792967388112E-7;
+            static constexpr double c3 = 2.48015872888517045348E-5;
+            static constexpr double c4 = -1.38888888888730564116E-3;
+            static constexpr double c5 = 4.16666666666665929218E-2;
+
+            // atan(t) = t + t * z * P(z) / Q(z), z = t * t, |t| <= 0.66
+            static constexpr double atan_split = 0.66;
+            static constexpr double p0 = -8.750608600031904122785E-1;
+            static constexpr double p1 = -1.615753718733365076637E1;
+            static constexpr double p2 = -7.500855792314704667340E1;
+            static constexpr double p3 = -1.228866684490136173410E2;
+            static constexpr double p4 = -6.485021904942025371773E1;
+            static constexpr double q0 = 2.485846490142306297962E1;
+            static constexpr double q1 = 1.650270098316988542046E2;
+            static constexpr double q2 = 4.328810604912902668951E2;
+            static constexpr double q3 = 4.853903996359136964868E2;
+            static constexpr double q4 = 1.945506571482613964425E2;
+
+            static constexpr double pio4 = 7.85398163397448309616E-1;
+            static constexpr double pio2_hi = 1.57079632679489655800E0;
+            static constexpr double pio2_lo = 6.12323399573676603587E-17;
+            static constexpr double pi_hi = 3.14159265358979311600E0;
+            static constexpr double pi_lo = 1.22464679914735317720E-16;
+
+            static constexpr double atan(double t, double z)
+            {
+               const double p = (((p0 * z + p1) * z + p2) * z + p3) * z + p4;
+               const double q = ((((z + q0) * z + q1) * z + q2) * z + q3) * z + q4;
+               return t + t * (z * p / q);
+            }
+
+            static constexpr double sin_poly(double r, double z)
+            {
+               return r + r * z * (((((s0 * z + s1) * z + s2) * z + s3) * z + s4) * z + s5);
+            }
+
+            static constexpr double cos_poly(double z)
+            {
+               return 1.0 - 0.5 * z + z * z * (((((c0 * z + c1) * z + c2) * z + c3) * z + c4) * z + c5);
+            }
+         };
+
+         template<>
+         struct constants<float>
+         {
+            // A float split of pi/2 loses most of r close to multiples of pi/2, so the
+            // argument is reduced in double and only the polynomials are evaluated in float
+            using reduce_type = double;
+
+            static constexpr float s0 = -1.9515295891E-4f;
+            static constexpr float s1 = 8.3321608736E-3f;
+            static constexpr float s2 = -1.6666654611E-1f;
+
+            static constexpr float c0 = 2.443315711809948E-5f;
+            static constexpr float c1 = -1.388731625493765E-3f;
+            static constexpr float c2 = 4.166664568298827E-2f;
+
+            // atan(t) = t + t * z * P(z), z = t * t, |t| <= tan(pi / 8)
+            static constexpr float atan_split = 0.4142135623730950f;
+            static constexpr float p0 = 8.05374449538e-2f;
+            static constexpr float p1 = -1.38776856032E-1f;
+            static constexpr float p2 = 1.99777106478E-1f;
+            static constexpr float p3 = -3.33329491539E-1f;
+
+            static constexpr float pio4 = 0.785398163397448309616f;
+            static constexpr float pio2_hi = 1.57079637f;
+            static constexpr float pio2_lo = -4.37113883e-8f;
+            static constexpr float pi_hi = 3.14159274f;
+            static constexpr float pi_lo = -8.74227766e-8f;
+
+            static constexpr float atan(float t, float z)
+            {
+               return t + t * z * (((p0 * z + p1) * z + p2) * z + p3);
+            }
+
+            static constexpr float sin_poly(float r, float z)
+            {
+               return r + r * z * ((s0 * z + s1) * z + s2);
+            }
+
+            static constexpr float cos_poly(float z)
+            {
+               return 1.0f - 0.5f * z + z * z * ((c0 * z + c1) * z + c2);
+            }
+         };
+
+         template<bool WantSin, bool WantCos, typename T>
+         void sincos(const T* in, T* sin_out, T* cos_out, std::size_t n, T scale) noexcept
+         {
+            using c = constants<T>;
+            using R = typename c::reduce_type;
+            using rc = constants<R>;
+
+            // Branch-free body, vectorized by the compiler
+            for (std::size_t i = 0; i < n; ++i)
+            {
+               // Arguments the second loop replaces are reduced as zero, so k always fits an int32
+               const auto raw = static_cast<R>(in[i] * scale);
+               const R x = std::abs(raw) <= rc::max_reduced ? raw : R{0};
+
+               // Reduce to r in [-pi/4, pi/4] with x = k * pi/2 + r
+               const R k = (x * rc::two_over_pi + rc::round_magic) - rc::round_magic;
+               const auto r = static_cast<T>(((x - k * rc::pio2_1) - k * rc::pio2_2) - k * rc::pio2_3);
+               const T z = r * r;
+               const auto quadrant = static_cast<std::int32_t>(k);
+
+               const T s = c::sin_poly(r, z);
+               const T co = c::cos_poly(z);
+               const bool swap = (quadrant & 1) != 0;
+
+               if constexpr (WantSin)
+               {
+                  const T value = swap ? co : s;
+                  sin_out[i] = (quadrant & 2) != 0 ? -value : value;
+               }
+               if constexpr (WantCos)
+               {
+                  const T value = swap ? s : co;
+                  cos_out[i] = ((quadrant + 1) & 2) != 0 ? -value : value;
+               }
+            }
+
+            // Arguments outside the reduction range, and NaN or infinity, use libm
+            for (std::size_t i = 0; i < n; ++i)
+            {
+               const T x = in[i] * scale;
+               if (!(static_cast<R>(std::abs(x)) <= rc::max_reduced))
+               {
+                  if constexpr (WantSin) { sin_out[i] = std::sin(x); }
+                  if constexpr (WantCos) { cos_out[i] = std::cos(x); }
+               }
+            }
+         }
+      }
+
+      /// @brief sin_out[i] = sin(in[i] * scale), cos_out[i] = cos(in[i] * scale) in one pass
+      /// @details Arguments are reduced modulo pi/2 with a three-part Cody-Waite split and
+      ///    evaluated with minimax polynomials in a branch-free loop the compiler vectorizes.
+      ///    float arguments are reduced in double and evaluated in float.
+      ///    For |in[i] * scale| up to 1e5, results are within 3 ULP of the correctly rounded
+      ///    value for double and 2 ULP for float. Larger arguments, NaN and infinity are
+      ///    passed to std::sin and std::cos.
+      ///    The outputs must not overlap in.
+      template<typename T>
+      requires std::is_floating_point_v<T>
+      void sincos(const T* in, T* sin_out, T* cos_out, std::size_t n, T scale) noexcept
+      {
+         trig_detail::sincos<true, true>(in, sin_out, cos_out, n, scale);
+      }
+
+      /// @brief out[i] = sin(in[i] * scale), see sincos for accuracy
+      template<typename T>
+      requires std::is_floating_point_v<T>
+      void sin(const T* in, T* out, std::size_t n, T scale) noexcept
+      {
+         trig_detail::sincos<true, false>(in, out, static_cast<T*>(nullptr), n, scale);
+      }
+
+      /// @brief out[i] = cos(in[i] * scale), see sincos for accuracy
+      template<typename T>
+      requires std::is_floating_point_v<T>
+      void cos(const T* in, T* out, std::size_t n, T scale) noexcept
+      {
+         trig_detail::sincos<false, true>(in, static_cast<T*>(nullptr), out, n, scale);
+      }
+
+      /// @brief out[i] = atan2(y[i], x[i] * x_scale), in radians
+      /// @details The ratio of the smaller to the larger magnitude is reduced about tan(pi/8)
+      ///    or 0.66 and evaluated with a minimax approximation in a branch-free loop the
+      ///    compiler vectorizes. Results are within 2 ULP of the correctly rounded value for
+      ///    double and 4 ULP for float. Zeros, NaN and infinity are passed to std::atan2.
+      ///    out must not overlap the inputs.
+      template<typename T>
+      requires std::is_floating_point_v<T>
+      void atan2(const T* y, const T* x, T* out, std::size_t n, T x_scale) noexcept
+      {
+         using c = trig_detail::constants<T>;
+
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            const T yv = y[i];
+            const T xv = x[i] * x_scale;
+            const T ax = std::abs(xv);
+            const T ay = std::abs(yv);
+
+            const bool steep = ay > ax;
+            const T a = steep ? ax / ay : ay / ax;
+
+            // atan(a) = pi/4 + atan((a - 1) / (a + 1)) above the split
+            const bool shifted = a > c::atan_split;
+            const T t = shifted ? (a - T{1}) / (a + T{1}) : a;
+            const T base = c::atan(t, t * t);
+            T r = shifted ? c::pio4 + base : base;
+
+            r = steep ? (c::pio2_hi - r) + c::pio2_lo : r;
+            r = xv < T{0} ? (c::pi_hi - r) + c::pi_lo : r;
+            out[i] = std::copysign(r, yv);
+         }
+
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            const T yv = y[i];
+            const T xv = x[i] * x_scale;
+            if (!(std::isfinite(xv) && std::isfinite(yv)) || (xv == T{0} && yv == T{0}))
+            {
+               out[i] = std::atan2(yv, xv);
+            }
+         }
+      }
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_TRIG_KERNELS_H
@@ -1,6 +1,9 @@
 #ifndef DIMENSION_TUPLE_HANDLING_H
 #define DIMENSION_TUPLE_HANDLING_H
 
+#include <algorithm> // For std::sort
+#include <array> // For std::array
+#include <string_view> // For std::string_view
 #include <tuple> // For std::tuple and related functions
 #include <type_traits> // For std::is_same, std::remove_cv, std::disjunction, std::conditional
 #include <utility> // For std::declval
@@ -72,13 +75,54 @@ namespace dimension
    };
 
    /// @brief Sort tuple type based on qualified name
+   /// @details The order is found by a constexpr std::sort over the names, in O(n log n) comparisons,
+   ///    and the sorted tuple is then built in a single pack expansion. Only one class template is
+   ///    instantiated per sorted tuple, rather than one per swap. Equal names keep their original order.
+   /// @tparam Tuple Tuple type to sort, each element providing a StringLiteral qualifiedName
+   template <typename Tuple>
+   struct tuple_sort
+   {
+   private:
+      template <std::size_t... Is>
+      static constexpr auto order(std::index_sequence<Is...>)
+      {
+         constexpr std::size_t N = sizeof...(Is);
+         constexpr std::array<std::string_view, N> names{
+            std::string_view(std::tuple_element_t<Is, Tuple>::qualifiedName.value.data(),
+                             std::tuple_element_t<Is, Tuple>::qualifiedName.size - 1)...
+         };
+
+         std::array<std::size_t, N> indices{Is...};
+         std::sort(indices.begin(), indices.end(), [&](std::size_t lhs, std::size_t rhs)
+         {
+            return (names[lhs] < names[rhs]) || (names[lhs] == names[rhs] && lhs < rhs);
+         });
+         return indices;
+      }
+
+      static constexpr auto sorted = order(std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+
+      template <std::size_t... Is>
+      static auto rebuild(std::index_sequence<Is...>) -> std::tuple<std::tuple_element_t<sorted[Is], Tuple>...>;
+
+   public:
+      using type = decltype(rebuild(std::make_index_sequence<std::tuple_size_v<Tuple>>{}));
+   };
+
+   /// @brief Convenience alias for the sorted type of a tuple
+   template <typename Tuple>
+   using tuple_sort_t = typename tuple_sort<Tuple>::type;
+
+   /// @brief Sort tuple type based on qualified name, by bubble sort
+   /// @details Superseded by tuple_sort, which gives the same order and instantiates far
+   ///    fewer templates. Kept for existing users and for comparison.
    /// @tparam Tuple Tuple type to sort
    /// @tparam N Current index to evaluate
    template <typename Tuple, std::size_t N = std::tuple_size_v<Tuple>>
    struct tuple_bubble_sort 
    {
    private:
-      // Perform one pass of bubble sort
+      // Perform one pass of bubble sort, moving the largest of the first N elements to index N - 1
       template <std::size_t Index = 0, typename CurrentTuple = Tuple>
       struct one_pass 
       {
@@ -86,12 +130,13 @@ namespace dimension
          using ThisElement = std::tuple_element_t<Index, CurrentTuple>;
          using NextElement = std::tuple_element_t<Index + 1, CurrentTuple>;
 
-         using type = std::conditional_t<
-            (Index < N - 1) && !(ThisElement::qualifiedName < NextElement::qualifiedName),
+         // Only swap strictly greater pairs, so equal names keep their order
+         using swapped = std::conditional_t<
+            (NextElement::qualifiedName < ThisElement::qualifiedName),
             typename tuple_swap<CurrentTuple, Index, Index + 1>::type, 
             CurrentTuple>;
 
-         using next_type = typename one_pass<Index + 1, type>::type;
+         using type = typename one_pass<Index + 1, swapped>::type;
       };
 
       // Base case for one_pass recursion
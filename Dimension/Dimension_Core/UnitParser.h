@@ -0,0 +1,467 @@
+#ifndef DIMENSION_UNIT_PARSER_H
+#define DIMENSION_UNIT_PARSER_H
+
+#include <array>
+#include <charconv> // For std::from_chars
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::uint8_t, std::uint64_t
+#include <optional>
+#include <stdexcept> // For std::invalid_argument
+#include <string_view>
+#include <system_error> // For std::errc
+#include <tuple>
+
+#include "DynamicQuantity.h"
+#include "PrecisionType.h"
+#include "SI_Macro.h"
+#include "StringLiteral.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   /// @brief The characters of a unit symbol of up to 16 characters packed into two words
+   struct symbol_key
+   {
+      std::uint64_t low = 0;
+      std::uint64_t high = 0;
+
+      friend constexpr bool operator==(const symbol_key& lhs, const symbol_key& rhs) noexcept = default;
+   };
+
+   /// @brief One unit symbol of a unit_table
+   struct unit_entry
+   {
+      static constexpr std::size_t max_length = 16;
+
+      std::array<char, max_length> text{};
+      std::uint8_t length = 0;
+      symbol_key key;
+      PrecisionType scale = 1.0;
+      PrecisionType inverse = 1.0;
+      dimension_signature signature;
+
+      [[nodiscard]] constexpr std::string_view symbol() const noexcept { return std::string_view(text.data(), length); }
+   };
+
+   /// @brief Error of a failed parse
+   enum class parse_errc
+   {
+      ok,
+      invalid_number,
+      unknown_unit,
+      invalid_exponent,
+      unexpected_character,
+      dimension_mismatch
+   };
+
+   namespace parse_detail
+   {
+      /// @brief SI prefixes with their abbreviations, in the order of ALL_SI_PREFIXES
+      template<typename Prefix, StringLiteral Abbr>
+      struct si_prefix
+      {
+         static constexpr std::string_view abbr{Abbr.value.data(), Abbr.size - 1};
+         static constexpr PrecisionType factor = SIFactor<Prefix>::value;
+      };
+
+      using si_prefixes = std::tuple<
+         si_prefix<pico, "p">, si_prefix<nano, "n">, si_prefix<micro, "u">, si_prefix<milli, "m">,
+         si_prefix<centi, "c">, si_prefix<deci, "d">, si_prefix<deca, "da">, si_prefix<hecto, "h">,
+         si_prefix<kilo, "k">, si_prefix<mega, "M">, si_prefix<giga, "G">, si_prefix<tera, "T">>;
+
+      inline constexpr std::size_t slot_bits = 12;
+      inline constexpr std::uint8_t empty_slot = 0xff;
+
+      /// @brief Pack a symbol into a symbol_key, symbols are letters so no two share a key
+      constexpr symbol_key make_key(std::string_view text) noexcept
+      {
+         symbol_key key;
+         for (std::size_t i = 0; i < text.size() && i < unit_entry::max_length; ++i)
+         {
+            const std::uint64_t byte = static_cast<std::uint8_t>(text[i]);
+            (i < 8 ? key.low : key.high) |= byte << (8 * (i % 8));
+         }
+         return key;
+      }
+
+      /// @brief Multiplicative hash of a symbol_key into a slot
+      constexpr std::size_t hash(const symbol_key& key, std::uint64_t seed) noexcept
+      {
+         return static_cast<std::size_t>(((key.low ^ (key.high * 0x9e3779b97f4a7c15u)) * seed) >> (64 - slot_bits));
+      }
+
+      template<std::size_t N>
+      constexpr unit_entry make_entry(std::string_view prefix, const StringLiteral<N>& abbr, PrecisionType scale, dimension_signature signature)
+      {
+         if (prefix.size() + N - 1 > unit_entry::max_length)
+         {
+            throw std::invalid_argument("Unit abbreviation is too long for a unit_table");
+         }
+
+         unit_entry entry;
+         std::size_t length = 0;
+         for (const char c : prefix)
+         {
+            entry.text[length++] = c;
+         }
+         for (std::size_t i = 0; i + 1 < N; ++i)
+         {
+            entry.text[length++] = abbr.value[i];
+         }
+         entry.length = static_cast<std::uint8_t>(length);
+         entry.key = make_key(entry.symbol());
+         entry.scale = scale;
+         entry.inverse = 1.0 / scale;
+         entry.signature = signature;
+         return entry;
+      }
+
+      template<typename Unit>
+      using unit_dimension = base_dimension_impl<PrecisionType, unit_exponent<Unit>>;
+
+      /// @brief Write the entries of Unit with every prefix of Prefixes starting at out
+      template<typename Unit, typename... Prefixes>
+      constexpr void add_prefixed(unit_entry* out, std::tuple<Prefixes...>*)
+      {
+         ((*out++ = make_entry(Prefixes::abbr, Unit::abbr, Prefixes::factor * primary_scale_v<unit_dimension<Unit>>,
+                               dimension_signature_v<unit_dimension<Unit>>)), ...);
+      }
+
+      template<typename Units>
+      struct unit_count;
+
+      template<typename... Units>
+      struct unit_count<std::tuple<Units...>> : std::integral_constant<std::size_t, sizeof...(Units)> {};
+   }
+
+   /// @brief Compile-time perfect hash table from unit symbols to their scale and dimensions
+   /// @details A seed is searched at compile time so that every symbol lands in its own slot of a
+   ///    4096-entry index, so a lookup is one hash, one byte load and one compare.
+   /// @tparam N The number of symbols, at most 255
+   template<std::size_t N>
+   class unit_table
+   {
+      static_assert(N < parse_detail::empty_slot, "A unit_table holds at most 254 symbols");
+
+   public:
+      /// @throws std::invalid_argument if two symbols are equal, a compile error when constant evaluated
+      explicit constexpr unit_table(const std::array<unit_entry, N>& symbols) : entries(symbols)
+      {
+         for (std::size_t i = 0; i < N; ++i)
+         {
+            for (std::size_t j = i + 1; j < N; ++j)
+            {
+               if (entries[i].symbol() == entries[j].symbol())
+               {
+                  throw std::invalid_argument("Duplicate unit symbol in a unit_table");
+               }
+            }
+         }
+
+         for (std::uint64_t attempt = 1; attempt < 4096; ++attempt)
+         {
+            seed = (attempt * 0x9e3779b97f4a7c15u) | 1u;
+            slots.fill(parse_detail::empty_slot);
+
+            bool collision = false;
+            for (std::size_t i = 0; i < N && !collision; ++i)
+            {
+               auto& slot = slots[parse_detail::hash(entries[i].key, seed)];
+               collision = slot != parse_detail::empty_slot;
+               slot = static_cast<std::uint8_t>(i);
+            }
+
+            if (!collision)
+            {
+               return;
+            }
+         }
+         throw std::invalid_argument("No perfect hash seed found for the unit_table");
+      }
+
+      /// @brief The entry of a symbol, or nullptr if the symbol is unknown
+      [[nodiscard]] constexpr const unit_entry* find(const symbol_key& key) const noexcept
+      {
+         const std::uint8_t index = slots[parse_detail::hash(key, seed)];
+         if (index == parse_detail::empty_slot || entries[index].key != key)
+         {
+            return nullptr;
+         }
+         return &entries[index];
+      }
+
+      /// @brief The entry of a symbol, or nullptr if the symbol is unknown
+      [[nodiscard]] constexpr const unit_entry* find(std::string_view symbol) const noexcept
+      {
+         return symbol.size() > unit_entry::max_length ? nullptr : find(parse_detail::make_key(symbol));
+      }
+
+      [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+      [[nodiscard]] constexpr const std::array<unit_entry, N>& symbols() const noexcept { return entries; }
+
+   private:
+      std::array<unit_entry, N> entries;
+      std::array<std::uint8_t, std::size_t{1} << parse_detail::slot_bits> slots{};
+      std::uint64_t seed = 1;
+   };
+
+   /// @brief Build a unit_table from the abbreviations of fundamental units
+   /// @tparam Units Tuple of the units to include
+   /// @tparam Prefixed Tuple of the units to also include with every SI prefix
+   template<typename Units, typename Prefixed>
+   consteval auto make_unit_table()
+   {
+      constexpr std::size_t prefixes = std::tuple_size_v<parse_detail::si_prefixes>;
+      constexpr std::size_t count = parse_detail::unit_count<Units>::value + prefixes * parse_detail::unit_count<Prefixed>::value;
+
+      std::array<unit_entry, count> entries{};
+      std::size_t next = 0;
+
+      [&]<typename... Us>(std::tuple<Us...>*)
+      {
+         ((entries[next++] = parse_detail::make_entry("", Us::abbr, primary_scale_v<parse_detail::unit_dimension<Us>>,
+                                                      dimension_signature_v<parse_detail::unit_dimension<Us>>)), ...);
+      }(static_cast<Units*>(nullptr));
+
+      [&]<typename... Us>(std::tuple<Us...>*)
+      {
+         ((parse_detail::add_prefixed<Us>(entries.data() + next, static_cast<parse_detail::si_prefixes*>(nullptr)), next += prefixes), ...);
+      }(static_cast<Prefixed*>(nullptr));
+
+      return unit_table<count>(entries);
+   }
+
+   namespace parse_detail
+   {
+      constexpr bool is_letter(char c) noexcept { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+      constexpr bool is_space(char c) noexcept { return c == ' ' || c == '\t'; }
+
+      /// @brief Length of a multiplication or division separator at the start of text, 0 if there is none
+      constexpr std::size_t separator(std::string_view text, bool& divide) noexcept
+      {
+         if (text.empty())
+         {
+            return 0;
+         }
+         divide = text[0] == '/';
+         if (text[0] == '/' || text[0] == '*' || text[0] == '.')
+         {
+            return 1;
+         }
+         // U+00B7 middle dot in UTF-8
+         if (text.size() > 1 && text[0] == '\xc2' && text[1] == '\xb7')
+         {
+            return 2;
+         }
+         return 0;
+      }
+
+      /// @brief Multiply scale and signature by the units of text
+      template<std::size_t N>
+      constexpr parse_errc parse_units(const unit_table<N>& table, std::string_view text, PrecisionType& scale, dimension_signature& signature)
+      {
+         // Accumulate in locals, stores through the references could alias the characters
+         PrecisionType total = scale;
+         dimension_signature combined = signature;
+
+         const char* pos = text.data();
+         const char* const end = text.data() + text.size();
+         bool divide = false;
+         while (pos != end)
+         {
+            // The key is built while scanning, so the symbol is read once
+            const char* const start = pos;
+            std::uint64_t low = 0;
+            std::uint64_t high = 0;
+            for (; pos != end && is_letter(*pos); ++pos)
+            {
+               const auto i = static_cast<std::size_t>(pos - start);
+               const std::uint64_t byte = static_cast<std::uint8_t>(*pos);
+               if (i < 8)
+               {
+                  low |= byte << (8 * i);
+               }
+               else if (i < unit_entry::max_length)
+               {
+                  high |= byte << (8 * (i - 8));
+               }
+               else
+               {
+                  return parse_errc::unknown_unit;
+               }
+            }
+
+            const unit_entry* entry = table.find(symbol_key{low, high});
+            if (entry == nullptr)
+            {
+               return parse_errc::unknown_unit;
+            }
+
+            int exponent = 1;
+            if (pos != end && *pos == '^')
+            {
+               ++pos;
+               const bool negative = pos != end && *pos == '-';
+               pos += negative ? 1 : 0;
+               if (pos == end || *pos < '1' || *pos > '9')
+               {
+                  return parse_errc::invalid_exponent;
+               }
+               exponent = *pos++ - '0';
+               if (pos != end && *pos >= '0' && *pos <= '9')
+               {
+                  return parse_errc::invalid_exponent;
+               }
+               exponent = negative ? -exponent : exponent;
+            }
+
+            const bool inverse = divide != (exponent < 0);
+            for (int i = 0; i < (exponent < 0 ? -exponent : exponent); ++i)
+            {
+               total *= inverse ? entry->inverse : entry->scale;
+               combined = inverse ? combined - entry->signature : combined + entry->signature;
+            }
+
+            if (pos == end)
+            {
+               break;
+            }
+
+            const std::size_t length = separator(std::string_view(pos, static_cast<std::size_t>(end - pos)), divide);
+            if (length == 0 || static_cast<std::size_t>(end - pos) == length)
+            {
+               return parse_errc::unexpected_character;
+            }
+            pos += length;
+         }
+
+         scale = total;
+         signature = combined;
+         return parse_errc::ok;
+      }
+
+      template<std::size_t N>
+      parse_errc parse_quantity(const unit_table<N>& table, std::string_view text, dynamic_quantity& out)
+      {
+         std::size_t first = 0;
+         while (first < text.size() && is_space(text[first]))
+         {
+            ++first;
+         }
+         std::size_t last = text.size();
+         while (last > first && is_space(text[last - 1]))
+         {
+            --last;
+         }
+
+         PrecisionType value{};
+         const auto [end, error] = std::from_chars(text.data() + first, text.data() + last, value);
+         if (error != std::errc{})
+         {
+            return parse_errc::invalid_number;
+         }
+
+         std::size_t pos = static_cast<std::size_t>(end - text.data());
+         while (pos < last && is_space(text[pos]))
+         {
+            ++pos;
+         }
+
+         PrecisionType scale = 1.0;
+         dimension_signature signature;
+         const parse_errc result = parse_units(table, text.substr(pos, last - pos), scale, signature);
+         if (result == parse_errc::ok)
+         {
+            out = dynamic_quantity(value, scale, signature);
+         }
+         return result;
+      }
+
+      inline const char* message(parse_errc error) noexcept
+      {
+         switch (error)
+         {
+            case parse_errc::invalid_number: return "Expected a number";
+            case parse_errc::unknown_unit: return "Unknown unit symbol";
+            case parse_errc::invalid_exponent: return "Expected a single digit exponent after ^";
+            case parse_errc::unexpected_character: return "Unexpected character in unit expression";
+            case parse_errc::dimension_mismatch: return "Parsed units do not match the dimensions of the target type";
+            default: return "";
+         }
+      }
+   }
+
+   /// @brief Parse a quantity such as "12.5 km/h" or "3 ft^2" into a dynamic_quantity
+   /// @details The number is read with std::from_chars and may be followed by spaces. Unit symbols
+   ///    are joined by '*', '.', U+00B7 or '/', where '/' divides by the next symbol only, and each
+   ///    may be raised to a single digit power with '^', such as "kg*m/s^2" or "m.s^-1". No text
+   ///    means a dimensionless value. Nothing is allocated unless an error is thrown.
+   /// @throws std::invalid_argument if the text is not a quantity of known units
+   /// @throws std::out_of_range if an exponent leaves the range of a dimension_signature
+   template<std::size_t N>
+   dynamic_quantity parse_quantity(const unit_table<N>& table, std::string_view text)
+   {
+      dynamic_quantity result;
+      const parse_errc error = parse_detail::parse_quantity(table, text, result);
+      if (error != parse_errc::ok)
+      {
+         throw std::invalid_argument(parse_detail::message(error));
+      }
+      return result;
+   }
+
+   /// @brief Parse units such as "km/h" into a dynamic_quantity of one of them
+   /// @throws std::invalid_argument if the text is not an expression of known units
+   template<std::size_t N>
+   dynamic_quantity parse_unit(const unit_table<N>& table, std::string_view text)
+   {
+      PrecisionType scale = 1.0;
+      dimension_signature signature;
+      const parse_errc error = parse_detail::parse_units(table, text, scale, signature);
+      if (error != parse_errc::ok)
+      {
+         throw std::invalid_argument(parse_detail::message(error));
+      }
+      return dynamic_quantity(1.0, scale, signature);
+   }
+
+   /// @brief Parse a quantity into a static dimension type, see parse_quantity for the format
+   /// @throws std::invalid_argument if the text is not a quantity or has other dimensions than Dim
+   template<is_base_dimension Dim, std::size_t N>
+   Dim parse(const unit_table<N>& table, std::string_view text)
+   {
+      return quantity_cast<Dim>(parse_quantity(table, text));
+   }
+
+   /// @brief Parse a quantity without throwing
+   /// @param error Set to the reason when no value is returned
+   template<is_base_dimension Dim, std::size_t N>
+   std::optional<Dim> try_parse(const unit_table<N>& table, std::string_view text, parse_errc& error) noexcept
+   {
+      dynamic_quantity result;
+      try
+      {
+         error = parse_detail::parse_quantity(table, text, result);
+      }
+      catch (const std::out_of_range&)
+      {
+         error = parse_errc::invalid_exponent;
+      }
+
+      if (error != parse_errc::ok)
+      {
+         return std::nullopt;
+      }
+      if (!has_dimensions_of<Dim>(result))
+      {
+         error = parse_errc::dimension_mismatch;
+         return std::nullopt;
+      }
+      return quantity_cast<Dim>(result);
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_UNIT_PARSER_H
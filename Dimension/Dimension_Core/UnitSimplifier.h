@@ -10,6 +10,7 @@
 #include "TupleHandling.h"
 
 #include "FundamentalUnitExtractor.h"
+#include "RepTraits.h"
 
 namespace dimension
 {
@@ -209,35 +210,17 @@ namespace dimension
       template<int Root>
       constexpr double RootInt(double value)
       {
-         static_assert(Root != 0, "RootInt<0> is undefined.");
+         static_assert(Root > 0, "RootInt requires a positive root.");
 
-         return std::pow(value, 1.0 / static_cast<double>(Root));
+         return constexpr_root<double>(value, Root);
       }
 
       template<>
-      inline double RootInt<1>(double value)
+      constexpr double RootInt<1>(double value)
       {
          return value;
       }
 
-      template<>
-      inline double RootInt<2>(double value)
-      {
-         return std::sqrt(value);
-      }
-
-      template<>
-      inline double RootInt<3>(double value)
-      {
-         return std::cbrt(value);
-      }
-
-      template<>
-      inline double RootInt<4>(double value)
-      {
-         return std::sqrt(std::sqrt(value));
-      }
-
    }
 
    template<typename StartingUnit, typename TargetUnit>
@@ -263,8 +246,8 @@ namespace dimension
       }
    }
 
-   template<typename TargetUnit, typename Unit>
-   constexpr double DoConversion(double value)
+   template<typename TargetUnit, typename Unit, typename T>
+   constexpr T DoConversion(T value)
    {
       // Assumptions for now:
       // Only called on deltas (deal with this once Quantities are working)
@@ -272,11 +255,14 @@ namespace dimension
 
       if constexpr (Unit::exponent::den == 1)
       {
-         return value * Math::PowInt<Unit::exponent::num>(scale);
+         constexpr double factor = Math::PowInt<Unit::exponent::num>(scale);
+         return rep_traits<T>::scale(value, factor);
       }
       else
       {
-         return value * Math::RootInt<Unit::exponent::den>(Math::PowInt<Unit::exponent::num>(scale));
+         // Fractional exponents are resolved at compile time as well
+         constexpr double factor = Math::RootInt<Unit::exponent::den>(Math::PowInt<Unit::exponent::num>(scale));
+         return rep_traits<T>::scale(value, factor);
       }
    }
 
@@ -291,7 +277,8 @@ namespace dimension
    struct Convert_All_Units<TargetUnit, std::tuple<>> {
        using units = std::tuple<>;
    
-       static constexpr double Convert(double val) {
+       template<typename T>
+       static constexpr T Convert(T val) {
            return val;
        }
    };
@@ -315,7 +302,8 @@ namespace dimension
            typename tail_result::units
        >;
    
-       static constexpr double Convert(double val) {
+       template<typename T>
+       static constexpr T Convert(T val) {
            if constexpr (same_dim) {
                val = DoConversion<TargetUnit, Unit>(val);
            }
@@ -334,7 +322,8 @@ namespace dimension
    struct Convert_All_Dims<std::tuple<>> {
        using units = std::tuple<>;
    
-       static constexpr double Convert(double val) {
+       template<typename T>
+       static constexpr T Convert(T val) {
            return val;
        }
    };
@@ -356,8 +345,9 @@ namespace dimension
            typename next::units
        >;
    
-       static constexpr double Convert(double val) {
-           double after_conversion = converted::Convert(val);
+       template<typename T>
+       static constexpr T Convert(T val) {
+           T after_conversion = converted::Convert(val);
            return next::Convert(after_conversion);
        }
    };
@@ -402,10 +392,12 @@ namespace dimension
       using dimType = typename base_dimensionFromTuple<final_units>::dim;
    };
 
+   /// @brief Convert every unit of a dimension to one unit per fundamental dimension and cancel them
+   /// @details The Rep of the input is preserved
    template<typename Dim>
    constexpr auto FullSimplify(Dim input) {
       using simplify_type = FullSimplifyType<typename Dim::units>;
-      using result_type   = typename simplify_type::dimType;
+      using result_type   = typename base_dimensionFromTuple<typename Dim::rep, typename simplify_type::final_units, std::tuple<>>::dim;
 
       return result_type{simplify_type::after_conversion::Convert(input.template get_tuple_scalar<typename Dim::units>())};
    }
@@ -580,6 +572,26 @@ namespace dimension
    // ======================= ConvertDim =========================
    // ============================================================
 
+   /// @brief Fold the full simplification of two unit tuples into a single scale factor
+   /// @details Every step of the simplification is a pure scale, so converting 1.0
+   ///    yields the factor applied to any other value
+   template<typename FromTuple, typename ToTuple>
+   constexpr double ComputeConversionFactor()
+   {
+      using RawFrom = typename base_dimensionFromTuple<FromTuple>::dim;
+      using RawTo = typename base_dimensionFromTuple<ToTuple>::dim;
+
+      using FromFullySimplified = decltype(FullSimplify(RawFrom(1.0)));
+      using ToFullySimplified = decltype(FullSimplify(RawTo(1.0)));
+
+      constexpr double from_scalar = FullSimplify(RawFrom(1.0)).template get_tuple_scalar<typename FromFullySimplified::units>();
+      constexpr double inverse_scalar = 1.0 / (FullSimplify(RawTo(1.0)).template get_tuple_scalar<typename ToFullySimplified::units>());
+
+      using converter = ConvertSimplified<typename FromFullySimplified::units, typename ToFullySimplified::units>;
+
+      return from_scalar * inverse_scalar * converter::scalar;
+   }
+
    template<typename FromTuple, typename ToTuple>
    struct ConvertDim
    {
@@ -596,21 +608,22 @@ namespace dimension
        using FromRemaining = typename RemoveZeros<FromRemainingRaw>::units;
        using ToRemaining = typename RemoveZeros<ToRemainingRaw>::units;
 
+      /// @brief Value of one unit of FromTuple expressed in ToTuple, resolved at compile time
+      static constexpr double factor = ComputeConversionFactor<FromTuple, ToTuple>();
+
       static constexpr double Convert(double value) 
       {
-
-         using FromFullySimplified = decltype(FullSimplify(RawFrom(1.0)));
-         using ToFullySimplified = decltype(FullSimplify(RawTo(1.0)));
-
-         FromFullySimplified fullSimplified = FullSimplify(RawFrom(value));
-         constexpr double inverse_scalar = 1.0 / (FullSimplify(RawTo(1.0)).template get_tuple_scalar<typename ToFullySimplified::units>());
-
-         using converter = ConvertSimplified<typename FromFullySimplified::units, typename ToFullySimplified::units>;
-
-         return fullSimplified.template get_tuple_scalar<typename FromFullySimplified::units>() * inverse_scalar * converter::scalar;
-   }
+         return value * factor;
+      }
    };
 
+   /// @brief Compile-time factor converting a value in FromTuple units to ToTuple units
+   /// @details Converting between unit tuples is always a single multiply by this value
+   /// @tparam FromTuple Tuple of unit_exponents to convert from
+   /// @tparam ToTuple Tuple of unit_exponents to convert to
+   template<typename FromTuple, typename ToTuple>
+   inline constexpr double conversion_factor_v = ConvertDim<FromTuple, ToTuple>::factor;
+
    template<typename... Units>
    struct FlipExponents;
    
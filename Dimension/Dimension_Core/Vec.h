@@ -0,0 +1,328 @@
+#ifndef DIMENSION_VEC_H
+#define DIMENSION_VEC_H
+
+#include <array>
+#include <cmath> // For std::sqrt, std::fma
+#include <cstddef> // For std::size_t
+#include <type_traits>
+#include <utility> // For std::declval
+
+#include "Coefficient.h"
+#include "PrecisionType.h"
+#include "SimdRep.h"
+#include "UnitSimplifier.h"
+#include "base_dimension_signature.h"
+
+namespace dimension
+{
+
+   template<std::size_t N, is_base_dimension Dim>
+   class vec;
+
+   /// @brief Check if a type is a vec
+   template<typename T>
+   struct is_vec : std::false_type {};
+
+   template<std::size_t N, typename Dim>
+   struct is_vec<vec<N, Dim>> : std::true_type {};
+
+   namespace vec_detail
+   {
+      /// @brief Factor taking a raw value of From to a raw value of To, coefficients included
+      template<typename From, typename To>
+      inline constexpr PrecisionType raw_factor_v = coefficient_factor_v<From> *
+                                                    conversion_factor_v<typename From::units, typename To::units> /
+                                                    coefficient_factor_v<To>;
+
+      /// @brief a * b + c, as one fused instruction when the target has FMA
+      template<typename T>
+      constexpr T multiply_add(T a, T b, T c)
+      {
+         #if defined(__FMA__)
+         if constexpr (std::is_floating_point_v<T>)
+         {
+            if (!std::is_constant_evaluated())
+            {
+               return std::fma(a, b, c);
+            }
+         }
+         #endif
+         return a * b + c;
+      }
+
+      /// @brief Dimension of the product of one element of Lhs and one of Rhs, as given by operator*
+      template<typename Lhs, typename Rhs>
+      using product_t = std::remove_cvref_t<decltype(std::declval<Lhs>() * std::declval<Rhs>())>;
+
+      /// @brief Dimension of the quotient of one element of Lhs and one of Rhs, as given by operator/
+      template<typename Lhs, typename Rhs>
+      using quotient_t = std::remove_cvref_t<decltype(std::declval<Lhs>() / std::declval<Rhs>())>;
+   }
+
+   /// @brief Fixed-size vector of N components sharing one dimension, such as a position or a force
+   /// @details Components are stored as packed raw Rep values in the units of Dim. vec2 and vec4
+   ///    are aligned to their full width, so the compiler maps componentwise operations onto
+   ///    SIMD registers. As with base_dimension, operations between vectors in different units of the
+   ///    same dimension convert with one compile-time factor, and products take their units from operator*.
+   /// @tparam N Number of components
+   /// @tparam Dim The dimension type of each component, such as length<meters>
+   template<std::size_t N, is_base_dimension Dim>
+   class vec
+   {
+      static_assert(N > 0, "vec must have at least one component");
+
+   public:
+      using dimension_type = Dim;
+      using rep = typename Dim::rep;
+      using units = typename Dim::units;
+      using raw_type = std::array<rep, N>;
+
+      [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+      /// @brief Zero vector
+      constexpr vec() noexcept = default;
+
+      /// @brief Construct from N components of the same dimension, each converted to the units of Dim
+      template<is_base_dimension... Components>
+      requires (sizeof...(Components) == N && (matching_dimensions<Dim, Components> && ...))
+      constexpr explicit(N == 1) vec(const Components&... values)
+         : components{to_raw(values)...}
+      {
+      }
+
+      /// @brief Convert from a vector of the same dimension in other units
+      template<is_base_dimension Other>
+      requires (matching_dimensions<Dim, Other> && !std::is_same_v<Dim, Other>)
+      // Implicit conversion between matching units mirrors base_dimension
+      // cppcheck-suppress noExplicitConstructor
+      constexpr vec(const vec<N, Other>& other)
+      {
+         constexpr auto factor = static_cast<rep>(vec_detail::raw_factor_v<Other, Dim>);
+         for (std::size_t i = 0; i < N; ++i)
+         {
+            components[i] = static_cast<rep>(other.raw()[i]) * factor;
+         }
+      }
+
+      /// @brief Construct from raw values already expressed in the units of Dim
+      [[nodiscard]] static constexpr vec from_raw(const raw_type& values) noexcept
+      {
+         vec result;
+         result.components = values;
+         return result;
+      }
+
+      [[nodiscard]] constexpr Dim operator[](std::size_t index) const { return Dim(components[index]); }
+
+      /// @brief Set one component, converting value to the units of Dim if needed
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      constexpr void set(std::size_t index, const Other& value) { components[index] = to_raw(value); }
+
+      /// @brief Raw components, expressed in the units of Dim
+      [[nodiscard]] constexpr const raw_type& raw() const noexcept { return components; }
+
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      constexpr vec& operator+=(const vec<N, Other>& rhs)
+      {
+         constexpr auto factor = static_cast<rep>(vec_detail::raw_factor_v<Other, Dim>);
+         for (std::size_t i = 0; i < N; ++i) { components[i] += static_cast<rep>(rhs.raw()[i]) * factor; }
+         return *this;
+      }
+
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      constexpr vec& operator-=(const vec<N, Other>& rhs)
+      {
+         constexpr auto factor = static_cast<rep>(vec_detail::raw_factor_v<Other, Dim>);
+         for (std::size_t i = 0; i < N; ++i) { components[i] -= static_cast<rep>(rhs.raw()[i]) * factor; }
+         return *this;
+      }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      constexpr vec& operator*=(Scalar scalar)
+      {
+         for (std::size_t i = 0; i < N; ++i) { components[i] *= static_cast<rep>(scalar); }
+         return *this;
+      }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      constexpr vec& operator/=(Scalar scalar)
+      {
+         for (std::size_t i = 0; i < N; ++i) { components[i] /= static_cast<rep>(scalar); }
+         return *this;
+      }
+
+      constexpr vec operator-() const
+      {
+         vec result;
+         for (std::size_t i = 0; i < N; ++i) { result.components[i] = -components[i]; }
+         return result;
+      }
+
+      /// @brief Sum in the units of lhs
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      friend constexpr vec operator+(vec lhs, const vec<N, Other>& rhs) { return lhs += rhs; }
+
+      /// @brief Difference in the units of lhs
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      friend constexpr vec operator-(vec lhs, const vec<N, Other>& rhs) { return lhs -= rhs; }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      friend constexpr vec operator*(vec lhs, Scalar scalar) { return lhs *= scalar; }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      friend constexpr vec operator*(Scalar scalar, vec rhs) { return rhs *= scalar; }
+
+      template<scalar_operand Scalar>
+      requires std::is_arithmetic_v<Scalar>
+      friend constexpr vec operator/(vec lhs, Scalar scalar) { return lhs /= scalar; }
+
+      /// @brief Componentwise equality, comparing in the units of lhs
+      template<is_base_dimension Other>
+      requires matching_dimensions<Dim, Other>
+      friend constexpr bool operator==(const vec& lhs, const vec<N, Other>& rhs)
+      {
+         const vec converted(rhs);
+         return lhs.components == converted.components;
+      }
+
+      friend constexpr bool operator==(const vec& lhs, const vec& rhs) { return lhs.components == rhs.components; }
+
+   private:
+      template<is_base_dimension Other>
+      static constexpr rep to_raw(const Other& value)
+      {
+         if constexpr (std::is_same_v<Dim, Other>)
+         {
+            return value.template get_tuple_scalar<units>();
+         }
+         else
+         {
+            return static_cast<rep>(get_dimension_tuple<units>(value) / coefficient_factor_v<Dim>);
+         }
+      }
+
+      // A 3-vector stays packed rather than padded to 4 lanes, which costs more bandwidth
+      // over an array of vectors than it saves in loads
+      alignas(simd_alignment<rep, N>()) raw_type components{};
+   };
+
+   template<is_base_dimension Dim>
+   using vec2 = vec<2, Dim>;
+
+   template<is_base_dimension Dim>
+   using vec3 = vec<3, Dim>;
+
+   template<is_base_dimension Dim>
+   using vec4 = vec<4, Dim>;
+
+   /// @brief Scale every component by a dimension, the components take the units of the product
+   template<std::size_t N, is_base_dimension VecDim, is_base_dimension Scale>
+   [[nodiscard]] constexpr auto operator*(const Scale& scale, const vec<N, VecDim>& value)
+   {
+      using result_type = vec_detail::product_t<Scale, VecDim>;
+      using rep = typename result_type::rep;
+
+      // operator* between dimensions multiplies raw values, so the product of raw values is the raw result
+      const auto factor = static_cast<rep>(scale.template get_tuple_scalar<typename Scale::units>());
+      typename vec<N, result_type>::raw_type raw;
+      for (std::size_t i = 0; i < N; ++i) { raw[i] = static_cast<rep>(value.raw()[i]) * factor; }
+      return vec<N, result_type>::from_raw(raw);
+   }
+
+   template<std::size_t N, is_base_dimension VecDim, is_base_dimension Scale>
+   [[nodiscard]] constexpr auto operator*(const vec<N, VecDim>& value, const Scale& scale)
+   {
+      return scale * value;
+   }
+
+   /// @brief Divide every component by a dimension, the components take the units of the quotient
+   template<std::size_t N, is_base_dimension VecDim, is_base_dimension Scale>
+   [[nodiscard]] constexpr auto operator/(const vec<N, VecDim>& value, const Scale& scale)
+   {
+      using result_type = vec_detail::quotient_t<VecDim, Scale>;
+      using rep = typename result_type::rep;
+
+      const auto divisor = static_cast<rep>(scale.template get_tuple_scalar<typename Scale::units>());
+      typename vec<N, result_type>::raw_type raw;
+      for (std::size_t i = 0; i < N; ++i) { raw[i] = static_cast<rep>(value.raw()[i]) / divisor; }
+      return vec<N, result_type>::from_raw(raw);
+   }
+
+   /// @brief Dot product, in the dimension of the product of one component of each vector
+   /// @details velocity . velocity gives a squared speed, force . displacement gives an energy.
+   template<std::size_t N, is_base_dimension LhsDim, is_base_dimension RhsDim>
+   [[nodiscard]] constexpr auto dot(const vec<N, LhsDim>& lhs, const vec<N, RhsDim>& rhs)
+   {
+      using result_type = vec_detail::product_t<LhsDim, RhsDim>;
+      using rep = typename result_type::rep;
+
+      rep result = static_cast<rep>(lhs.raw()[0]) * static_cast<rep>(rhs.raw()[0]);
+      for (std::size_t i = 1; i < N; ++i)
+      {
+         result = vec_detail::multiply_add(static_cast<rep>(lhs.raw()[i]), static_cast<rep>(rhs.raw()[i]), result);
+      }
+      return result_type(result);
+   }
+
+   /// @brief Cross product of two 3-vectors, in the dimension of the product of one component of each
+   /// @details length x force has the units of energy. The torque dimension of this library is
+   ///    energy per angle, so divide by angle<radians>(1.0) to express r x F as a torque.
+   template<is_base_dimension LhsDim, is_base_dimension RhsDim>
+   [[nodiscard]] constexpr auto cross(const vec<3, LhsDim>& lhs, const vec<3, RhsDim>& rhs)
+   {
+      using result_type = vec_detail::product_t<LhsDim, RhsDim>;
+      using rep = typename result_type::rep;
+
+      const auto& a = lhs.raw();
+      const auto& b = rhs.raw();
+      const auto a0 = static_cast<rep>(a[0]), a1 = static_cast<rep>(a[1]), a2 = static_cast<rep>(a[2]);
+      const auto b0 = static_cast<rep>(b[0]), b1 = static_cast<rep>(b[1]), b2 = static_cast<rep>(b[2]);
+
+      return vec<3, result_type>::from_raw({
+         vec_detail::multiply_add(a1, b2, -(a2 * b1)),
+         vec_detail::multiply_add(a2, b0, -(a0 * b2)),
+         vec_detail::multiply_add(a0, b1, -(a1 * b0))
+      });
+   }
+
+   /// @brief Euclidean length of a vector, in the units of its components
+   template<std::size_t N, is_base_dimension Dim>
+   [[nodiscard]] Dim norm(const vec<N, Dim>& value)
+   {
+      using rep = typename Dim::rep;
+
+      rep squares = value.raw()[0] * value.raw()[0];
+      for (std::size_t i = 1; i < N; ++i)
+      {
+         squares = vec_detail::multiply_add(value.raw()[i], value.raw()[i], squares);
+      }
+      return Dim(static_cast<rep>(std::sqrt(squares)));
+   }
+
+   /// @brief Unit vector in the direction of value, dimensionless
+   /// @details Scaling the result by a dimension, such as length<meters>(2.0) * normalize(v),
+   ///    gives a vector of that dimension. A zero vector gives NaN components.
+   template<std::size_t N, is_base_dimension Dim>
+   [[nodiscard]] auto normalize(const vec<N, Dim>& value)
+   {
+      using rep = typename Dim::rep;
+      using result_type = base_dimension_impl<rep>;
+
+      const rep inverse = rep{1} / norm(value).template get_tuple_scalar<typename Dim::units>();
+      typename vec<N, result_type>::raw_type raw;
+      for (std::size_t i = 0; i < N; ++i) { raw[i] = value.raw()[i] * inverse; }
+      return vec<N, result_type>::from_raw(raw);
+   }
+
+} // end Dimension
+
+#endif // DIMENSION_VEC_H
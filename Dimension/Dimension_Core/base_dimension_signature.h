@@ -8,6 +8,13 @@
 namespace dimension
 {
 
+   /// @brief Result of comparing two Reps, either a bool or a lane mask reduced with all() or any()
+   template<typename M>
+   concept rep_comparison = std::convertible_to<M, bool> || requires(const M& mask) {
+      { mask.all() } -> std::convertible_to<bool>;
+      { mask.any() } -> std::convertible_to<bool>;
+   };
+
    template<typename T>
    concept rep_type = requires(T a, T b) {
       { T(a) };                                   // copy constructible
@@ -23,12 +30,12 @@ namespace dimension
       { a *= b } -> std::same_as<T&>;
       { a /= b } -> std::same_as<T&>;
 
-      { a == b } -> std::convertible_to<bool>;
-      { a != b } -> std::convertible_to<bool>;
-      { a <  b } -> std::convertible_to<bool>;
-      { a <= b } -> std::convertible_to<bool>;
-      { a >  b } -> std::convertible_to<bool>;
-      { a >= b } -> std::convertible_to<bool>;
+      { a == b } -> rep_comparison;
+      { a != b } -> rep_comparison;
+      { a <  b } -> rep_comparison;
+      { a <= b } -> rep_comparison;
+      { a >  b } -> rep_comparison;
+      { a >= b } -> rep_comparison;
    };
 
    struct symbol{};
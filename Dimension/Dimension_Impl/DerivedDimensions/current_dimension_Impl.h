@@ -37,7 +37,7 @@ namespace dimension
 
    /// @brief Concept to verify a dimension can be treated as a current type
    template<typename T>
-   concept is_current = std::is_convertible_v<T, base_dimension<
+   concept is_current = std::is_convertible_v<T, base_dimension<typename T::rep,
       unit_exponent<primary_charge, 1>, 
       unit_exponent<primary_timespan, -1>
    >>;
@@ -47,14 +47,14 @@ namespace dimension
    /// @tparam timespanUnit The timespan unit used for all timespan components of current
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<
       is_charge_unit chargeUnit,
       is_timespan_unit timespanUnit,
       is_current DimType>
    // TODO: Unit test this and remove suppression
    [[maybe_unused]]
-   constexpr PrecisionType get_current_as(const DimType& obj)
+   constexpr typename DimType::rep get_current_as(const DimType& obj)
    {
       return get_dimension_as<
          unit_exponent<chargeUnit, 1>,
@@ -66,10 +66,10 @@ namespace dimension
    /// @tparam Named The named unit to extract in terms of
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<IsNamedcurrentUnit Named, is_current DimType>
    // TODO: Unit test this and remove suppression
-   constexpr PrecisionType get_current_as(const DimType& obj)
+   constexpr typename DimType::rep get_current_as(const DimType& obj)
    {
       return call_unpack<typename Named::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
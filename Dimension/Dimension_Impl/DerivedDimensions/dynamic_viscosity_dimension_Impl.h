@@ -62,7 +62,7 @@ namespace dimension
 
    /// @brief Concept to verify a dimension can be treated as a dynamic_viscosity type
    template<typename T>
-   concept is_dynamic_viscosity = std::is_convertible_v<T, base_dimension<
+   concept is_dynamic_viscosity = std::is_convertible_v<T, base_dimension<typename T::rep,
       unit_exponent<primary_mass, 1>, 
       unit_exponent<primary_timespan, -1>, 
       unit_exponent<primary_length, -1>
@@ -74,7 +74,7 @@ namespace dimension
    /// @tparam lengthUnit The length unit used for all length components of dynamic_viscosity
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<
       is_mass_unit massUnit,
       is_timespan_unit timespanUnit,
@@ -82,7 +82,7 @@ namespace dimension
       is_dynamic_viscosity DimType>
    // TODO: Unit test this and remove suppression
    [[maybe_unused]]
-   constexpr PrecisionType get_dynamic_viscosity_as(const DimType& obj)
+   constexpr typename DimType::rep get_dynamic_viscosity_as(const DimType& obj)
    {
       return get_dimension_as<
          unit_exponent<massUnit, 1>,
@@ -95,10 +95,10 @@ namespace dimension
    /// @tparam Named The named unit to extract in terms of
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<IsNameddynamic_viscosityUnit Named, is_dynamic_viscosity DimType>
    // TODO: Unit test this and remove suppression
-   constexpr PrecisionType get_dynamic_viscosity_as(const DimType& obj)
+   constexpr typename DimType::rep get_dynamic_viscosity_as(const DimType& obj)
    {
       return call_unpack<typename Named::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
@@ -179,7 +179,7 @@ namespace dimension
 
    /// @brief Concept to verify a dimension can be treated as a electric_potential type
    template<typename T>
-   concept is_electric_potential = std::is_convertible_v<T, base_dimension<
+   concept is_electric_potential = std::is_convertible_v<T, base_dimension<typename T::rep,
       unit_exponent<primary_mass, 1>, 
       unit_exponent<primary_length, 2>, 
       unit_exponent<primary_timespan, -2>, 
@@ -193,7 +193,7 @@ namespace dimension
    /// @tparam chargeUnit The charge unit used for all charge components of electric_potential
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<
       is_mass_unit massUnit,
       is_length_unit lengthUnit,
@@ -202,7 +202,7 @@ namespace dimension
       is_electric_potential DimType>
    // TODO: Unit test this and remove suppression
    [[maybe_unused]]
-   constexpr PrecisionType get_electric_potential_as(const DimType& obj)
+   constexpr typename DimType::rep get_electric_potential_as(const DimType& obj)
    {
       return get_dimension_as<
          unit_exponent<massUnit, 1>,
@@ -216,10 +216,10 @@ namespace dimension
    /// @tparam Named The named unit to extract in terms of
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<IsNamedelectric_potentialUnit Named, is_electric_potential DimType>
    // TODO: Unit test this and remove suppression
-   constexpr PrecisionType get_electric_potential_as(const DimType& obj)
+   constexpr typename DimType::rep get_electric_potential_as(const DimType& obj)
    {
       return call_unpack<typename Named::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
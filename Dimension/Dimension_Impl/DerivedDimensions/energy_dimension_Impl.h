@@ -62,7 +62,7 @@ namespace dimension
 
    /// @brief Concept to verify a dimension can be treated as a energy type
    template<typename T>
-   concept is_energy = std::is_convertible_v<T, base_dimension<
+   concept is_energy = std::is_convertible_v<T, base_dimension<typename T::rep,
       unit_exponent<primary_mass, 1>, 
       unit_exponent<primary_length, 2>, 
       unit_exponent<primary_timespan, -2>
@@ -74,7 +74,7 @@ namespace dimension
    /// @tparam timespanUnit The timespan unit used for all timespan components of energy
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<
       is_mass_unit massUnit,
       is_length_unit lengthUnit,
@@ -82,7 +82,7 @@ namespace dimension
       is_energy DimType>
    // TODO: Unit test this and remove suppression
    [[maybe_unused]]
-   constexpr PrecisionType get_energy_as(const DimType& obj)
+   constexpr typename DimType::rep get_energy_as(const DimType& obj)
    {
       return get_dimension_as<
          unit_exponent<massUnit, 1>,
@@ -95,10 +95,10 @@ namespace dimension
    /// @tparam Named The named unit to extract in terms of
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<IsNamedenergyUnit Named, is_energy DimType>
    // TODO: Unit test this and remove suppression
-   constexpr PrecisionType get_energy_as(const DimType& obj)
+   constexpr typename DimType::rep get_energy_as(const DimType& obj)
    {
       return call_unpack<typename Named::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
@@ -29,7 +29,7 @@ namespace dimension
 
    /// @brief Concept to verify a dimension can be treated as a frequency type
    template<typename T>
-   concept is_frequency = std::is_convertible_v<T, base_dimension<
+   concept is_frequency = std::is_convertible_v<T, base_dimension<typename T::rep,
       unit_exponent<primary_timespan, -1>
    >>;
 
@@ -37,13 +37,13 @@ namespace dimension
    /// @tparam timespanUnit The timespan unit used for all timespan components of frequency
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<
       is_timespan_unit timespanUnit,
       is_frequency DimType>
    // TODO: Unit test this and remove suppression
    [[maybe_unused]]
-   constexpr PrecisionType get_frequency_as(const DimType& obj)
+   constexpr typename DimType::rep get_frequency_as(const DimType& obj)
    {
       return get_dimension_as<
          unit_exponent<timespanUnit, -1>
@@ -54,10 +54,10 @@ namespace dimension
    /// @tparam Named The named unit to extract in terms of
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<IsNamedfrequencyUnit Named, is_frequency DimType>
    // TODO: Unit test this and remove suppression
-   constexpr PrecisionType get_frequency_as(const DimType& obj)
+   constexpr typename DimType::rep get_frequency_as(const DimType& obj)
    {
       return call_unpack<typename Named::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
@@ -37,7 +37,7 @@ namespace dimension
 
    /// @brief Concept to verify a dimension can be treated as a moment_of_inertia type
    template<typename T>
-   concept is_moment_of_inertia = std::is_convertible_v<T, base_dimension<
+   concept is_moment_of_inertia = std::is_convertible_v<T, base_dimension<typename T::rep,
       unit_exponent<primary_mass, 1>, 
       unit_exponent<primary_length, 2>
    >>;
@@ -47,14 +47,14 @@ namespace dimension
    /// @tparam lengthUnit The length unit used for all length components of moment_of_inertia
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<
       is_mass_unit massUnit,
       is_length_unit lengthUnit,
       is_moment_of_inertia DimType>
    // TODO: Unit test this and remove suppression
    [[maybe_unused]]
-   constexpr PrecisionType get_moment_of_inertia_as(const DimType& obj)
+   constexpr typename DimType::rep get_moment_of_inertia_as(const DimType& obj)
    {
       return get_dimension_as<
          unit_exponent<massUnit, 1>,
@@ -66,10 +66,10 @@ namespace dimension
    /// @tparam Named The named unit to extract in terms of
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<IsNamedmoment_of_inertiaUnit Named, is_moment_of_inertia DimType>
    // TODO: Unit test this and remove suppression
-   constexpr PrecisionType get_moment_of_inertia_as(const DimType& obj)
+   constexpr typename DimType::rep get_moment_of_inertia_as(const DimType& obj)
    {
       return call_unpack<typename Named::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
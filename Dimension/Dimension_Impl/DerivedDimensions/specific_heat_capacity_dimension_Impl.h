@@ -62,7 +62,7 @@ namespace dimension
 
    /// @brief Concept to verify a dimension can be treated as a specific_heat_capacity type
    template<typename T>
-   concept is_specific_heat_capacity = std::is_convertible_v<T, base_dimension<
+   concept is_specific_heat_capacity = std::is_convertible_v<T, base_dimension<typename T::rep,
       unit_exponent<primary_length, 2>, 
       unit_exponent<primary_timespan, -2>, 
       unit_exponent<primary_temperature, -1>
@@ -74,7 +74,7 @@ namespace dimension
    /// @tparam temperatureUnit The temperature unit used for all temperature components of specific_heat_capacity
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<
       is_length_unit lengthUnit,
       is_timespan_unit timespanUnit,
@@ -82,7 +82,7 @@ namespace dimension
       is_specific_heat_capacity DimType>
    // TODO: Unit test this and remove suppression
    [[maybe_unused]]
-   constexpr PrecisionType get_specific_heat_capacity_as(const DimType& obj)
+   constexpr typename DimType::rep get_specific_heat_capacity_as(const DimType& obj)
    {
       return get_dimension_as<
          unit_exponent<lengthUnit, 2>,
@@ -95,10 +95,10 @@ namespace dimension
    /// @tparam Named The named unit to extract in terms of
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<IsNamedspecific_heat_capacityUnit Named, is_specific_heat_capacity DimType>
    // TODO: Unit test this and remove suppression
-   constexpr PrecisionType get_specific_heat_capacity_as(const DimType& obj)
+   constexpr typename DimType::rep get_specific_heat_capacity_as(const DimType& obj)
    {
       return call_unpack<typename Named::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
@@ -29,7 +29,7 @@ namespace dimension
 
    /// @brief Concept to verify a dimension can be treated as a volume type
    template<typename T>
-   concept is_volume = std::is_convertible_v<T, base_dimension<
+   concept is_volume = std::is_convertible_v<T, base_dimension<typename T::rep,
       unit_exponent<primary_length, 3>
    >>;
 
@@ -37,13 +37,13 @@ namespace dimension
    /// @tparam lengthUnit The length unit used for all length components of volume
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<
       is_length_unit lengthUnit,
       is_volume DimType>
    // TODO: Unit test this and remove suppression
    [[maybe_unused]]
-   constexpr PrecisionType get_volume_as(const DimType& obj)
+   constexpr typename DimType::rep get_volume_as(const DimType& obj)
    {
       return get_dimension_as<
          unit_exponent<lengthUnit, 3>
@@ -54,10 +54,10 @@ namespace dimension
    /// @tparam Named The named unit to extract in terms of
    /// @tparam DimType The dimension object type, deduced
    /// @param obj The dimension to extract a raw value from
-   /// @return The raw value in terms of template units as a PrecisionType
+   /// @return The raw value in terms of template units, in the Rep of the dimension
    template<IsNamedvolumeUnit Named, is_volume DimType>
    // TODO: Unit test this and remove suppression
-   constexpr PrecisionType get_volume_as(const DimType& obj)
+   constexpr typename DimType::rep get_volume_as(const DimType& obj)
    {
       return call_unpack<typename Named::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
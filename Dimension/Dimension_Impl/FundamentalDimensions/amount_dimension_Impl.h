@@ -50,7 +50,7 @@ namespace dimension
    /// @param obj The amount object.
    /// @return The value in the specified unit.
    template<is_amount_unit T>
-   constexpr PrecisionType get_amount_as(/*amount_type*/ auto obj)
+   constexpr auto get_amount_as(/*amount_type*/ auto obj)
    {
       return get_dimension_as<unit_exponent<T>>(obj);
    }
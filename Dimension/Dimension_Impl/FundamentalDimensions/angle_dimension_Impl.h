@@ -50,7 +50,7 @@ namespace dimension
    /// @param obj The angle object.
    /// @return The value in the specified unit.
    template<is_angle_unit T>
-   constexpr PrecisionType get_angle_as(/*angle_type*/ auto obj)
+   constexpr auto get_angle_as(/*angle_type*/ auto obj)
    {
       return get_dimension_as<unit_exponent<T>>(obj);
    }
@@ -50,7 +50,7 @@ namespace dimension
    /// @param obj The charge object.
    /// @return The value in the specified unit.
    template<is_charge_unit T>
-   constexpr PrecisionType get_charge_as(/*charge_type*/ auto obj)
+   constexpr auto get_charge_as(/*charge_type*/ auto obj)
    {
       return get_dimension_as<unit_exponent<T>>(obj);
    }
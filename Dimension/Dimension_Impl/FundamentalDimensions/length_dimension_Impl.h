@@ -50,7 +50,7 @@ namespace dimension
    /// @param obj The length object.
    /// @return The value in the specified unit.
    template<is_length_unit T>
-   constexpr PrecisionType get_length_as(/*length_type*/ auto obj)
+   constexpr auto get_length_as(/*length_type*/ auto obj)
    {
       return get_dimension_as<unit_exponent<T>>(obj);
    }
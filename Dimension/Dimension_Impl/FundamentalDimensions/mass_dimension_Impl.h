@@ -50,7 +50,7 @@ namespace dimension
    /// @param obj The mass object.
    /// @return The value in the specified unit.
    template<is_mass_unit T>
-   constexpr PrecisionType get_mass_as(/*mass_type*/ auto obj)
+   constexpr auto get_mass_as(/*mass_type*/ auto obj)
    {
       return get_dimension_as<unit_exponent<T>>(obj);
    }
@@ -50,7 +50,7 @@ namespace dimension
    /// @param obj The temperature object.
    /// @return The value in the specified unit.
    template<is_temperature_unit T>
-   constexpr PrecisionType get_temperature_as(/*temperature_type*/ auto obj)
+   constexpr auto get_temperature_as(/*temperature_type*/ auto obj)
    {
       return get_dimension_as<unit_exponent<T>>(obj);
    }
@@ -50,7 +50,7 @@ namespace dimension
    /// @param obj The timespan object.
    /// @return The value in the specified unit.
    template<is_timespan_unit T>
-   constexpr PrecisionType get_timespan_as(/*timespan_type*/ auto obj)
+   constexpr auto get_timespan_as(/*timespan_type*/ auto obj)
    {
       return get_dimension_as<unit_exponent<T>>(obj);
    }
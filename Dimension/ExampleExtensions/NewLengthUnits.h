@@ -1,7 +1,7 @@
 #ifndef LENGTH_EXTENSION_H
 #define LENGTH_EXTENSION_H
 
-#include "length_dimension.h"
+#include "dimensions/fundamental/length_dimension.h"
 
 namespace dimension
 {
@@ -14,8 +14,8 @@ namespace dimension
    class Fail : public lengthUnit<Fail, "Fail", "zzz"> {};
 
 
-   template<> struct Conversion<Feet, Fail> { static constexpr PrecisionType slope = 3.14; };
-   template<> struct Conversion<Fail, Feet> { static constexpr PrecisionType slope = (1.0 / 3.14); };
+   template<> struct Conversion<feet, Fail> { static constexpr PrecisionType slope = 3.14; };
+   template<> struct Conversion<Fail, feet> { static constexpr PrecisionType slope = (1.0 / 3.14); };
 
    template<> struct Conversion<meters, Foo> { static constexpr PrecisionType slope = 3.14; };
    template<> struct Conversion<Foo, meters> { static constexpr PrecisionType slope = (1.0 / 3.14); };
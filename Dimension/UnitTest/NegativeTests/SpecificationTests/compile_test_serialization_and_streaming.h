@@ -1,9 +1,55 @@
 #ifndef DIMENSIONAL_COMPILE_TEST_serialization_and_streaming
 #define DIMENSIONAL_COMPILE_TEST_serialization_and_streaming
 
+#include <version> // For __cpp_lib_format
+
 #include "length_dimension.h"
 #include "timespan_dimension.h"
+#include "speed_dimension.h"
+#include "dimensional_format.h"
 
 using namespace dimension;
 
+#if defined(__cpp_lib_format)
+
+struct serialization_and_streaming_format_formatter_accepts_matching_units {
+   static constexpr const char* id = "serialization_and_streaming:format:formatter_accepts_matching_units";
+   static constexpr bool expect_error = false;
+   static constexpr const char* description = "A dimension formats with std::format, and a format spec naming units of the same dimensions is checked at compile time.";
+
+   template<typename = void>
+      static void run() {
+         speed<meters, seconds> v{12.5};
+         std::string a = std::format("{}", v);
+         std::string b = std::format("{:.1f;km/h}", v);
+         std::string c = std::format("{:;mm}", length<std::int32_t, meters>{3});
+   }
+};
+
+struct serialization_and_streaming_format_formatter_rejects_other_dimensions {
+   static constexpr const char* id = "serialization_and_streaming:format:formatter_rejects_other_dimensions";
+   static constexpr bool expect_error = true;
+   static constexpr const char* description = "A format spec naming units of other dimensions than the value fails to compile.";
+
+   template<typename = void>
+      static void run() {
+         speed<meters, seconds> v{12.5};
+         std::string a = std::format("{:;km}", v);
+   }
+};
+
+struct serialization_and_streaming_format_formatter_rejects_unknown_units {
+   static constexpr const char* id = "serialization_and_streaming:format:formatter_rejects_unknown_units";
+   static constexpr bool expect_error = true;
+   static constexpr const char* description = "A format spec naming units without a symbol fails to compile.";
+
+   template<typename = void>
+      static void run() {
+         length<meters> v{1.0};
+         std::string a = std::format("{:;furlongs}", v);
+   }
+};
+
+#endif // __cpp_lib_format
+
 #endif // DIMENSIONAL_COMPILE_TEST_serialization_and_streaming
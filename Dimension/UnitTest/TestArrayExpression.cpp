@@ -0,0 +1,81 @@
+#include "DimensionTest.h"
+
+#include <vector>
+
+using namespace dimension;
+
+TEST(ArrayExpression, HeatTransferOverArrays) {
+
+   dimension_array<mass<kilo_grams>> masses{mass<kilo_grams>(1.0), mass<kilo_grams>(2.0), mass<kilo_grams>(0.5)};
+   dimension_array<temperature<kelvin>> deltaTemps{temperature<kelvin>(10.0), temperature<kelvin>(-73.15), temperature<kelvin>(100.0)};
+
+   // Nothing is computed until the expression is assigned to a typed destination
+   auto expr = masses * constants::specific_heat_water * deltaTemps;
+   static_assert(is_array_expression<decltype(expr)>);
+   static_assert(matching_dimensions<typename decltype(expr)::dimension_type, energy<joules>>);
+
+   dimension_array<energy<joules>> heat = expr;
+
+   ASSERT_EQ(heat.size(), masses.size());
+   for (std::size_t i = 0; i < heat.size(); ++i)
+   {
+      energy<joules> expected = masses[i] * constants::specific_heat_water * deltaTemps[i];
+      ASSERT_NEAR(heat.data()[i], get_energy_as<joules>(expected), 1e-6);
+   }
+   ASSERT_NEAR(heat.data()[1], -612119.2, 1e-6);
+
+   // The same expression evaluates directly into other units
+   dimension_array<energy<calories>> heatCalories = masses * constants::specific_heat_water * deltaTemps;
+   ASSERT_NEAR(get_energy_as<joules>(heatCalories[0]), 41840.0, 1e-6);
+}
+
+TEST(ArrayExpression, MixedUnitSumAndDifference) {
+
+   dimension_array<length<meters>> metersArr{length<meters>(1.0), length<meters>(2.0)};
+   dimension_array<length<feet>> feetArr{length<feet>(1.0), length<feet>(10.0)};
+
+   // Sums are expressed in the units of the left operand, as with base_dimension
+   dimension_array<length<meters>> total = metersArr + feetArr;
+   ASSERT_NEAR(total.data()[0], 1.3048, 1e-12);
+   ASSERT_NEAR(total.data()[1], 5.048, 1e-12);
+
+   dimension_array<length<feet>> difference = feetArr - metersArr + length<inches>(12.0);
+   ASSERT_NEAR(difference.data()[0], 1.0 - 1.0 / 0.3048 + 1.0, 1e-12);
+   ASSERT_NEAR(difference.data()[1], 10.0 - 2.0 / 0.3048 + 1.0, 1e-12);
+}
+
+TEST(ArrayExpression, ScalarsAndDivision) {
+
+   dimension_array<length<meters>> distances{length<meters>(100.0), length<meters>(50.0)};
+   dimension_array<timespan<seconds>> times{timespan<seconds>(10.0), timespan<seconds>(20.0)};
+
+   dimension_array<speed<meters, seconds>> halfSpeeds = 0.5 * distances / times;
+   ASSERT_NEAR(halfSpeeds.data()[0], 5.0, 1e-12);
+   ASSERT_NEAR(halfSpeeds.data()[1], 1.25, 1e-12);
+
+   dimension_array<frequency<hertz>> rates = 2.0 / times;
+   ASSERT_NEAR(rates.data()[0], 0.2, 1e-12);
+
+   // Assigning an expression which reads the destination is safe
+   halfSpeeds = halfSpeeds * 2.0;
+   ASSERT_NEAR(halfSpeeds.data()[1], 2.5, 1e-12);
+}
+
+TEST(ArrayExpression, SpanOperandsAndSizeChecks) {
+
+   std::vector<double> rawFeet{1.0, 2.0, 3.0};
+   std::vector<double> rawSeconds{1.0, 2.0};
+
+   auto feetExpr = as_expression<length<feet>>(rawFeet);
+   dimension_array<length<meters>> asMeters = feetExpr;
+   ASSERT_NEAR(asMeters.data()[2], 0.9144, 1e-12);
+
+   std::vector<double> out(3);
+   evaluate<length<inches>>(feetExpr * 1.0, std::span<double>(out));
+   ASSERT_NEAR(out[1], 24.0, 1e-12);
+
+   ASSERT_THROW(static_cast<void>(feetExpr / as_expression<timespan<seconds>>(rawSeconds)), std::invalid_argument);
+
+   std::vector<double> tooSmall(2);
+   ASSERT_THROW(evaluate<length<inches>>(feetExpr, std::span<double>(tooSmall)), std::invalid_argument);
+}
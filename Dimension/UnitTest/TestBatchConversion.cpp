@@ -0,0 +1,95 @@
+#include "DimensionTest.h"
+
+#include "NewLengthUnits.h"
+
+#include <vector>
+
+using namespace dimension;
+
+TEST(BatchConversion, CompileTimeSlopeAndOffset) {
+
+   // Direct conversion
+   static_assert(affine_conversion<meters, feet>::offset == 0.0);
+   static_assert(affine_conversion<meters, feet>::slope == Conversion<meters, feet>::slope);
+
+   // Deltas ignore offsets, quantities apply them
+   static_assert(affine_conversion<meters, Baz>::offset == 0.0);
+   static_assert(affine_conversion<meters, Baz, quantity>::offset == 32.0);
+
+   // Two hops through the primary unit are folded into one transform
+   constexpr double slope = affine_conversion<feet, Baz, quantity>::slope;
+   constexpr double offset = affine_conversion<feet, Baz, quantity>::offset;
+   ASSERT_NEAR(slope, 0.3048 * 1.8, 1e-12);
+   ASSERT_NEAR(offset, 32.0, 1e-12);
+}
+
+TEST(BatchConversion, DeltaSpan) {
+
+   // Odd size to exercise the scalar tail after the vector loop
+   std::vector<double> in(1027);
+   for (std::size_t i = 0; i < in.size(); ++i)
+   {
+      in[i] = static_cast<double>(i);
+   }
+   std::vector<double> out(in.size());
+
+   convert_span<feet, meters>(in, out);
+
+   for (std::size_t i = 0; i < in.size(); ++i)
+   {
+      ASSERT_NEAR(out[i], (Convert<unit_exponent<feet>, unit_exponent<meters>>(in[i])), 1e-9);
+   }
+}
+
+TEST(BatchConversion, OffsetSpan) {
+
+   std::vector<double> in{0.0, 1.0, 10.0, 20.0, 100.0, -40.0, 3.5, 7.25, 9.0};
+   std::vector<double> out(in.size());
+
+   convert_span<meters, Baz, quantity>(in, out);
+
+   for (std::size_t i = 0; i < in.size(); ++i)
+   {
+      ASSERT_NEAR(out[i], in[i] * 1.8 + 32.0, 1e-9);
+   }
+
+   // Deltas ignore the offset
+   convert_span<meters, Baz>(in, out);
+   ASSERT_NEAR(out[3], 36.0, 1e-9);
+}
+
+TEST(BatchConversion, InPlaceAndFloat) {
+
+   std::vector<float> values(33, 1.0f);
+
+   convert_span<kilo_meters, meters>(std::span<float>(values));
+
+   for (float value : values)
+   {
+      ASSERT_FLOAT_EQ(value, 1000.0f);
+   }
+}
+
+TEST(BatchConversion, CompoundUnits) {
+
+   using from = std::tuple<unit_exponent<meters>, unit_exponent<seconds, -1>>;
+   using to = std::tuple<unit_exponent<feet>, unit_exponent<minutes, -1>>;
+
+   std::vector<double> in(19, 10.0);
+   std::vector<double> out(in.size());
+
+   convert_span<from, to>(in, out);
+
+   for (double value : out)
+   {
+      ASSERT_NEAR(value, 1968.504, TOLERANCE);
+   }
+}
+
+TEST(BatchConversion, SizeMismatchThrows) {
+
+   std::vector<double> in(4);
+   std::vector<double> out(3);
+
+   ASSERT_THROW((convert_span<feet, meters>(in, out)), std::invalid_argument);
+}
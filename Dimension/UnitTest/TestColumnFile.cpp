@@ -0,0 +1,127 @@
+#include "DimensionTest.h"
+
+#include "Dimension_Core/ColumnFile.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace dimension;
+
+namespace
+{
+   /// @brief Column file in the temporary directory, removed at the end of the test
+   struct temporary_column
+   {
+      explicit temporary_column(const char* name) : path(std::filesystem::temp_directory_path() / name) {}
+      ~temporary_column() { std::filesystem::remove(path); }
+
+      std::filesystem::path path;
+   };
+}
+
+TEST(ColumnFile, ExactUnitsAreMappedInPlace) {
+
+   const temporary_column file("dimension_column_exact.dcol");
+
+   dimension_array<length<feet>> heights{length<feet>(1.0), length<feet>(2.5), length<feet>(-4.0)};
+   write_column(file.path, heights);
+
+   const mapped_column<length<feet>> column(file.path);
+   ASSERT_FALSE(column.converted_on_open());
+   ASSERT_EQ(column.size(), 3u);
+   ASSERT_EQ(column.written_units(), column_detail::unit_string<length<feet>>().substr(0, column.header().unit_length));
+   ASSERT_EQ(column.header().type_hash, (TypeTagHelper<length<feet>, FNV_1a_64Bit>::value().get()));
+   ASSERT_EQ(column.header().data_offset % column_alignment, 0u);
+   ASSERT_EQ(reinterpret_cast<std::uintptr_t>(column.values().data()) % column_alignment, 0u);
+
+   ASSERT_TRUE(std::ranges::equal(column.values(), heights.values()));
+   ASSERT_NEAR(get_length_as<feet>(column[1]), 2.5, TOLERANCE);
+   ASSERT_EQ(std::ranges::distance(column), 3);
+}
+
+TEST(ColumnFile, CompatibleUnitsAreConvertedOnce) {
+
+   const temporary_column file("dimension_column_convert.dcol");
+
+   std::vector<double> feetValues(100);
+   for (std::size_t i = 0; i < feetValues.size(); ++i)
+   {
+      feetValues[i] = static_cast<double>(i);
+   }
+   write_column<length<feet>>(file.path, feetValues);
+
+   const mapped_column<length<meters>> column(file.path);
+   ASSERT_TRUE(column.converted_on_open());
+   ASSERT_EQ(column.size(), 100u);
+   ASSERT_NEAR(get_length_as<meters>(column[10]), 3.048, 1e-12);
+   ASSERT_NEAR(column.values()[99], 99 * 0.3048, 1e-12);
+
+   // Compound units convert with the same single factor
+   const temporary_column speeds("dimension_column_speed.dcol");
+   write_column<speed<meters, seconds>>(speeds.path, std::vector<double>{10.0, 20.0});
+   const mapped_column<speed<miles, hours>> mph(speeds.path);
+   ASSERT_NEAR((get_speed_as<miles, hours>(mph[1])), 20.0 * 3600.0 / 1609.344, 1e-9);
+
+   // Integral values round to the nearest value, and must still fit the Rep once converted
+   const temporary_column counts("dimension_column_integral.dcol");
+   write_column<length<std::int16_t, meters>>(counts.path, std::vector<std::int16_t>{3, -2, 40});
+   const mapped_column<length<std::int16_t, deci_meters>> decimeters(counts.path);
+   ASSERT_TRUE(decimeters.converted_on_open());
+   ASSERT_EQ(decimeters.values()[0], 30);
+   ASSERT_EQ(decimeters.values()[1], -20);
+   ASSERT_EQ(decimeters.values()[2], 400);
+   ASSERT_THROW((mapped_column<length<std::int16_t, milli_meters>>{counts.path}), std::out_of_range);
+}
+
+TEST(ColumnFile, Validation) {
+
+   const temporary_column file("dimension_column_invalid.dcol");
+   write_column<length<meters>>(file.path, std::vector<double>{1.0, 2.0});
+
+   // Other dimensions and other Reps are rejected
+   ASSERT_THROW(mapped_column<timespan<seconds>>{file.path}, std::invalid_argument);
+   ASSERT_THROW((mapped_column<length<float, meters>>{file.path}), std::invalid_argument);
+
+   // A truncated file
+   std::filesystem::resize_file(file.path, std::filesystem::file_size(file.path) - 1);
+   ASSERT_THROW(mapped_column<length<meters>>{file.path}, std::invalid_argument);
+
+   // A file with a corrupted unit string
+   write_column<length<meters>>(file.path, std::vector<double>{1.0});
+   {
+      std::fstream stream(file.path, std::ios::binary | std::ios::in | std::ios::out);
+      stream.seekp(sizeof(column_header));
+      stream.put('x');
+   }
+   ASSERT_THROW(mapped_column<length<meters>>{file.path}, std::invalid_argument);
+
+   // A header claiming a unit string and data past the end of the file
+   {
+      column_header header;
+      header.rep_kind = 'f';
+      header.rep_size = sizeof(double);
+      header.unit_length = 4000;
+      header.data_offset = 4096;
+      std::vector<std::byte> bytes(sizeof(column_header));
+      std::memcpy(bytes.data(), &header, sizeof(column_header));
+      ASSERT_THROW(static_cast<void>(read_column_header(bytes)), std::invalid_argument);
+   }
+
+   // Not a column file at all
+   {
+      std::ofstream stream(file.path, std::ios::binary | std::ios::trunc);
+      stream << "not a column file";
+   }
+   ASSERT_THROW(mapped_column<length<meters>>{file.path}, std::invalid_argument);
+
+   ASSERT_THROW(mapped_column<length<meters>>{file.path.string() + ".missing"}, std::system_error);
+
+   // An empty column
+   write_column<length<meters>>(file.path, std::span<const double>());
+   const mapped_column<length<meters>> empty(file.path);
+   ASSERT_TRUE(empty.empty());
+   ASSERT_EQ(empty.begin(), empty.end());
+}
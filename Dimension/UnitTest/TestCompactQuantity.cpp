@@ -0,0 +1,120 @@
+#include "DimensionTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace dimension;
+
+namespace
+{
+   using kelvin_codec = codec::scaled<std::int16_t, std::centi>;
+}
+
+TEST(CompactQuantity, Codecs) {
+
+   // float16 is exact for small integers and rounds to 11 significant bits
+   ASSERT_EQ(codec::float16::encode(1.0), 0x3c00);
+   ASSERT_EQ(codec::float16::encode(-2.0f), 0xc000);
+   ASSERT_EQ(codec::float16::decode<double>(0x3555), 0.333251953125);
+   ASSERT_EQ(codec::float16::decode<double>(codec::float16::encode(2049.0)), 2048.0);
+   ASSERT_EQ(codec::float16::decode<double>(codec::float16::encode(2051.0)), 2052.0);
+
+   // Range edges, subnormals, infinity and NaN
+   ASSERT_EQ(codec::float16::decode<double>(codec::float16::encode(65504.0)), 65504.0);
+   ASSERT_EQ(codec::float16::encode(1e6), 0x7c00);
+   ASSERT_EQ(codec::float16::encode(-1e6), 0xfc00);
+   ASSERT_EQ(codec::float16::decode<double>(0x0001), std::ldexp(1.0, -24));
+   ASSERT_EQ(codec::float16::encode(std::ldexp(3.0, -24)), 0x0003);
+   ASSERT_TRUE(std::isnan(codec::float16::decode<double>(codec::float16::encode(std::numeric_limits<double>::quiet_NaN()))));
+
+   // bfloat16 keeps the range of float with 8 significant bits
+   ASSERT_EQ(codec::bfloat16::encode(1.0), 0x3f80);
+   ASSERT_NEAR(codec::bfloat16::decode<double>(codec::bfloat16::encode(1e30)) / 1e30, 1.0, 1.0 / 256.0);
+   ASSERT_EQ(codec::bfloat16::decode<double>(codec::bfloat16::encode(257.0)), 256.0);
+   ASSERT_EQ(codec::bfloat16::decode<double>(codec::bfloat16::encode(259.0)), 260.0);
+   ASSERT_TRUE(std::isnan(codec::bfloat16::decode<float>(codec::bfloat16::encode(std::numeric_limits<float>::quiet_NaN()))));
+
+   // Scaled integers round to the nearest step and saturate
+   ASSERT_EQ(kelvin_codec::encode(2.994), 299);
+   ASSERT_EQ(kelvin_codec::encode(-2.995), -300);
+   ASSERT_NEAR(kelvin_codec::decode<double>(29315), 293.15, 1e-12);
+   ASSERT_EQ(kelvin_codec::encode(1000.0), std::numeric_limits<std::int16_t>::max());
+   ASSERT_EQ(kelvin_codec::encode(-1000.0), std::numeric_limits<std::int16_t>::min());
+   ASSERT_EQ(kelvin_codec::encode(std::numeric_limits<double>::quiet_NaN()), 0);
+
+   // An offset centers the range, here 0.01 K steps around 273 K
+   using offset_kelvin = codec::scaled<std::int16_t, std::centi, std::ratio<273>>;
+   ASSERT_EQ(offset_kelvin::encode(293.15), 2015);
+   ASSERT_NEAR(offset_kelvin::decode<double>(2015), 293.15, 1e-12);
+}
+
+TEST(CompactQuantity, TypedValues) {
+
+   compact_quantity<temperature<kelvin>, kelvin_codec> t = temperature<kelvin>(293.15);
+   static_assert(sizeof(t) == sizeof(std::int16_t));
+   ASSERT_EQ(t.encoded(), 29315);
+   ASSERT_NEAR(get_temperature_as<kelvin>(t.value()), 293.15, 1e-9);
+
+   // Other units are converted to the units of the dimension before encoding
+   t = temperature<deci_kelvin>(2931.5);
+   ASSERT_EQ(t.encoded(), 29315);
+
+   // Arithmetic is done in the compute Rep and rounded once when written back
+   t += temperature<kelvin>(0.004);
+   ASSERT_EQ(t.encoded(), 29315);
+   t -= temperature<kelvin>(1.0);
+   ASSERT_EQ(t.encoded(), 29215);
+   t *= 0.5;
+   ASSERT_NEAR(get_temperature_as<kelvin>(t.value()), 146.075, 0.006);
+
+   compact_quantity<length<meters>, codec::float16> d = length<feet>(10.0);
+   ASSERT_NEAR(get_length_as<meters>(d.value()), 3.048, 1e-3);
+   d /= 2.0;
+
+   // Reading widens implicitly
+   const length<meters> half = d;
+   const auto total = half + length<meters>(1.0);
+   ASSERT_NEAR(get_length_as<meters>(total), 2.524, 1e-3);
+   ASSERT_TRUE(d == decltype(d)::from_bits(d.encoded()));
+}
+
+TEST(CompactQuantity, Arrays) {
+
+   dimension_array<length<meters>> values(3000);
+   for (std::size_t i = 0; i < values.size(); ++i)
+   {
+      values.data()[i] = static_cast<double>(i % 256) * 0.25;
+   }
+
+   // Every value here and below has at most 11 significant bits, so float16 holds them exactly
+   compact_array<length<meters>, codec::float16> compact(values);
+   ASSERT_EQ(compact.size(), 3000u);
+   ASSERT_EQ(get_length_as<meters>(compact[5]), 1.25);
+   ASSERT_TRUE(std::ranges::equal(compact.decoded().values(), values.values()));
+
+   // Whole-array operations run block-wise across the block boundaries
+   compact *= 2.0;
+   compact += length<meters>(1.0);
+   ASSERT_EQ(get_length_as<meters>(compact[1023]), 128.5);
+   ASSERT_EQ(get_length_as<meters>(compact[1024]), 1.0);
+   compact -= length<meters>(1.0);
+   compact /= 2.0;
+   ASSERT_TRUE(std::ranges::equal(compact.decoded().values(), values.values()));
+
+   // Conversion on the way in, partial decode and encode
+   const compact_array<length<meters>, codec::scaled<std::int32_t, std::centi>> centimeters(dimension_array<length<feet>>{length<feet>(1.0), length<feet>(2.0)});
+   ASSERT_EQ(centimeters.data()[1], 61);
+
+   compact.set(2, length<feet>(1.0));
+   std::array<double, 2> window{};
+   compact.decode(1, window);
+   ASSERT_EQ(window[0], 0.25);
+   ASSERT_NEAR(window[1], 0.3048, 1e-3);
+
+   const std::array<double, 2> update{7.0, 8.0};
+   compact.encode(2998, update);
+   ASSERT_EQ(get_length_as<meters>(compact[2999]), 8.0);
+   ASSERT_THROW(compact.encode(2999, update), std::out_of_range);
+   ASSERT_THROW(compact.decode(3001, std::span<double>{}), std::out_of_range);
+}
@@ -12,3 +12,37 @@ TEST(CompoundConversions, Testspeed) {
    ASSERT_NEAR((get_speed_as<meters, minutes>(myspeed)), 600.0, TOLERANCE);
    ASSERT_NEAR((get_speed_as<feet, minutes>(myspeed)), 1968.504, TOLERANCE);
 }
+
+TEST(CompoundConversions, ConversionFactorIsCompileTime) {
+
+   using from = std::tuple<unit_exponent<meters>, unit_exponent<seconds, -1>>;
+   using to = std::tuple<unit_exponent<feet>, unit_exponent<minutes, -1>>;
+
+   // Usable as a constant expression, so no simplification is left for run time
+   constexpr double factor = conversion_factor_v<from, to>;
+   static_assert(factor > 196.85 && factor < 196.86);
+
+   constexpr double roundTrip = conversion_factor_v<from, to> * conversion_factor_v<to, from>;
+   static_assert(roundTrip > 1.0 - 1e-12 && roundTrip < 1.0 + 1e-12);
+
+   constexpr speed<feet, minutes> converted = speed<meters, seconds>(10.0);
+   static_assert(converted == speed<meters, seconds>(10.0));
+
+   ASSERT_NEAR(factor, 196.8504, TOLERANCE);
+}
+
+TEST(CompoundConversions, MixedUnitAccessIsOneMultiply) {
+
+   constexpr double factor = conversion_factor_v<std::tuple<unit_exponent<meters>, unit_exponent<seconds, -1>>,
+                                                 std::tuple<unit_exponent<feet>, unit_exponent<minutes, -1>>>;
+
+   // Bitwise equality with a single multiply by the precomputed factor
+   for (const double value : {0.1, 1.0, 3.7, 1234.5678, -42.0})
+   {
+      speed<meters, seconds> obj(value);
+      ASSERT_EQ((get_speed_as<feet, minutes>(obj)), value * factor);
+
+      speed<feet, minutes> constructed = obj;
+      ASSERT_EQ((get_speed_as<feet, minutes>(constructed)), value * factor);
+   }
+}
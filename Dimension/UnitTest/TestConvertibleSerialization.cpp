@@ -0,0 +1,127 @@
+#include "DimensionTest.h"
+
+#include <array>
+#include <vector>
+
+using namespace dimension;
+
+namespace
+{
+   using convertible = ConvertibleBlockSerializationPolicy;
+}
+
+TEST(ConvertibleSerialization, ExactUnits) {
+
+   using sample = pressure<pascals>;
+   const std::vector<sample> samples{sample(101325.0), sample(99000.5), sample(-12.25)};
+
+   // The header keeps values written at an aligned address aligned
+   static_assert(convertible::header_size % alignof(PrecisionType) == 0);
+   alignas(PrecisionType) std::array<std::byte, convertible::block_size<sample>(3)> buffer{};
+   ASSERT_EQ((serialize_block<sample, decltype(buffer)&, convertible>(buffer, samples)), buffer.size());
+
+   ASSERT_EQ(convertible::count<sample>(buffer), 3u);
+   ASSERT_EQ(convertible::conversion_factor<sample>(buffer), 1.0);
+
+   // Matching units are copied as they are
+   std::array<sample, 3> result{};
+   ASSERT_EQ(convertible::deserialize<sample>(buffer, std::span(result)), 3u);
+   for (std::size_t i = 0; i < samples.size(); ++i)
+   {
+      ASSERT_EQ(get_pressure_as<pascals>(result[i]), get_pressure_as<pascals>(samples[i]));
+   }
+
+   // An empty block holds only the header
+   ASSERT_EQ(convertible::serialize<sample>(buffer, std::span<const sample>()), convertible::header_size);
+   ASSERT_EQ(convertible::deserialize<sample>(buffer, std::span<PrecisionType>()), 0u);
+}
+
+TEST(ConvertibleSerialization, CompatibleUnits) {
+
+   // Written by a producer in feet
+   const dimension_array<length<feet>> heights{length<feet>(1.0), length<feet>(2.5), length<feet>(-4.0), length<feet>(10.0), length<feet>(3.0)};
+   std::vector<std::byte> buffer(convertible::block_size<length<feet>>(heights.size()) + 1);
+   convertible::serialize<length<feet>>(buffer, heights.values());
+
+   // Read by a consumer in meters, as raw values and as objects
+   ASSERT_NEAR(convertible::conversion_factor<length<meters>>(buffer), 0.3048, TOLERANCE);
+   std::vector<double> inMeters(heights.size());
+   ASSERT_EQ(convertible::deserialize<length<meters>>(buffer, std::span(inMeters)), heights.size());
+   std::array<length<kilo_meters>, 5> kilometers{};
+   ASSERT_EQ(convertible::deserialize<length<kilo_meters>>(buffer, std::span(kilometers)), heights.size());
+   for (std::size_t i = 0; i < heights.size(); ++i)
+   {
+      ASSERT_NEAR(inMeters[i], get_length_as<meters>(heights[i]), TOLERANCE);
+      ASSERT_NEAR(get_length_as<kilo_meters>(kilometers[i]), get_length_as<kilo_meters>(heights[i]), TOLERANCE);
+   }
+
+   // Values that are not aligned for their Rep are converted as well
+   std::vector<std::byte> shifted(buffer.size());
+   std::copy(buffer.begin(), buffer.end() - 1, shifted.begin() + 1);
+   ASSERT_EQ(convertible::deserialize<length<meters>>(std::span(shifted).subspan(1), std::span(inMeters)), heights.size());
+   ASSERT_NEAR(inMeters[4], 0.9144, TOLERANCE);
+
+   // Derived units are compared through their fundamental dimensions
+   std::array<std::byte, convertible::block_size<force<newtons>>(1)> forceBuffer{};
+   const std::array<force<newtons>, 1> forces{force<newtons>(2.0)};
+   convertible::serialize<force<newtons>>(forceBuffer, std::span(forces));
+   std::array<base_dimension<unit_exponent<kilo_grams>, unit_exponent<meters>, unit_exponent<seconds, -2>>, 1> fundamental{};
+   ASSERT_EQ(convertible::deserialize<decltype(fundamental)::value_type>(forceBuffer, std::span(fundamental)), 1u);
+   ASSERT_NEAR(fundamental[0].get_tuple_scalar<decltype(fundamental)::value_type::units>(), 2.0, TOLERANCE);
+
+   // Integer representations are rounded after conversion
+   const std::array<length<std::int32_t, meters>, 2> whole{length<std::int32_t, meters>(1), length<std::int32_t, meters>(-2)};
+   std::array<std::byte, convertible::block_size<length<std::int32_t, meters>>(2)> wholeBuffer{};
+   convertible::serialize<length<std::int32_t, meters>>(wholeBuffer, std::span(whole));
+   std::array<std::int32_t, 2> millimeters{};
+   convertible::deserialize<length<std::int32_t, milli_meters>>(wholeBuffer, std::span(millimeters));
+   ASSERT_EQ(millimeters[0], 1000);
+   ASSERT_EQ(millimeters[1], -2000);
+
+   // Values which no longer fit the Rep after conversion are rejected
+   const std::array<length<std::int16_t, kilo_meters>, 2> far{length<std::int16_t, kilo_meters>(3), length<std::int16_t, kilo_meters>(40)};
+   std::array<std::byte, convertible::block_size<length<std::int16_t, kilo_meters>>(2)> farBuffer{};
+   convertible::serialize<length<std::int16_t, kilo_meters>>(farBuffer, std::span(far));
+   std::array<std::int16_t, 2> farMeters{};
+   ASSERT_THROW((convertible::deserialize<length<std::int16_t, meters>>(farBuffer, std::span(farMeters))), std::out_of_range);
+   std::array<length<std::int16_t, meters>, 2> farObjects{};
+   ASSERT_THROW((convertible::deserialize<length<std::int16_t, meters>>(farBuffer, std::span(farObjects))), std::out_of_range);
+}
+
+TEST(ConvertibleSerialization, Coefficients) {
+
+   using kilo = base_dimension<double, unit_exponent<meters>, std::ratio<1000>>;
+   const std::array<kilo, 2> objs{kilo(2.0), kilo(-0.5)};
+   std::array<std::byte, convertible::block_size<kilo>(2)> buffer{};
+   convertible::serialize<kilo>(buffer, std::span(objs));
+
+   // The coefficient is applied once, whether read back as the same type or in other units
+   std::array<kilo, 2> same{};
+   ASSERT_EQ(convertible::deserialize<kilo>(buffer, std::span(same)), 2u);
+   ASSERT_NEAR((get_dimension_as<unit_exponent<meters>>(same[0])), 2000.0, TOLERANCE);
+
+   std::array<length<meters>, 2> inMeters{};
+   ASSERT_EQ(convertible::deserialize<length<meters>>(buffer, std::span(inMeters)), 2u);
+   ASSERT_NEAR(get_length_as<meters>(inMeters[0]), 2000.0, TOLERANCE);
+   ASSERT_NEAR(get_length_as<meters>(inMeters[1]), -500.0, TOLERANCE);
+}
+
+TEST(ConvertibleSerialization, Validation) {
+
+   const std::array<length<feet>, 2> lengths{length<feet>(1.0), length<feet>(2.0)};
+   std::array<std::byte, convertible::block_size<length<feet>>(2)> buffer{};
+   convertible::serialize<length<feet>>(buffer, std::span(lengths));
+
+   // Other dimensions, another Rep, short buffers and short destinations are rejected
+   std::array<timespan<seconds>, 2> times{};
+   ASSERT_THROW(convertible::deserialize<timespan<seconds>>(buffer, std::span(times)), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(convertible::count<length<float, meters>>(buffer)), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(convertible::count<length<meters>>(std::span(buffer).first(30))), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(convertible::count<length<meters>>(std::span(buffer).first(8))), std::invalid_argument);
+
+   std::array<length<meters>, 1> small{};
+   ASSERT_THROW(convertible::deserialize<length<meters>>(buffer, std::span(small)), std::invalid_argument);
+
+   std::array<std::byte, 16> tooSmall{};
+   ASSERT_THROW(convertible::serialize<length<feet>>(tooSmall, std::span(lengths)), std::invalid_argument);
+}
@@ -0,0 +1,149 @@
+#include "DimensionTest.h"
+
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <numeric>
+
+using namespace dimension;
+
+TEST(DimensionArray, ConstructAndAccess) {
+
+   dimension_array<length<feet>> arr{length<feet>(1.0), length<feet>(2.0), length<feet>(3.0)};
+
+   ASSERT_EQ(arr.size(), 3u);
+   ASSERT_NEAR(get_length_as<feet>(arr[0]), 1.0, TOLERANCE);
+   ASSERT_NEAR(get_length_as<feet>(arr.at(2)), 3.0, TOLERANCE);
+   ASSERT_THROW(static_cast<void>(arr.at(3)), std::out_of_range);
+
+   // Raw values are stored contiguously in the array's units
+   static_assert(std::is_same_v<decltype(arr.data()), double*>);
+   ASSERT_DOUBLE_EQ(arr.data()[1], 2.0);
+   ASSERT_EQ(arr.values().size(), 3u);
+
+   dimension_array<length<feet>> zeroed(4);
+   for (const auto& value : zeroed.values())
+   {
+      ASSERT_DOUBLE_EQ(value, 0.0);
+   }
+}
+
+TEST(DimensionArray, PushBackConvertsToArrayUnits) {
+
+   dimension_array<length<feet>> arr;
+   arr.push_back(length<meters>(1.0));
+   arr.set(0, length<meters>(2.0));
+   arr.push_back(length<feet>(5.0));
+
+   ASSERT_NEAR(arr.data()[0], 6.56168, TOLERANCE);
+   ASSERT_NEAR(get_length_as<meters>(arr.back()), 1.524, TOLERANCE);
+}
+
+TEST(DimensionArray, BulkConversion) {
+
+   dimension_array<length<feet>> arr;
+   for (int i = 0; i < 100; ++i)
+   {
+      arr.push_back(length<feet>(static_cast<double>(i)));
+   }
+
+   auto asMeters = arr.as<unit_exponent<meters>>();
+   static_assert(std::is_same_v<typename decltype(asMeters)::units, std::tuple<unit_exponent<meters>>>);
+   ASSERT_EQ(asMeters.size(), arr.size());
+   for (std::size_t i = 0; i < arr.size(); ++i)
+   {
+      ASSERT_NEAR(asMeters.data()[i], static_cast<double>(i) * 0.3048, 1e-9);
+   }
+
+   auto asInches = arr.as<length<inches>>();
+   ASSERT_NEAR(get_length_as<inches>(asInches[10]), 120.0, 1e-9);
+
+   // Same units is a plain copy
+   auto copy = arr.as<length<feet>>();
+   ASSERT_DOUBLE_EQ(copy.data()[42], 42.0);
+}
+
+TEST(DimensionArray, BulkConversionCompound) {
+
+   dimension_array<speed<meters, seconds>> arr(3, speed<meters, seconds>(10.0));
+
+   auto converted = arr.as<unit_exponent<feet>, unit_exponent<minutes, -1>>();
+   for (const auto& value : converted)
+   {
+      ASSERT_NEAR((get_speed_as<meters, seconds>(value)), 10.0, TOLERANCE);
+      ASSERT_NEAR((get_speed_as<feet, minutes>(value)), 1968.504, TOLERANCE);
+   }
+}
+
+TEST(DimensionArray, BulkConversionIntegral) {
+
+   dimension_array<length<std::int32_t, milli_meters>> millimeters;
+   millimeters.push_back(length<std::int32_t, milli_meters>(2500));
+   millimeters.push_back(length<std::int32_t, milli_meters>(7000));
+   millimeters.push_back(length<std::int32_t, milli_meters>(-1500));
+
+   // Integral targets truncate toward zero, as dimension_cast does
+   const auto asMeters = millimeters.as<length<std::int32_t, meters>>();
+   ASSERT_EQ(asMeters.data()[0], 2);
+   ASSERT_EQ(asMeters.data()[1], 7);
+   ASSERT_EQ(asMeters.data()[2], -1);
+   ASSERT_EQ(get_length_as<meters>(asMeters[0]), get_length_as<meters>(dimension_cast<length<std::int32_t, meters>>(millimeters[0])));
+
+   dimension_array<length<std::int32_t, inches>> inchesArray;
+   inchesArray.push_back(length<std::int32_t, inches>(12));
+   inchesArray.push_back(length<std::int32_t, inches>(30));
+   const auto asFeet = inchesArray.as<length<std::int32_t, feet>>();
+   ASSERT_EQ(asFeet.data()[0], 1);
+   ASSERT_EQ(asFeet.data()[1], 2);
+
+   // Floating point sources round toward zero as well
+   dimension_array<length<double, milli_meters>> measured;
+   measured.push_back(length<double, milli_meters>(1999.9));
+   ASSERT_EQ((measured.as<length<std::int32_t, meters>>().data()[0]), 1);
+}
+
+TEST(DimensionArray, UninitializedResize) {
+
+   auto arr = dimension_array<pressure<pascals>>::uninitialized(16);
+   ASSERT_EQ(arr.size(), 16u);
+
+   std::iota(arr.data(), arr.data() + arr.size(), 0.0);
+   ASSERT_DOUBLE_EQ(arr.data()[15], 15.0);
+
+   arr.resize_uninitialized(32);
+   ASSERT_EQ(arr.size(), 32u);
+   ASSERT_DOUBLE_EQ(arr.data()[15], 15.0);
+
+   // Regular resize still zero-fills
+   arr.resize(64);
+   ASSERT_DOUBLE_EQ(arr.data()[63], 0.0);
+}
+
+TEST(DimensionArray, PolymorphicAllocator) {
+
+   std::array<std::byte, 4096> buffer{};
+   std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+   pmr::dimension_array<length<feet>> arr(&resource);
+   arr.reserve(64);
+   for (int i = 0; i < 64; ++i)
+   {
+      arr.push_back(length<feet>(1.0));
+   }
+
+   ASSERT_EQ(arr.get_allocator().resource(), &resource);
+
+   // Converted arrays allocate from the same resource
+   auto asMeters = arr.as<unit_exponent<meters>>();
+   ASSERT_EQ(asMeters.get_allocator().resource(), &resource);
+   ASSERT_NEAR(asMeters.data()[63], 0.3048, 1e-9);
+}
+
+TEST(DimensionArray, StandardAlgorithms) {
+
+   dimension_array<length<meters>> arr{length<meters>(3.0), length<meters>(1.0), length<meters>(2.0)};
+
+   auto smallest = *std::min_element(arr.begin(), arr.end());
+   ASSERT_NEAR(get_length_as<meters>(smallest), 1.0, TOLERANCE);
+   ASSERT_EQ(arr.end() - arr.begin(), 3);
+}
@@ -0,0 +1,108 @@
+#include "DimensionTest.h"
+
+using namespace dimension;
+
+namespace
+{
+   using state = std::tuple<length<meters>, speed<meters, seconds>>;
+   using transition = dimension_matrix<state, inverse_dimensions_t<state>>;
+   using covariance = dimension_matrix<state, state>;
+}
+
+TEST(DimensionMatrix, ElementUnits) {
+
+   covariance p;
+   p.set<0, 0>(area<meters>(4.0));
+   p.set<0, 1>(length<feet>(1.0) * speed<meters, seconds>(1.0));
+   p.set<1, 1>(speed<meters, seconds>(3.0) * speed<meters, seconds>(3.0));
+
+   // Each element has the dimension of its row times its column
+   static_assert(matching_dimensions<covariance::element_type<0, 0>, area<meters>>);
+   static_assert(matching_dimensions<transition::element_type<0, 1>, timespan<seconds>>);
+   ASSERT_NEAR(get_area_as<meters>(p.get<0, 0>()), 4.0, TOLERANCE);
+   ASSERT_NEAR(p.raw(0, 1), 0.3048, TOLERANCE);
+   ASSERT_NEAR(p.raw(1, 1), 9.0, TOLERANCE);
+
+   // Conversion and addition between matrices in other units of the same dimensions
+   using feet_state = std::tuple<length<feet>, speed<feet, seconds>>;
+   const dimension_matrix<feet_state, feet_state> inFeet = p;
+   ASSERT_NEAR(get_area_as<feet>(area<feet>(inFeet.get<0, 0>())), 4.0 / (0.3048 * 0.3048), 1e-9);
+
+   const covariance doubled = p + inFeet;
+   ASSERT_NEAR(doubled.raw(0, 0), 8.0, TOLERANCE);
+   ASSERT_NEAR(doubled.raw(0, 1), 2.0 * 0.3048, TOLERANCE);
+   ASSERT_NEAR((doubled - inFeet).raw(0, 1), p.raw(0, 1), TOLERANCE);
+   ASSERT_NEAR((0.5 * doubled).raw(1, 1), 9.0, TOLERANCE);
+
+   const auto identity = transition::identity();
+   ASSERT_NEAR(identity.raw(0, 0), 1.0, TOLERANCE);
+   ASSERT_NEAR(identity.raw(0, 1), 0.0, TOLERANCE);
+   ASSERT_NEAR(identity.raw(1, 1), 1.0, TOLERANCE);
+}
+
+TEST(DimensionMatrix, KalmanPredict) {
+
+   // Constant velocity model, dt = 0.5 s
+   transition f = transition::identity();
+   f.set<0, 1>(timespan<seconds>(0.5));
+
+   column_vector<length<meters>, speed<meters, seconds>> x;
+   x.set<0, 0>(length<meters>(10.0));
+   x.set<1, 0>(speed<meters, seconds>(2.0));
+
+   const auto predicted = f * x;
+   ASSERT_NEAR(get_length_as<meters>(length<meters>(predicted.get<0, 0>())), 11.0, TOLERANCE);
+   ASSERT_NEAR((get_speed_as<meters, seconds>(speed<meters, seconds>(predicted.get<1, 0>()))), 2.0, TOLERANCE);
+
+   // P' = F P F^T + Q keeps the units of the covariance
+   covariance p = covariance::from_raw({4.0, 1.0, 1.0, 2.0});
+   const covariance q = covariance::from_raw({0.1, 0.0, 0.0, 0.1});
+   const covariance next = f * p * transpose(f) + q;
+
+   ASSERT_NEAR(next.raw(0, 0), 4.0 + 2.0 * 0.5 * 1.0 + 0.25 * 2.0 + 0.1, TOLERANCE);
+   ASSERT_NEAR(next.raw(0, 1), 1.0 + 0.5 * 2.0, TOLERANCE);
+   ASSERT_NEAR(next.raw(1, 0), 1.0 + 0.5 * 2.0, TOLERANCE);
+   ASSERT_NEAR(next.raw(1, 1), 2.1, TOLERANCE);
+
+   // The inner terms of P * P are an area and a squared speed, so the product does not compile
+   static_assert(!std::is_invocable_v<std::multiplies<>, covariance, covariance>);
+
+   // Inner terms in other units of one dimension are converted, here feet against meters
+   using feet_state = std::tuple<length<feet>, speed<meters, seconds>>;
+   const dimension_matrix<feet_state, inverse_dimensions_t<feet_state>> fFeet = f;
+   const auto fromFeet = fFeet * x;
+   ASSERT_NEAR(get_length_as<feet>(length<feet>(fromFeet.get<0, 0>())), 11.0 / 0.3048, 1e-9);
+}
+
+TEST(DimensionMatrix, InverseAndTranspose) {
+
+   const covariance p = covariance::from_raw({4.0, 1.0, 1.0, 2.0});
+   const auto inv = inverse(p);
+
+   // The inverse of a covariance has the units of the inverse state in both directions
+   static_assert(std::is_same_v<std::remove_cv_t<decltype(inv)>, dimension_matrix<inverse_dimensions_t<state>, inverse_dimensions_t<state>>>);
+
+   const auto product = p * inv;
+   ASSERT_NEAR(product.raw(0, 0), 1.0, TOLERANCE);
+   ASSERT_NEAR(product.raw(0, 1), 0.0, TOLERANCE);
+   ASSERT_NEAR(product.raw(1, 0), 0.0, TOLERANCE);
+   ASSERT_NEAR(product.raw(1, 1), 1.0, TOLERANCE);
+   ASSERT_NEAR(inv.raw(0, 0), 2.0 / 7.0, TOLERANCE);
+
+   // Pivoting handles a zero leading element
+   using pair = std::tuple<length<meters>, timespan<seconds>>;
+   const auto swapped = inverse(dimension_matrix<pair, pair>::from_raw({0.0, 2.0, 4.0, 0.0}));
+   ASSERT_NEAR(swapped.raw(0, 1), 0.25, TOLERANCE);
+   ASSERT_NEAR(swapped.raw(1, 0), 0.5, TOLERANCE);
+
+   ASSERT_THROW(static_cast<void>(inverse(covariance::from_raw({1.0, 2.0, 2.0, 4.0}))), std::invalid_argument);
+
+   using rows = std::tuple<length<meters>, length<meters>, length<meters>>;
+   using cols = std::tuple<timespan<seconds>, mass<grams>>;
+   const auto a = dimension_matrix<rows, cols>::from_raw({1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+   const auto t = transpose(a);
+   static_assert(decltype(t)::rows == 2 && decltype(t)::cols == 3);
+   ASSERT_NEAR(t.raw(0, 2), 5.0, TOLERANCE);
+   ASSERT_NEAR(t.raw(1, 0), 2.0, TOLERANCE);
+   ASSERT_TRUE(transpose(t) == a);
+}
@@ -0,0 +1,78 @@
+#include "DimensionTest.h"
+
+using namespace dimension;
+
+TEST(DynamicQuantity, Signature) {
+
+   const auto length_sig = dimension_signature::of("length", 1);
+   const auto time_sig = dimension_signature::of("timespan", 1);
+
+   // Static types map onto the same packed exponents
+   static_assert(dimension_signature_v<speed<meters, seconds>> == dimension_signature::of("length", 1) - dimension_signature::of("timespan", 1));
+   static_assert(dimension_signature_v<energy<joules>> == dimension_signature_v<decltype(force<newtons>(1.0) * length<meters>(1.0))>);
+   ASSERT_EQ((dimension_signature_v<speed<feet, hours>>), length_sig - time_sig);
+   ASSERT_TRUE(dimension_signature_v<decltype(length<meters>(1.0) / length<feet>(1.0))>.dimensionless());
+
+   // Rational exponents in steps of 1/6
+   const auto root = (length_sig + length_sig + length_sig).power(1, 6);
+   ASSERT_EQ(root.numerator(0), 1);
+   ASSERT_EQ(root.exponent_denominator(0), 2);
+   ASSERT_EQ((-root).steps(0), -3);
+   ASSERT_THROW(static_cast<void>(length_sig.power(1, 4)), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(dimension_signature::of("luminosity", 1)), std::invalid_argument);
+
+   // Byte-wise arithmetic keeps slots independent across sign changes, and reports overflow
+   const auto mixed = dimension_signature::of(0, -3) + dimension_signature::of(1, 2) - dimension_signature::of(2, 1);
+   ASSERT_EQ(mixed.steps(0), -18);
+   ASSERT_EQ(mixed.steps(1), 12);
+   ASSERT_EQ(mixed.steps(2), -6);
+   ASSERT_EQ(mixed.steps(3), 0);
+   ASSERT_EQ((mixed - mixed).packed(), 0u);
+   ASSERT_THROW(static_cast<void>(dimension_signature::of(6, 21) + dimension_signature::of(6, 1)), std::out_of_range);
+   ASSERT_THROW(static_cast<void>(dimension_signature::of(6, -21) - dimension_signature::of(6, 1)), std::out_of_range);
+}
+
+TEST(DynamicQuantity, Arithmetic) {
+
+   const dynamic_quantity distance(length<feet>(100.0));
+   const dynamic_quantity time(timespan<seconds>(10.0));
+
+   // Units are kept as the scale until they are needed
+   ASSERT_NEAR(distance.value(), 100.0, TOLERANCE);
+   ASSERT_NEAR(distance.primary_value(), 30.48, 1e-12);
+
+   const auto velocity = distance / time;
+   ASSERT_EQ(velocity.signature(), (dimension_signature_v<speed<meters, seconds>>));
+   ASSERT_NEAR(velocity.primary_value(), 3.048, 1e-12);
+
+   // Addition converts to the units of the left hand side and requires matching dimensions
+   const auto total = distance + dynamic_quantity(length<meters>(0.3048));
+   ASSERT_NEAR(total.value(), 101.0, 1e-12);
+   ASSERT_TRUE(dynamic_quantity(length<meters>(30.48)) == distance);
+   ASSERT_TRUE(distance < total);
+   ASSERT_THROW(static_cast<void>(distance + time), std::invalid_argument);
+   ASSERT_FALSE(distance == time);
+
+   const auto area_value = pow(distance, 2);
+   ASSERT_EQ(area_value.signature(), dimension_signature_v<area<meters>>);
+   ASSERT_NEAR(sqrt(area_value).primary_value(), 30.48, 1e-12);
+   ASSERT_EQ(pow(time, -1).signature(), -time.signature());
+}
+
+TEST(DynamicQuantity, QuantityCast) {
+
+   // Units known only at runtime, here kilometers per hour
+   const dynamic_quantity velocity(90.0, 1000.0 / 3600.0, dimension_signature::of("length", 1) - dimension_signature::of("timespan", 1));
+
+   const auto fast = quantity_cast<speed<meters, seconds>>(velocity);
+   ASSERT_NEAR((get_speed_as<meters, seconds>(fast)), 25.0, 1e-12);
+   ASSERT_NEAR((get_speed_as<kilo_meters, hours>(quantity_cast<speed<kilo_meters, hours>>(velocity))), 90.0, 1e-12);
+
+   ASSERT_TRUE((has_dimensions_of<speed<feet, minutes>>(velocity)));
+   ASSERT_FALSE(has_dimensions_of<length<meters>>(velocity));
+   ASSERT_THROW(static_cast<void>(quantity_cast<length<meters>>(velocity)), std::invalid_argument);
+
+   // Round trip through the dynamic type keeps the static units
+   const energy<joules> work(12.5);
+   ASSERT_NEAR(get_energy_as<joules>(quantity_cast<energy<joules>>(dynamic_quantity(work))), 12.5, 1e-12);
+}
@@ -0,0 +1,110 @@
+#include "DimensionTest.h"
+
+#include <cstdint>
+
+using namespace dimension;
+
+TEST(ExactConversion, ExactFactors) {
+
+   // Factors are reduced rationals, composed through the primary unit of each dimension
+   static_assert(std::ratio_equal_v<exact_factor_t<length<feet>, length<inches>>, std::ratio<12>>);
+   static_assert(std::ratio_equal_v<exact_factor_t<length<milli_meters>, length<meters>>, std::milli>);
+   static_assert(std::ratio_equal_v<exact_factor_t<speed<kilo_meters, hours>, speed<meters, seconds>>, std::ratio<5, 18>>);
+   static_assert(std::ratio_equal_v<exact_factor_t<temperature<deci_kelvin>, temperature<kelvin>>, std::deci>);
+
+   // Conversions which only provide a floating slope have no exact factor
+   static_assert(!has_exact_factor_v<angle<degrees>, angle<radians>>);
+}
+
+TEST(ExactConversion, IntegralRepsConvertExactly) {
+
+   // Through a double factor, 1 s truncates to 999999999 ns and 645 in to 16382 mm
+   const timespan<std::int64_t, seconds> oneSecond(1);
+   ASSERT_EQ(get_timespan_as<nano_seconds>(oneSecond), 1'000'000'000);
+
+   const length<std::int32_t, milli_meters> inMillimeters = length<std::int32_t, inches>(645);
+   ASSERT_EQ(get_length_as<milli_meters>(inMillimeters), 16383);
+   ASSERT_EQ(get_length_as<inches>(length<std::int32_t, feet>(1)), 12);
+
+   const length<std::int32_t, milli_meters> telemetry(-1999);
+   ASSERT_EQ(get_length_as<meters>(telemetry), -1);
+   ASSERT_EQ(get_length_as<milli_meters>(length<std::int32_t, meters>(7)), 7000);
+
+   const temperature<std::int16_t, deci_kelvin> sensor(static_cast<std::int16_t>(2981));
+   ASSERT_EQ(get_temperature_as<kelvin>(sensor), 298);
+
+   // 64-bit values keep every digit
+   const length<std::int64_t, kilo_meters> far(4'000'000'000'000LL);
+   ASSERT_EQ(get_length_as<milli_meters>(far), 4'000'000'000'000'000'000LL);
+}
+
+TEST(ExactConversion, RoundingPolicies) {
+
+   const length<std::int32_t, milli_meters> positive(2500);
+   const length<std::int32_t, milli_meters> negative(-2500);
+   using target = length<std::int32_t, meters>;
+
+   ASSERT_EQ(get_length_as<meters>(dimension_cast<target>(positive)), 2);
+   ASSERT_EQ(get_length_as<meters>(dimension_cast<target>(negative)), -2);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<target, rounding::to_nearest>(positive))), 3);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<target, rounding::to_nearest>(negative))), -3);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<target, rounding::down>(negative))), -3);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<target, rounding::up>(negative))), -2);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<target, rounding::up>(positive))), 3);
+
+   // Power of two denominators round down with a shift
+   using quarter_inches = base_dimension<std::int32_t, unit_exponent<inches>, std::ratio<1, 4>>;
+   const quarter_inches steps(-5);
+   using whole_inches = length<std::int32_t, inches>;
+   ASSERT_EQ(get_length_as<inches>((dimension_cast<whole_inches, rounding::down>(steps))), -2);
+   ASSERT_EQ(get_length_as<inches>((dimension_cast<whole_inches, rounding::to_nearest>(steps))), -1);
+
+   // Floating point sources round with the same policies
+   const length<double, meters> measured(2.5);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<target, rounding::to_nearest>(measured))), 3);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<target, rounding::down>(-measured))), -3);
+}
+
+TEST(ExactConversion, OverflowPolicies) {
+
+   const length<std::int32_t, meters> distance(40);
+   using small = length<std::int16_t, milli_meters>;
+
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<small, rounding::toward_zero, overflow::saturate>(distance))), INT16_MAX);
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<small, rounding::toward_zero, overflow::saturate>(-distance))), INT16_MIN);
+   ASSERT_THROW(static_cast<void>(dimension_cast<small, rounding::toward_zero, overflow::checked>(distance)), std::out_of_range);
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<small, rounding::toward_zero, overflow::checked>(length<std::int32_t, meters>(32)))), 32000);
+
+   // Unsigned targets saturate at zero
+   using unsigned_mm = length<std::uint16_t, milli_meters>;
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<unsigned_mm, rounding::toward_zero, overflow::saturate>(-distance))), 0);
+
+   ASSERT_THROW(static_cast<void>(dimension_cast<small, rounding::toward_zero, overflow::checked>(length<double, meters>(40.0))), std::out_of_range);
+}
+
+TEST(ExactConversion, OverflowPoliciesWiderTarget) {
+
+   // Targets wider than the source cannot overflow, whatever the intermediate type
+   const length<std::int16_t, milli_meters> shortDistance(5000);
+   using wide_meters = length<std::int64_t, meters>;
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<wide_meters, rounding::to_nearest, overflow::saturate>(shortDistance))), 5);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<wide_meters, rounding::to_nearest, overflow::checked>(shortDistance))), 5);
+   ASSERT_EQ(get_length_as<meters>((dimension_cast<wide_meters, rounding::to_nearest, overflow::checked>(-shortDistance))), -5);
+
+   const length<std::int16_t, meters> distance(3);
+   using wide_mm = length<std::int64_t, milli_meters>;
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<wide_mm, rounding::toward_zero, overflow::checked>(length<std::int16_t, meters>(INT16_MIN)))), INT16_MIN * 1000LL);
+
+   // Unsigned targets at least as wide as the intermediate still clamp negatives to zero
+   using unsigned_mm = length<std::uint32_t, milli_meters>;
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<unsigned_mm, rounding::toward_zero, overflow::saturate>(distance))), 3000u);
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<unsigned_mm, rounding::toward_zero, overflow::checked>(distance))), 3000u);
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<unsigned_mm, rounding::toward_zero, overflow::saturate>(-distance))), 0u);
+   ASSERT_THROW(static_cast<void>(dimension_cast<unsigned_mm, rounding::toward_zero, overflow::checked>(-distance)), std::out_of_range);
+
+   using unsigned_wide_mm = length<std::uint64_t, milli_meters>;
+   const length<std::int64_t, meters> longDistance(7);
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<unsigned_wide_mm, rounding::toward_zero, overflow::saturate>(longDistance))), 7000u);
+   ASSERT_EQ(get_length_as<milli_meters>((dimension_cast<unsigned_wide_mm, rounding::toward_zero, overflow::saturate>(-longDistance))), 0u);
+   ASSERT_THROW(static_cast<void>(dimension_cast<unsigned_wide_mm, rounding::toward_zero, overflow::checked>(-longDistance)), std::out_of_range);
+}
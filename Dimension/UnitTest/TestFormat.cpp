@@ -0,0 +1,54 @@
+#include "DimensionTest.h"
+
+#include <array>
+#include <sstream>
+#include <string_view>
+
+using namespace dimension;
+
+TEST(Format, UnitSuffix) {
+
+   static_assert(unit_suffix<speed<meters, seconds>>() == " [m * s^-1]");
+   static_assert(unit_suffix<energy<joules>>() == " [kg * m^2 * s^-2]");
+   static_assert(unit_suffix<base_dimension<unit_exponent<meters, 1, 2>>>() == " [m^(1/2)]");
+   static_assert(unit_suffix<base_dimension<unit_exponent<seconds, -3, 2>>>() == " [s^(-3/2)]");
+
+   // The precomputed suffix matches the units written piece by piece
+   std::ostringstream pieces;
+   stream_units_tuple<std::ostream, typename acceleration<feet, seconds>::units>(pieces);
+   ASSERT_EQ(" [" + pieces.str() + "]", (unit_suffix<acceleration<feet, seconds>>()));
+}
+
+TEST(Format, ToStringAndToChars) {
+
+   // to_string matches a default formatted stream
+   const speed<meters, seconds> v(12.3456789);
+   std::ostringstream stream;
+   stream << v;
+   ASSERT_EQ(to_string(v), stream.str());
+   ASSERT_EQ(to_string(v), "12.3457 [m * s^-1]");
+   ASSERT_EQ(to_string(length<std::int32_t, milli_meters>(-42)), "-42 [mm]");
+   ASSERT_EQ(to_string(length<meters>(1e-7)), "1e-07 [m]");
+
+   std::array<char, 32> buffer{};
+   auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), v);
+   ASSERT_EQ(std::string_view(buffer.data(), result.ptr), "12.3456789 [m * s^-1]");
+
+   result = to_chars(buffer.data(), buffer.data() + buffer.size(), v, std::chars_format::fixed, 2);
+   ASSERT_EQ(std::string_view(buffer.data(), result.ptr), "12.35 [m * s^-1]");
+
+   // Too small for the suffix
+   result = to_chars(buffer.data(), buffer.data() + 12, v);
+   ASSERT_EQ(result.ec, std::errc::value_too_large);
+}
+
+#if defined(__cpp_lib_format)
+TEST(Format, Formatter) {
+
+   const speed<meters, seconds> v(12.5);
+   ASSERT_EQ(std::format("{}", v), "12.5 [m * s^-1]");
+   ASSERT_EQ(std::format("{:.3f}", v), "12.500 [m * s^-1]");
+   ASSERT_EQ(std::format("{:.1f;km/h}", v), "45.0 [km/h]");
+   ASSERT_EQ(std::format("{:;mm}", length<std::int32_t, meters>(3)), "3000 [mm]");
+}
+#endif
@@ -1,6 +1,7 @@
 #include "DimensionTest.h"
 
 #include <iostream>
+#include <vector>
 
 using namespace dimension;
 
@@ -150,4 +151,40 @@ TEST(Functions, PlaceholderTest2) {
    auto c1 = t1 / c;
    EXPECT_NEAR(get_timespan_as<seconds>(c1), 59.63, 0.0000001);
 
-}
\ No newline at end of file
+}
+
+TEST(Functions, PointRepAndFrameConversion) {
+
+   // Points carry their Rep through conversions, as dimensions do
+   point<celsius, temperatureType, float> boiling{100.0f};
+   static_assert(std::is_same_v<decltype(get_point_as<fahrenheit>(boiling)), float>);
+   EXPECT_FLOAT_EQ(get_point_as<fahrenheit>(boiling), 212.0f);
+   EXPECT_FLOAT_EQ(get_point_as<kelvin>(boiling), 373.15f);
+
+   point<kelvin, temperatureType, float> boilingKelvin = boiling;
+   EXPECT_FLOAT_EQ(get_point_as<kelvin>(boilingKelvin), 373.15f);
+
+   // The source offset, slope and target offset fold into one affine transform
+   static_assert(point_conversion<fahrenheit, celsius>::slope == GetSlope<kelvin, rankine>());
+   EXPECT_NEAR((point_conversion<fahrenheit, celsius>::offset), 32.0, 1e-12);
+   EXPECT_NEAR((point_conversion<celsius, celsius>::offset), 0.0, 0.0);
+
+   std::vector<double> celsiusValues{-40.0, 0.0, 37.0, 100.0, -273.15};
+   std::vector<double> fahrenheitValues(celsiusValues.size());
+   convert_points<fahrenheit, celsius>(celsiusValues, fahrenheitValues);
+
+   for (std::size_t i = 0; i < celsiusValues.size(); ++i)
+   {
+      point<celsius, temperatureType> expected{celsiusValues[i]};
+      EXPECT_NEAR(fahrenheitValues[i], get_point_as<fahrenheit>(expected), 1e-9);
+   }
+   EXPECT_NEAR(fahrenheitValues[0], -40.0, 1e-9);
+
+   // In place, and to a bare unit
+   convert_points<kelvin, fahrenheit>(fahrenheitValues);
+   EXPECT_NEAR(fahrenheitValues[3], 373.15, 1e-9);
+   EXPECT_NEAR(fahrenheitValues[4], 0.0, 1e-9);
+
+   std::vector<double> tooSmall(2);
+   EXPECT_THROW((convert_points<kelvin, celsius>(celsiusValues, tooSmall)), std::invalid_argument);
+}
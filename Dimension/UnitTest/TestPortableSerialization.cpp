@@ -0,0 +1,143 @@
+#include "DimensionTest.h"
+
+#include <array>
+#include <bit>
+#include <vector>
+
+using namespace dimension;
+
+namespace
+{
+   using little = PortableSerializationPolicy<FNV_1a_32Bit, std::endian::little>;
+   using big = PortableSerializationPolicy<FNV_1a_32Bit, std::endian::big>;
+}
+
+TEST(PortableSerialization, ByteSwapKernels) {
+
+   static_assert(byteswap(std::uint32_t{0x01020304}) == 0x04030201);
+   static_assert(byteswap(byteswap(1.5)) == 1.5);
+   static_assert(to_byte_order<std::endian::native>(std::uint16_t{0x0102}) == 0x0102);
+
+   // Lengths covering the vector loops and the scalar tail, in place and out of place
+   std::vector<std::uint64_t> wide(37);
+   std::vector<std::uint16_t> narrow(53);
+   for (std::size_t i = 0; i < wide.size(); ++i)
+   {
+      wide[i] = 0x0102030405060708u * (i + 1);
+   }
+   for (std::size_t i = 0; i < narrow.size(); ++i)
+   {
+      narrow[i] = static_cast<std::uint16_t>(0x0102u * (i + 1));
+   }
+
+   std::vector<std::uint64_t> swapped(wide.size());
+   kernels::byteswap_copy<8>(reinterpret_cast<const std::byte*>(wide.data()), reinterpret_cast<std::byte*>(swapped.data()), wide.size());
+   for (std::size_t i = 0; i < wide.size(); ++i)
+   {
+      ASSERT_EQ(swapped[i], byteswap(wide[i]));
+   }
+
+   const std::vector<std::uint16_t> original = narrow;
+   kernels::byteswap_copy<2>(reinterpret_cast<const std::byte*>(narrow.data()), reinterpret_cast<std::byte*>(narrow.data()), narrow.size());
+   for (std::size_t i = 0; i < narrow.size(); ++i)
+   {
+      ASSERT_EQ(narrow[i], byteswap(original[i]));
+   }
+}
+
+TEST(PortableSerialization, RoundTrip) {
+
+   using sample = pressure<pascals>;
+   const std::vector<sample> samples{sample(101325.0), sample(99000.5), sample(-12.25)};
+
+   // The header is padded so aligned values stay aligned
+   static_assert(little::header_size == 16);
+   static_assert(PortableSerializationPolicy<NoHash>::header_size == 8);
+
+   std::array<std::byte, big::block_size<sample>(3)> buffer{};
+   ASSERT_EQ((serialize_block<sample, decltype(buffer)&, big>(buffer, samples)), buffer.size());
+
+   // Every field is big endian on the wire
+   const std::uint32_t tag = TypeTagHelper<sample, FNV_1a_32Bit>::value().get();
+   ASSERT_EQ(buffer[0], static_cast<std::byte>(tag >> 24));
+   ASSERT_EQ(buffer[4], std::byte{'f'});
+   ASSERT_EQ(buffer[5], std::byte{8});
+   ASSERT_EQ(buffer[6], std::byte{'B'});
+   ASSERT_EQ(buffer[11], std::byte{3});
+   ASSERT_EQ(buffer[big::header_size], std::byte{0x40});
+
+   std::array<sample, 3> result{};
+   ASSERT_EQ(big::deserialize<sample>(buffer, std::span(result)), 3u);
+   std::array<double, 3> raw{};
+   ASSERT_EQ(big::deserialize<sample>(buffer, std::span(raw)), 3u);
+   for (std::size_t i = 0; i < samples.size(); ++i)
+   {
+      ASSERT_EQ(get_pressure_as<pascals>(result[i]), get_pressure_as<pascals>(samples[i]));
+      ASSERT_EQ(raw[i], get_pressure_as<pascals>(samples[i]));
+   }
+
+   // Raw values of a dimension_array, in little endian
+   const dimension_array<sample> arr{sample(1.0), sample(2.0), sample(3.0)};
+   std::vector<std::byte> storage(little::block_size<sample>(arr.size()));
+   little::serialize<sample>(storage, arr.values());
+   auto loaded = dimension_array<sample>::uninitialized(little::count<sample>(storage));
+   ASSERT_EQ(little::deserialize<sample>(storage, loaded.values()), 3u);
+   ASSERT_TRUE(std::ranges::equal(loaded.values(), arr.values()));
+
+   // Single values through the Serializer facade
+   const auto single = serialize<sample, std::vector<uint8_t>, big>(sample(42.0));
+   ASSERT_EQ(single.size(), big::block_size<sample>(1));
+   ASSERT_EQ((get_pressure_as<pascals>(deserialize<sample, std::vector<uint8_t>, big>(single))), 42.0);
+}
+
+TEST(PortableSerialization, WiderRep) {
+
+   // Logged as float and int16, read as double and int32
+   const std::array<length<float, meters>, 2> logged{length<float, meters>(1.5f), length<float, meters>(-0.25f)};
+   std::array<std::byte, big::block_size<length<float, meters>>(2)> buffer{};
+   big::serialize<length<float, meters>>(buffer, std::span(logged));
+
+   std::array<length<meters>, 2> wide{};
+   ASSERT_EQ(big::deserialize<length<meters>>(buffer, std::span(wide)), 2u);
+   ASSERT_EQ(get_length_as<meters>(wide[0]), 1.5);
+   ASSERT_EQ(get_length_as<meters>(wide[1]), -0.25);
+
+   const std::array<std::int16_t, 3> counts{-3, 0, 300};
+   std::array<std::byte, big::block_size<length<std::int16_t, meters>>(3)> countBuffer{};
+   big::serialize<length<std::int16_t, meters>>(countBuffer, std::span(counts));
+   std::array<std::int32_t, 3> wideCounts{};
+   ASSERT_EQ((big::deserialize<length<std::int32_t, meters>>(countBuffer, std::span(wideCounts))), 3u);
+   ASSERT_EQ(wideCounts[0], -3);
+   ASSERT_EQ(wideCounts[2], 300);
+
+   // Narrower Reps, other kinds, other byte orders and other types are rejected
+   std::array<std::byte, big::block_size<length<meters>>(2)> doubles{};
+   big::serialize<length<meters>>(doubles, std::span(wide));
+   std::array<length<float, meters>, 2> narrowed{};
+   ASSERT_THROW((big::deserialize<length<float, meters>>(doubles, std::span(narrowed))), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(big::count<length<std::int64_t, meters>>(doubles)), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(little::count<length<meters>>(doubles)), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(big::count<length<feet>>(doubles)), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(big::count<length<meters>>(std::span(doubles).first(20))), std::invalid_argument);
+
+   std::array<length<meters>, 1> small{};
+   ASSERT_THROW(big::deserialize<length<meters>>(doubles, std::span(small)), std::invalid_argument);
+}
+
+TEST(PortableSerialization, Coefficients) {
+
+   // Values are stored without the coefficient, which the tag already identifies
+   using kilo = base_dimension<double, unit_exponent<meters>, std::ratio<1000>>;
+   const std::array<kilo, 2> objs{kilo(2.0), kilo(-0.5)};
+   std::array<std::byte, big::block_size<kilo>(2)> buffer{};
+   big::serialize<kilo>(buffer, std::span(objs));
+
+   std::array<double, 2> raw{};
+   ASSERT_EQ(big::deserialize<kilo>(buffer, std::span(raw)), 2u);
+   ASSERT_EQ(raw[0], 2.0);
+
+   std::array<kilo, 2> result{};
+   ASSERT_EQ(big::deserialize<kilo>(buffer, std::span(result)), 2u);
+   ASSERT_NEAR((get_dimension_as<unit_exponent<meters>>(result[0])), 2000.0, TOLERANCE);
+   ASSERT_NEAR((get_dimension_as<unit_exponent<meters>>(result[1])), -500.0, TOLERANCE);
+}
@@ -0,0 +1,111 @@
+#include "DimensionTest.h"
+
+#include <cstdint>
+
+using namespace dimension;
+
+TEST(Reductions, SumMeanMinMaxNorm) {
+
+   dimension_array<length<feet>> arr{length<feet>(3.0), length<feet>(-1.0), length<feet>(4.0), length<feet>(6.0)};
+
+   // Results are in the units of the array
+   static_assert(std::is_same_v<decltype(sum(arr)), length<feet>>);
+   ASSERT_NEAR(get_length_as<feet>(sum(arr)), 12.0, TOLERANCE);
+   ASSERT_NEAR(get_length_as<feet>(mean(arr)), 3.0, TOLERANCE);
+   ASSERT_NEAR(get_length_as<meters>(sum(execution::par, arr)), 12.0 * 0.3048, TOLERANCE);
+
+   const auto [low, high] = minmax(arr);
+   ASSERT_NEAR(get_length_as<feet>(low), -1.0, TOLERANCE);
+   ASSERT_NEAR(get_length_as<feet>(high), 6.0, TOLERANCE);
+
+   dimension_array<length<meters>> sides{length<meters>(3.0), length<meters>(4.0)};
+   ASSERT_NEAR(get_length_as<meters>(norm(sides)), 5.0, TOLERANCE);
+
+   dimension_array<length<meters>> empty;
+   ASSERT_NEAR(get_length_as<meters>(sum(empty)), 0.0, TOLERANCE);
+   ASSERT_THROW(static_cast<void>(mean(empty)), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(minmax(empty)), std::invalid_argument);
+}
+
+TEST(Reductions, DotProductUnits) {
+
+   dimension_array<force<newtons>> forces{force<newtons>(2.0), force<newtons>(3.0), force<newtons>(-1.0)};
+   dimension_array<length<feet>> distances{length<feet>(10.0), length<feet>(1.0), length<feet>(4.0)};
+
+   // force . length is an energy
+   const auto work = dot(forces, distances);
+   static_assert(matching_dimensions<std::remove_cv_t<decltype(work)>, energy<joules>>);
+
+   const energy<joules> asJoules = work;
+   ASSERT_NEAR(get_energy_as<joules>(asJoules), 19.0 * 0.3048, TOLERANCE);
+
+   dimension_array<length<feet>> tooShort{length<feet>(1.0)};
+   ASSERT_THROW(static_cast<void>(dot(forces, tooShort)), std::invalid_argument);
+}
+
+TEST(Reductions, ParallelMatchesSequentialAndCompensates) {
+
+   // Large enough to be split across several threads, the exact sum is count / 3
+   constexpr std::size_t count = 3u << 18;
+   dimension_array<length<meters>> arr(count);
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      constexpr double pattern[] = {1.0, 1.0e16, -1.0e16};
+      arr.data()[i] = pattern[i % 3];
+   }
+
+   // The summation order is fixed, so the policy and thread count never change the result
+   const double sequential = get_length_as<meters>(sum(arr));
+   ASSERT_EQ(get_length_as<meters>(sum(execution::par, arr)), sequential);
+   ASSERT_EQ(get_length_as<meters>(sum(execution::parallel_policy{3}, arr)), sequential);
+
+   // Plain addition loses the small values next to the large ones, compensation recovers them
+   const double exact = static_cast<double>(count / 3);
+   ASSERT_EQ(get_length_as<meters>(sum<summation::neumaier>(execution::par, arr)), exact);
+   ASSERT_EQ(get_length_as<meters>(sum<summation::neumaier>(arr)), exact);
+   ASSERT_EQ(get_length_as<meters>(mean<summation::neumaier>(execution::parallel_policy{3}, arr)), 1.0 / 3.0);
+
+   const auto [low, high] = minmax(execution::par, arr);
+   ASSERT_EQ(get_length_as<meters>(low), -1.0e16);
+   ASSERT_EQ(get_length_as<meters>(high), 1.0e16);
+}
+
+TEST(Reductions, CountIfThresholds) {
+
+   dimension_array<length<feet>> arr{length<feet>(1.0), length<feet>(10.0), length<feet>(16.0), length<feet>(17.0), length<feet>(40.0)};
+
+   // 5 m is 16.4042 ft, the threshold is converted once to feet
+   ASSERT_EQ(count_if(arr, greater_than(length<meters>(5.0))), 2u);
+   ASSERT_EQ(count_if(execution::par, arr, less_than(length<meters>(5.0))), 3u);
+   ASSERT_EQ(count_if(arr, greater_equal(length<feet>(16.0))), 3u);
+   ASSERT_EQ(count_if(arr, less_equal(length<feet>(10.0))), 2u);
+
+   // Threshold predicates also apply to single values
+   ASSERT_TRUE(greater_than(length<meters>(5.0))(length<feet>(17.0)));
+
+   // Any other predicate is called with each element
+   ASSERT_EQ(count_if(arr, [](const length<feet>& value) { return get_length_as<feet>(value) < 12.0; }), 2u);
+}
+
+TEST(Reductions, CountIfIntegralThresholds) {
+
+   using mm = length<std::int32_t, milli_meters>;
+   dimension_array<mm> arr;
+   for (std::int32_t value : {-1, 0, 1, 2})
+   {
+      arr.push_back(mm(value));
+   }
+
+   // Fractional thresholds round the way each comparison needs
+   ASSERT_EQ(count_if(arr, less_than(length<milli_meters>(1.5))), 3u);
+   ASSERT_EQ(count_if(arr, less_equal(length<milli_meters>(1.5))), 3u);
+   ASSERT_EQ(count_if(arr, greater_than(length<milli_meters>(-0.5))), 3u);
+   ASSERT_EQ(count_if(arr, greater_equal(length<milli_meters>(-0.5))), 3u);
+   ASSERT_EQ(count_if(arr, greater_than(length<micro_meters>(1))), 2u);
+
+   // Thresholds beyond the range of the Rep hold for every element or for none
+   ASSERT_EQ(count_if(arr, less_than(length<meters>(1.0e9))), 4u);
+   ASSERT_EQ(count_if(arr, greater_equal(length<meters>(1.0e9))), 0u);
+   ASSERT_EQ(count_if(arr, greater_than(length<meters>(-1.0e9))), 4u);
+   ASSERT_EQ(count_if(arr, less_equal(length<meters>(-1.0e9))), 0u);
+}
@@ -0,0 +1,72 @@
+#include "DimensionTest.h"
+
+#include <type_traits>
+
+using namespace dimension;
+
+// The unit tests build with -Wdouble-promotion -Werror, so any arithmetic below which
+// silently widened float to double would fail to compile rather than only run slower.
+
+TEST(RepPreservation, FloatArithmeticStaysFloat) {
+
+   const length<float, meters> distance(150.0f);
+   const timespan<float, seconds> time(12.0f);
+
+   const auto velocity = distance / time;
+   static_assert(std::is_same_v<decltype(velocity)::rep, float>);
+
+   const auto doubled = distance * 2.0;
+   const auto doubledLeft = 2.0 * distance;
+   const auto halved = distance / 2.0;
+   const auto rate = 1.0 / time;
+   static_assert(std::is_same_v<decltype(doubled)::rep, float>);
+   static_assert(std::is_same_v<decltype(doubledLeft)::rep, float>);
+   static_assert(std::is_same_v<decltype(halved)::rep, float>);
+   static_assert(std::is_same_v<decltype(rate)::rep, float>);
+
+   const auto total = distance + length<float, feet>(10.0f);
+   const auto difference = distance - length<float, feet>(10.0f);
+   static_assert(std::is_same_v<decltype(total)::rep, float>);
+   static_assert(std::is_same_v<decltype(difference)::rep, float>);
+
+   ASSERT_FLOAT_EQ(get_length_as<meters>(doubled), 300.0f);
+   ASSERT_FLOAT_EQ(get_length_as<meters>(halved), 75.0f);
+   ASSERT_FLOAT_EQ(get_length_as<meters>(total), 153.048f);
+   ASSERT_FLOAT_EQ(get_frequency_as<hertz>(rate), 1.0f / 12.0f);
+
+   length<float, meters> scaled = distance;
+   scaled *= 0.5;
+   scaled /= 3.0;
+   ASSERT_FLOAT_EQ(get_length_as<meters>(scaled), 25.0f);
+}
+
+TEST(RepPreservation, FloatConversionsStayFloat) {
+
+   const speed<float, meters, seconds> velocity(12.5f);
+
+   static_assert(std::is_same_v<decltype(get_speed_as<kilo_meters, hours>(velocity)), float>);
+   static_assert(std::is_same_v<decltype(get_length_as<feet>(length<float, meters>(1.0f))), float>);
+   static_assert(std::is_same_v<decltype(Convert<unit_exponent<feet>, unit_exponent<meters>>(1.0f)), float>);
+
+   ASSERT_FLOAT_EQ((get_speed_as<kilo_meters, hours>(velocity)), 45.0f);
+
+   const speed<float, kilo_meters, hours> converted = velocity;
+   ASSERT_FLOAT_EQ((get_speed_as<meters, seconds>(converted)), 12.5f);
+
+   ASSERT_FLOAT_EQ((Convert<unit_exponent<feet>, unit_exponent<meters>>(10.0f)), 3.048f);
+}
+
+TEST(RepPreservation, IntegralRepsPromoteWithScalars) {
+
+   const length<int, meters> distance(10);
+
+   // Integral Reps follow the usual arithmetic conversions with floating-point scalars
+   const auto halved = distance * 0.5;
+   static_assert(std::is_same_v<decltype(halved)::rep, double>);
+   ASSERT_DOUBLE_EQ(get_length_as<meters>(halved), 5.0);
+
+   const auto tripled = distance * 3;
+   static_assert(std::is_same_v<decltype(tripled)::rep, int>);
+   static_assert(std::is_same_v<decltype(get_length_as<meters>(tripled)), int>);
+   ASSERT_EQ(get_length_as<meters>(tripled), 30);
+}
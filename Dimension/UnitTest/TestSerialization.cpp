@@ -100,3 +100,138 @@ TEST(Serialization, TestShouldCancel)
 {
     ValidateAll<unit_exponent<meters>, unit_exponent<meters, -1>>();
 }
+
+TEST(Serialization, BlockRoundTrip)
+{
+    using sample = pressure<pascals>;
+    using block = BlockSerializationPolicy<FNV_1a_32Bit>;
+
+    const std::vector<sample> samples{sample(101325.0), sample(99000.5), sample(-12.25)};
+
+    // One tag and one count, followed by the packed values
+    std::array<std::byte, block::block_size<sample>(3)> buffer{};
+    static_assert(buffer.size() == sizeof(uint32_t) + sizeof(uint32_t) + 3 * sizeof(PrecisionType));
+    EXPECT_EQ(serialize_block<sample>(buffer, samples), buffer.size());
+
+    EXPECT_EQ(block_count<sample>(buffer), 3u);
+
+    std::array<sample, 4> result{};
+    EXPECT_EQ(deserialize_block<sample>(buffer, std::span(result)), 3u);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        EXPECT_EQ((get_pressure_as<pascals>(result[i])), (get_pressure_as<pascals>(samples[i])));
+    }
+
+    // Raw values of a dimension_array, into a byte span over a larger buffer
+    dimension_array<sample> arr{sample(1.0), sample(2.0)};
+    std::vector<uint8_t> storage(64);
+    const std::size_t written = serialize_block<sample>(std::span(storage).first(40), arr.values());
+    EXPECT_EQ(written, block::block_size<sample>(2));
+
+    auto loaded = dimension_array<sample>::uninitialized(block_count<sample>(storage));
+    EXPECT_EQ(deserialize_block<sample>(storage, loaded.values()), 2u);
+    EXPECT_TRUE(std::ranges::equal(loaded.values(), arr.values()));
+
+    // The Serializer facade forwards blocks to the policy
+    using BlockSerializer = Serializer<sample, block>;
+    std::array<uint32_t, 8> words{};
+    EXPECT_EQ(BlockSerializer::serialize(words, std::span<const sample>(samples).first(2)), block::block_size<sample>(2));
+    EXPECT_EQ(BlockSerializer::deserialize(words, std::span(result)), 2u);
+    EXPECT_EQ((get_pressure_as<pascals>(result[1])), 99000.5);
+
+    // An empty block holds only the header
+    EXPECT_EQ(serialize_block<sample>(buffer, std::span<const sample>()), block::header_size);
+    EXPECT_EQ(block_count<sample>(buffer), 0u);
+}
+
+TEST(Serialization, RepGeneric)
+{
+    using int_meters = base_dimension<std::int32_t, unit_exponent<meters>>;
+    using kilo = base_dimension<float, unit_exponent<meters>, std::ratio<1000>>;
+
+    // Records hold the Rep of the type rather than a PrecisionType
+    auto intBuffer = serialize(int_meters(-7));
+    EXPECT_EQ(intBuffer.size(), sizeof(uint32_t) + sizeof(std::int32_t));
+    EXPECT_EQ((deserialize<int_meters>(intBuffer).get_tuple_scalar<typename int_meters::units>()), -7);
+
+    // Stored raw, without the coefficient
+    auto kiloBuffer = serialize(kilo(2.5f));
+    EXPECT_EQ(kiloBuffer.size(), sizeof(uint32_t) + sizeof(float));
+    float raw;
+    std::memcpy(&raw, kiloBuffer.data() + sizeof(uint32_t), sizeof(raw));
+    EXPECT_EQ(raw, 2.5f);
+    EXPECT_NEAR((get_dimension_as<unit_exponent<meters>>(deserialize<kilo>(kiloBuffer))), 2500.0, TOLERANCE);
+}
+
+TEST(Serialization, BlockRoundTripCoefficient)
+{
+    using kilo = base_dimension<double, unit_exponent<meters>, std::ratio<1000>>;
+
+    const std::array<kilo, 2> objs{kilo(2.0), kilo(-0.5)};
+    std::array<std::byte, BlockSerializationPolicy<FNV_1a_32Bit>::block_size<kilo>(2)> buffer{};
+    serialize_block<kilo>(buffer, std::span(objs));
+
+    // Values are stored without the coefficient, like the raw value overloads
+    std::array<double, 2> raw{};
+    EXPECT_EQ(deserialize_block<kilo>(buffer, std::span(raw)), 2u);
+    EXPECT_EQ(raw[0], 2.0);
+
+    std::array<kilo, 2> result{};
+    EXPECT_EQ(deserialize_block<kilo>(buffer, std::span(result)), 2u);
+    EXPECT_NEAR((get_dimension_as<unit_exponent<meters>>(result[0])), 2000.0, TOLERANCE);
+    EXPECT_NEAR((get_dimension_as<unit_exponent<meters>>(result[1])), -500.0, TOLERANCE);
+}
+
+TEST(Serialization, BlockValidation)
+{
+    using sample = pressure<pascals>;
+
+    const std::array<sample, 2> samples{sample(1.0), sample(2.0)};
+    std::array<std::byte, 32> buffer{};
+    serialize_block<sample>(buffer, std::span(samples));
+
+    // Wrong type, short buffers and short destinations are rejected
+    std::array<length<meters>, 2> lengths{};
+    EXPECT_THROW(deserialize_block<length<meters>>(buffer, std::span(lengths)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(block_count<sample>(std::span(buffer).first(12))), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(block_count<sample>(std::span(buffer).first(6))), std::invalid_argument);
+
+    std::array<sample, 1> small{};
+    EXPECT_THROW(deserialize_block<sample>(buffer, std::span(small)), std::invalid_argument);
+
+    std::array<std::byte, 16> tooSmall{};
+    EXPECT_THROW(serialize_block<sample>(tooSmall, std::span(samples)), std::invalid_argument);
+
+    // Without a hash the block starts with the count
+    using unhashed = BlockSerializationPolicy<NoHash>;
+    static_assert(unhashed::header_size == sizeof(uint32_t));
+    EXPECT_EQ(unhashed::serialize<sample>(buffer, std::span(samples)), sizeof(uint32_t) + 2 * sizeof(PrecisionType));
+    EXPECT_EQ(unhashed::count<sample>(buffer), 2u);
+}
+
+TEST(Serialization, HashPolicies)
+{
+    // Reference values of FNV-1a 64 and XXH64 with a zero seed
+    static_assert(FNV_1a_64Bit::hash("") == 0xCBF29CE484222325);
+    static_assert(FNV_1a_64Bit::hash("a") == 0xAF63DC4C8601EC8C);
+    static_assert(XXHash64::hash("") == 0xEF46DB3751D8E999);
+    static_assert(XXHash64::hash("abc") == 0x44BC2CF5AD770999);
+    static_assert(XXHash64::hash("The quick brown fox jumps over the lazy dog") == 0x0B242D361FDA71BC);
+
+    // Tags depend on the units, not on the order they are written in
+    using forward = base_dimension<unit_exponent<grams>, unit_exponent<meters>, unit_exponent<seconds, -2>>;
+    using reversed = base_dimension<unit_exponent<seconds, -2>, unit_exponent<meters>, unit_exponent<grams>>;
+    static_assert(TypeTagHelper<forward, XXHash64>::value().get() == TypeTagHelper<reversed, XXHash64>::value().get());
+    static_assert(TypeTagHelper<forward, FNV_1a_64Bit>::value().get() == TypeTagHelper<reversed, FNV_1a_64Bit>::value().get());
+    static_assert(TypeTagHelper<forward, FNV_1a_32Bit>::value().get() == TypeTagHelper<reversed, FNV_1a_32Bit>::value().get());
+    static_assert(TypeTagHelper<forward, XXHash64>::value().get() != TypeTagHelper<length<meters>, XXHash64>::value().get());
+
+    using TestSerializer = Serializer<forward, DefaultSerializationPolicy<XXHash64>>;
+    const forward obj(25.0);
+    auto buffer = TestSerializer::serialize(obj);
+    EXPECT_EQ(buffer.size(), sizeof(uint64_t) + sizeof(PrecisionType));
+    EXPECT_NEAR((get_dimension_as<unit_exponent<grams>, unit_exponent<meters>, unit_exponent<seconds, -2>>(TestSerializer::deserialize(buffer))), 25.0, TOLERANCE);
+
+    buffer[0] ^= std::uint8_t{1};
+    EXPECT_THROW(static_cast<void>(TestSerializer::deserialize(buffer)), std::invalid_argument);
+}
@@ -0,0 +1,78 @@
+#include "DimensionTest.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace dimension;
+
+namespace
+{
+   using sample = pressure<pascals>;
+   using block = BlockSerializationPolicy<FNV_1a_32Bit>;
+}
+
+TEST(SerializedView, ReadsInPlace) {
+
+   std::vector<sample> samples;
+   for (int i = 0; i < 10; ++i)
+   {
+      samples.emplace_back(100.0 + i);
+   }
+
+   // Heap storage is aligned for any scalar Rep
+   std::vector<std::byte> buffer(block::block_size<sample>(10));
+   serialize_block<sample>(buffer, samples);
+
+   const serialized_view<sample> view(buffer);
+   static_assert(std::ranges::random_access_range<serialized_view<sample>>);
+   static_assert(std::ranges::borrowed_range<serialized_view<sample>>);
+
+   ASSERT_EQ(view.size(), 10u);
+   ASSERT_EQ(view.size_bytes(), buffer.size());
+   ASSERT_EQ(view.block_end(), buffer.data() + buffer.size());
+   ASSERT_NEAR(get_pressure_as<pascals>(view[3]), 103.0, TOLERANCE);
+   ASSERT_NEAR(get_pressure_as<pascals>(view.front()), 100.0, TOLERANCE);
+   ASSERT_NEAR(get_pressure_as<pascals>(view.back()), 109.0, TOLERANCE);
+   ASSERT_NEAR(get_pressure_as<pascals>(view.begin()[9]), 109.0, TOLERANCE);
+   ASSERT_EQ(view.end() - view.begin(), 10);
+   ASSERT_NEAR(get_pressure_as<pascals>(view.at(9)), 109.0, TOLERANCE);
+
+   // Range algorithms see Dim values
+   const auto maximum = std::ranges::max(view, {}, [](const sample& s) { return get_pressure_as<pascals>(s); });
+   ASSERT_NEAR(get_pressure_as<pascals>(maximum), 109.0, TOLERANCE);
+
+   // The header keeps the values aligned, so they are also available as raw Reps
+   ASSERT_TRUE(view.is_aligned());
+   const auto values = view.values();
+   ASSERT_EQ(static_cast<const void*>(values.data()), static_cast<const void*>(buffer.data() + block::header_size));
+   ASSERT_NEAR(std::accumulate(values.begin(), values.end(), 0.0), 1045.0, TOLERANCE);
+}
+
+TEST(SerializedView, Misaligned) {
+
+   const std::array<sample, 3> samples{sample(1.5), sample(2.5), sample(3.5)};
+
+   // Offset the block by one byte so the values are misaligned
+   alignas(double) std::array<std::byte, block::block_size<sample>(3) + 1> buffer{};
+   serialize_block<sample>(std::span(buffer).subspan(1), std::span(samples));
+
+   const serialized_view<sample> view(std::span<const std::byte>(buffer).subspan(1));
+   ASSERT_FALSE(view.is_aligned());
+   ASSERT_THROW(static_cast<void>(view.values()), std::invalid_argument);
+
+   double sum = 0.0;
+   for (const sample s : view)
+   {
+      sum += get_pressure_as<pascals>(s);
+   }
+   ASSERT_NEAR(sum, 7.5, TOLERANCE);
+
+   // The tag is checked once, on construction
+   ASSERT_THROW((serialized_view<length<meters>>(std::span<const std::byte>(buffer).subspan(1))), std::invalid_argument);
+   ASSERT_THROW((serialized_view<sample>(std::span<const std::byte>(buffer).subspan(1, 12))), std::invalid_argument);
+
+   const serialized_view<sample> empty;
+   ASSERT_TRUE(empty.empty());
+   ASSERT_EQ(empty.begin(), empty.end());
+   ASSERT_THROW(static_cast<void>(empty.at(0)), std::out_of_range);
+}
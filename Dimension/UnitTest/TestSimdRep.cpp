@@ -0,0 +1,151 @@
+#include "DimensionTest.h"
+
+#include <array>
+#include <type_traits>
+
+using namespace dimension;
+
+using simd8 = simd_rep<double, 8>;
+
+TEST(SimdRep, LanewiseArithmetic) {
+
+   const std::array<double, 8> a{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+   const std::array<double, 8> b{8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0};
+
+   const simd8 lhs = simd8::load(a.data());
+   const simd8 rhs = simd8::load(b.data());
+
+   const simd8 sum = lhs + rhs;
+   const simd8 scaled = 2.0 * lhs - 1.0;
+   const simd8 quotient = lhs / rhs;
+
+   for (std::size_t i = 0; i < simd8::size(); ++i)
+   {
+      ASSERT_EQ(sum[i], 9.0);
+      ASSERT_EQ(scaled[i], 2.0 * a[i] - 1.0);
+      ASSERT_EQ(quotient[i], a[i] / b[i]);
+   }
+
+   const auto less = lhs < rhs;
+   ASSERT_TRUE(less.any());
+   ASSERT_FALSE(less.all());
+   ASSERT_TRUE(less[3]);
+   ASSERT_FALSE(less[4]);
+
+   const simd8 smallest = select(less, lhs, rhs);
+   ASSERT_EQ(smallest[0], 1.0);
+   ASSERT_EQ(smallest[7], 1.0);
+   ASSERT_EQ(reduce_add(min(lhs, rhs)), reduce_add(smallest));
+
+   std::array<double, 8> out{};
+   sum.store(out.data());
+   ASSERT_EQ(out[5], 9.0);
+}
+
+TEST(SimdRep, MasksReduceExplicitly) {
+
+   // A mask has no bool conversion, since neither reduction keeps != the negation of ==
+   static_assert(!std::is_convertible_v<simd_mask<4>, bool>);
+   static_assert(!std::is_constructible_v<bool, simd_mask<4>>);
+
+   using simd4 = simd_rep<double, 4>;
+   const std::array<double, 4> a{1.0, 2.0, 3.0, 4.0};
+   const std::array<double, 4> b{1.0, 2.0, 3.0, 5.0};
+   const simd4 lhs = simd4::load(a.data());
+   const simd4 rhs = simd4::load(b.data());
+
+   ASSERT_FALSE((lhs == rhs).all());
+   ASSERT_TRUE((lhs != rhs).any());
+   ASSERT_FALSE((lhs != rhs).all());
+   ASSERT_EQ((lhs != rhs).any(), !(lhs == rhs).all());
+   ASSERT_TRUE((lhs == lhs).all());
+   ASSERT_TRUE((lhs != lhs).none());
+
+   // Dimensions over simd_reps compare the same way
+   const length<simd4, meters> distance(lhs);
+   const length<simd4, meters> other(rhs);
+   ASSERT_TRUE((distance != other).any());
+   ASSERT_FALSE((distance == other).all());
+}
+
+TEST(SimdRep, DimensionsOverLanes) {
+
+   const std::array<double, 8> meterValues{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+   const std::array<double, 8> secondValues{2.0, 2.0, 2.0, 2.0, 4.0, 4.0, 4.0, 4.0};
+
+   const auto distances = simd_load<length<simd8, meters>>(meterValues.data());
+   const auto times = simd_load<timespan<simd8, seconds>>(secondValues.data());
+
+   speed<simd8, meters, seconds> speeds = distances / times;
+   static_assert(std::is_same_v<decltype(distances / times)::rep, simd8>);
+   static_assert(is_speed<decltype(speeds)>);
+
+   // Conversions apply the same compile-time factor to every lane
+   const simd8 kph = get_dimension_as<unit_exponent<kilo_meters>, unit_exponent<hours, -1>>(speeds);
+   for (std::size_t i = 0; i < simd8::size(); ++i)
+   {
+      const speed<meters, seconds> scalar(meterValues[i] / secondValues[i]);
+      ASSERT_DOUBLE_EQ(kph[i], (get_dimension_as<unit_exponent<kilo_meters>, unit_exponent<hours, -1>>(scalar)));
+   }
+
+   // Implicit conversion to other units, and mixed-unit arithmetic
+   const speed<simd8, feet, minutes> converted = speeds;
+   const auto doubled = speeds + converted;
+   const simd8 doubledRaw = get_dimension_as<unit_exponent<meters>, unit_exponent<seconds, -1>>(doubled * 0.5);
+   ASSERT_NEAR(doubledRaw[6], 1.75, 1e-12);
+
+   // Comparisons between dimensions yield a lane mask
+   const auto fast = speeds > speed<simd8, meters, seconds>(1.0);
+   ASSERT_FALSE(fast[0]);
+   ASSERT_TRUE(fast[2]);
+
+   // A simd_rep scalar scales each lane separately
+   const simd8 weights = simd8::load(secondValues.data());
+   const auto weighted = distances * weights;
+   static_assert(std::is_same_v<decltype(weighted)::rep, simd8>);
+   ASSERT_EQ((get_dimension_as<unit_exponent<meters>>(weighted)[4]), 20.0);
+}
+
+TEST(SimdRep, MathFunctions) {
+
+   const std::array<double, 4> values{-1.5, -0.25, 0.25, 2.75};
+   using simd4 = simd_rep<double, 4>;
+   const auto lengths = simd_load<length<simd4, meters>>(values.data());
+
+   const simd4 floors = get_dimension_as<unit_exponent<meters>>(floor(lengths));
+   const simd4 ceils = get_dimension_as<unit_exponent<meters>>(ceil(lengths));
+   const simd4 absolutes = get_dimension_as<unit_exponent<meters>>(abs(lengths));
+   const simd4 hypots = get_dimension_as<unit_exponent<meters>>(hypot(lengths, lengths));
+
+   for (std::size_t i = 0; i < values.size(); ++i)
+   {
+      const length<meters> scalar(values[i]);
+      ASSERT_EQ(floors[i], get_length_as<meters>(floor(scalar)));
+      ASSERT_EQ(ceils[i], get_length_as<meters>(ceil(scalar)));
+      ASSERT_EQ(absolutes[i], get_length_as<meters>(abs(scalar)));
+      ASSERT_EQ(hypots[i], get_length_as<meters>(hypot(scalar, scalar)));
+   }
+}
+
+TEST(SimdRep, DimensionArrayLoadStore) {
+
+   dimension_array<length<meters>> metersArr(10);
+   for (std::size_t i = 0; i < metersArr.size(); ++i)
+   {
+      metersArr.data()[i] = static_cast<double>(i);
+   }
+
+   const auto block = simd_load<4>(metersArr, 2);
+   static_assert(std::is_same_v<decltype(block)::rep, simd_rep<double, 4>>);
+   ASSERT_EQ((get_dimension_as<unit_exponent<meters>>(block)[0]), 2.0);
+
+   // Stores convert to the units of the destination array
+   dimension_array<length<feet>> feetArr(10);
+   simd_store(block, feetArr, 6);
+   ASSERT_NEAR(feetArr.data()[6], 2.0 / 0.3048, 1e-12);
+   ASSERT_NEAR(feetArr.data()[9], 5.0 / 0.3048, 1e-12);
+   ASSERT_EQ(feetArr.data()[5], 0.0);
+
+   ASSERT_THROW(static_cast<void>(simd_load<4>(metersArr, 7)), std::out_of_range);
+   ASSERT_THROW(simd_store(block, feetArr, 7), std::out_of_range);
+}
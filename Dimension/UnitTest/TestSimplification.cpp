@@ -1,4 +1,7 @@
 #include "DimensionTest.h"
+#include "TestUtilities.h"
+
+#include <cmath>
 
 using namespace dimension;
 using namespace std;
@@ -100,3 +103,65 @@ TEST(Simplification, Validate_constexpr_behavior) {
    
 }
 
+TEST(Simplification, ConstexprRootAccuracy) {
+
+   using namespace dimension;
+
+   static_assert(Math::RootInt<2>(4.0) == 2.0, "Fail");
+   static_assert(Math::RootInt<3>(27.0) == 3.0, "Fail");
+   static_assert(constexpr_root(-8.0, 3) == -2.0, "Fail");
+
+   for (const double value : {0.3048, 1e-12, 2.0, 3.0, 10.0, 0.0254, 1609.344, 12345.678, 1e30})
+   {
+      ASSERT_LE(UlpDistance(Math::RootInt<2>(value), std::sqrt(value)), 1u) << value;
+      ASSERT_LE(UlpDistance(Math::RootInt<3>(value), std::cbrt(value)), 1u) << value;
+      ASSERT_LE(UlpDistance(Math::RootInt<4>(value), std::sqrt(std::sqrt(value))), 1u) << value;
+      // 0.2 is not exact in double, so the reference is taken in long double
+      const auto fifthRoot = static_cast<double>(std::pow(static_cast<long double>(value), 1.0L / 5.0L));
+      ASSERT_LE(UlpDistance(Math::RootInt<5>(value), fifthRoot), 1u) << value;
+   }
+}
+
+TEST(Simplification, FractionalExponentConversionIsConstexpr) {
+
+   using namespace dimension;
+
+   using from = std::tuple<unit_exponent<meters, 1, 2>>;
+   using to = std::tuple<unit_exponent<feet, 1, 2>>;
+
+   // Usable in a static constexpr constant, with no root left for run time
+   static constexpr double factor = conversion_factor_v<from, to>;
+   static_assert(factor > 1.8113 && factor < 1.8114, "Fail");
+
+   ASSERT_LE(UlpDistance(factor, std::sqrt(1.0 / 0.3048)), 1u);
+
+   constexpr base_dimension<unit_exponent<meters, 1, 2>> rootMeters(4.0);
+   constexpr double asRootFeet = get_dimension_as<unit_exponent<feet, 1, 2>>(rootMeters);
+   static_assert(asRootFeet == 4.0 * factor, "Fail");
+}
+
+TEST(Simplification, CanonicalUnitOrder) {
+
+   using m = unit_exponent<meters>;
+   using g = unit_exponent<grams>;
+   using k = unit_exponent<kelvin, -1>;
+   using s = unit_exponent<seconds, -1>;
+
+   // Sorted by qualified name, "length::meters::1" < "mass::Grams::1" < "temperature::Kelvin::-1" < "timespan::seconds::-1"
+   static_assert(is_same_v<tuple_sort_t<tuple<s, m, g, k>>, tuple<m, g, k, s>>);
+   static_assert(is_same_v<tuple_sort_t<tuple<k, s, g, m>>, tuple<m, g, k, s>>);
+   static_assert(is_same_v<tuple_sort_t<tuple<s, m>>, tuple<m, s>>);
+   static_assert(is_same_v<tuple_sort_t<tuple<m>>, tuple<m>>);
+   static_assert(is_same_v<tuple_sort_t<tuple<>>, tuple<>>);
+
+   // Equal names keep their order
+   static_assert(is_same_v<tuple_sort_t<tuple<s, m, m>>, tuple<m, m, s>>);
+
+   // The older bubble sort gives the same order
+   static_assert(is_same_v<tuple_bubble_sort<tuple<s, m, g, k>>::type, tuple<m, g, k, s>>);
+   static_assert(is_same_v<tuple_bubble_sort<tuple<k, s, g, m>>::type, tuple<m, g, k, s>>);
+   static_assert(is_same_v<tuple_bubble_sort<tuple<s, m, m>>::type, tuple<m, m, s>>);
+   static_assert(is_same_v<tuple_bubble_sort<tuple<m>>::type, tuple<m>>);
+   static_assert(is_same_v<tuple_bubble_sort<tuple<>>::type, tuple<>>);
+   SUCCEED();
+}
@@ -0,0 +1,214 @@
+#include "DimensionTest.h"
+
+#include <array>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace dimension;
+
+TEST(StreamingSerialization, RingBuffer) {
+
+   spsc_ring ring(100);
+   ASSERT_EQ(ring.capacity(), 128u);
+
+   std::array<std::byte, 96> in{};
+   for (std::size_t i = 0; i < in.size(); ++i)
+   {
+      in[i] = static_cast<std::byte>(i);
+   }
+
+   // Writes are all or nothing with try_write, partial with write_some
+   ASSERT_TRUE(ring.try_write(in));
+   ASSERT_FALSE(ring.try_write(in));
+   ASSERT_EQ(ring.write_available(), 32u);
+
+   std::array<std::byte, 64> out{};
+   ASSERT_EQ(ring.read_some(out), 64u);
+   ASSERT_EQ(out[63], std::byte{63});
+
+   // Wrap around the end of the storage
+   ASSERT_EQ(ring.write_some(in), 96u);
+   ASSERT_EQ(ring.read_available(), 128u);
+   ASSERT_EQ(ring.read_some(std::span(out).first(32)), 32u);
+   ASSERT_EQ(out[0], std::byte{64});
+   ASSERT_EQ(ring.read_some(out), 64u);
+   ASSERT_EQ(out[0], std::byte{0});
+   ASSERT_EQ(out[63], std::byte{63});
+
+   // Closing keeps the remaining bytes readable
+   ring.close();
+   ASSERT_TRUE(ring.closed());
+   ASSERT_EQ(ring.read_some(out), 32u);
+   ASSERT_EQ(out[31], std::byte{95});
+   ASSERT_EQ(ring.read_some(out), 0u);
+}
+
+TEST(StreamingSerialization, IoStreams) {
+
+   using sample = pressure<pascals>;
+
+   std::stringstream stream;
+   ostream_sink sink(stream);
+   {
+      stream_writer<sample, ostream_sink> writer(sink, 4);
+      for (int i = 0; i < 10; ++i)
+      {
+         writer.push(sample(static_cast<double>(i)));
+      }
+      ASSERT_EQ(writer.written(), 8u);
+      ASSERT_EQ(writer.pending(), 2u);
+      ASSERT_TRUE(writer.flush());
+      ASSERT_EQ(writer.written(), 10u);
+      ASSERT_EQ(writer.dropped(), 0u);
+
+      // Written on destruction
+      writer.push(sample(10.0));
+   }
+
+   istream_source source(stream);
+   stream_reader<sample, istream_source> reader(source, 4);
+   sample value;
+   ASSERT_TRUE(reader.next(value));
+   ASSERT_EQ(get_pressure_as<pascals>(value), 0.0);
+
+   std::array<sample, 16> rest{};
+   ASSERT_EQ(reader.read(rest), 10u);
+   for (std::size_t i = 0; i < 10; ++i)
+   {
+      ASSERT_EQ(get_pressure_as<pascals>(rest[i]), static_cast<double>(i + 1));
+   }
+   ASSERT_FALSE(reader.next(value));
+
+   // Any block policy can frame the records
+   using portable = PortableSerializationPolicy<FNV_1a_32Bit, std::endian::big>;
+   std::stringstream bigEndian;
+   ostream_sink bigSink(bigEndian);
+   {
+      stream_writer<sample, ostream_sink, portable> writer(bigSink, 2);
+      writer.push(std::array{sample(1.0), sample(2.0), sample(3.0)});
+   }
+   istream_source bigSource(bigEndian);
+   stream_reader<sample, istream_source, portable> bigReader(bigSource, 2);
+   ASSERT_EQ(bigReader.read(rest), 3u);
+   ASSERT_EQ(get_pressure_as<pascals>(rest[2]), 3.0);
+
+   // Coefficient types are framed as raw values and rebuilt from them
+   using kilo = base_dimension<double, unit_exponent<meters>, std::ratio<1000>>;
+   std::stringstream scaled;
+   ostream_sink scaledSink(scaled);
+   {
+      stream_writer<kilo, ostream_sink> writer(scaledSink, 2);
+      writer.push(std::array{kilo(2.0), kilo(-0.5), kilo(4.0)});
+   }
+   istream_source scaledSource(scaled);
+   stream_reader<kilo, istream_source> scaledReader(scaledSource, 2);
+   std::array<kilo, 4> kilos{};
+   ASSERT_EQ(scaledReader.read(kilos), 3u);
+   ASSERT_NEAR((get_dimension_as<unit_exponent<meters>>(kilos[0])), 2000.0, TOLERANCE);
+   ASSERT_NEAR((get_dimension_as<unit_exponent<meters>>(kilos[1])), -500.0, TOLERANCE);
+   ASSERT_NEAR((get_dimension_as<unit_exponent<meters>>(kilos[2])), 4000.0, TOLERANCE);
+}
+
+TEST(StreamingSerialization, Errors) {
+
+   using sample = length<meters>;
+
+   std::stringstream stream;
+   ostream_sink sink(stream);
+   {
+      stream_writer<sample, ostream_sink> writer(sink, 8);
+      writer.push(std::array{sample(1.0), sample(2.0), sample(3.0)});
+   }
+   const std::string bytes = stream.str();
+
+   // A frame larger than the reader accepts
+   std::istringstream large(bytes);
+   istream_source largeSource(large);
+   stream_reader<sample, istream_source> smallReader(largeSource, 2);
+   sample value;
+   ASSERT_THROW(smallReader.next(value), std::runtime_error);
+
+   // A stream ending in the middle of a frame
+   std::istringstream truncated(bytes.substr(0, bytes.size() - 3));
+   istream_source truncatedSource(truncated);
+   stream_reader<sample, istream_source> reader(truncatedSource);
+   ASSERT_THROW(reader.next(value), std::runtime_error);
+
+   // Records of another type
+   std::istringstream other(bytes);
+   istream_source otherSource(other);
+   stream_reader<timespan<seconds>, istream_source> otherReader(otherSource);
+   timespan<seconds> otherValue;
+   ASSERT_THROW(otherReader.next(otherValue), std::invalid_argument);
+
+   ASSERT_THROW((stream_writer<sample, ostream_sink>(sink, 0)), std::invalid_argument);
+}
+
+TEST(StreamingSerialization, ThreadHandoff) {
+
+   using sample = length<meters>;
+   constexpr std::size_t records = 200000;
+
+   // The ring holds only a few batches, so the producer has to wait for the consumer
+   spsc_ring ring(16384);
+   double total = 0.0;
+   std::size_t received = 0;
+   bool ordered = true;
+
+   std::thread consumer([&]
+   {
+      ring_source source(ring);
+      stream_reader<sample, ring_source> reader(source, 256);
+      sample value;
+      while (reader.next(value))
+      {
+         const double distance = get_length_as<meters>(value);
+         ordered = ordered && distance == static_cast<double>(received);
+         total += distance;
+         ++received;
+      }
+   });
+
+   ring_sink sink(ring, backpressure::block);
+   {
+      stream_writer<sample, ring_sink> writer(sink, 256);
+      for (std::size_t i = 0; i < records; ++i)
+      {
+         writer.push(sample(static_cast<double>(i)));
+      }
+      ASSERT_TRUE(writer.flush());
+      ASSERT_EQ(writer.written(), records);
+   }
+   sink.close();
+   consumer.join();
+
+   ASSERT_EQ(received, records);
+   ASSERT_TRUE(ordered);
+   ASSERT_EQ(total, static_cast<double>(records) * static_cast<double>(records - 1) / 2.0);
+}
+
+TEST(StreamingSerialization, DropUnderBackpressure) {
+
+   using sample = length<meters>;
+   using writer_type = stream_writer<sample, ring_sink>;
+
+   // Room for one frame of 16 records, and no consumer yet
+   spsc_ring ring(256);
+   ring_sink sink(ring, backpressure::drop);
+   writer_type writer(sink, 16);
+   for (std::size_t i = 0; i < 48; ++i)
+   {
+      writer.push(sample(static_cast<double>(i)));
+   }
+   ASSERT_EQ(writer.written(), 16u);
+   ASSERT_EQ(writer.dropped(), 32u);
+   sink.close();
+
+   // Only whole batches are dropped, so the stream stays readable
+   ring_source source(ring);
+   stream_reader<sample, ring_source> reader(source, 16);
+   std::array<sample, 48> values{};
+   ASSERT_EQ(reader.read(values), 16u);
+   ASSERT_EQ(get_length_as<meters>(values[15]), 15.0);
+}
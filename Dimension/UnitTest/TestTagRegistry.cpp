@@ -0,0 +1,137 @@
+#include "DimensionTest.h"
+
+#include <vector>
+
+using namespace dimension;
+
+namespace
+{
+   using registry = tag_registry<FNV_1a_32Bit, force<newtons>, pressure<pascals>, temperature<kelvin>>;
+
+   /// @brief Append one record, as written by serialize, to a stream
+   template<is_base_dimension Dim>
+   void append(std::vector<std::byte>& stream, const Dim& obj)
+   {
+      const auto record = serialize(obj);
+      const auto* bytes = reinterpret_cast<const std::byte*>(record.data());
+      stream.insert(stream.end(), bytes, bytes + record.size());
+   }
+
+   struct counting_visitor
+   {
+      double forces = 0.0;
+      double pressures = 0.0;
+      double temperatures = 0.0;
+      int unknown = 0;
+
+      void operator()(const force<newtons>& f) { forces += get_force_as<newtons>(f); }
+      void operator()(const pressure<pascals>& p) { pressures += get_pressure_as<pascals>(p); }
+      void operator()(const temperature<kelvin>& t) { temperatures += get_temperature_as<kelvin>(t); }
+      void operator()(const unknown_record&) { ++unknown; }
+   };
+}
+
+TEST(TagRegistry, DispatchesByTag) {
+
+   static_assert(registry::size() == 3);
+   static_assert(registry::record_size == sizeof(uint32_t) + sizeof(PrecisionType));
+   static_assert(registry::find(TypeTagHelper<pressure<pascals>, FNV_1a_32Bit>::value().get()) == 1);
+   static_assert(registry::find(TypeTagHelper<length<meters>, FNV_1a_32Bit>::value().get()) == registry::size());
+   static_assert(std::is_same_v<registry::dimension_type<2>, temperature<kelvin>>);
+
+   std::vector<std::byte> stream;
+   append(stream, force<newtons>(2.0));
+   append(stream, pressure<pascals>(100.0));
+   append(stream, temperature<kelvin>(300.0));
+   append(stream, length<meters>(5.0));
+   append(stream, force<newtons>(3.0));
+
+   counting_visitor visitor;
+   ASSERT_EQ(registry::dispatch_all(stream, visitor), 5u);
+   ASSERT_NEAR(visitor.forces, 5.0, TOLERANCE);
+   ASSERT_NEAR(visitor.pressures, 100.0, TOLERANCE);
+   ASSERT_NEAR(visitor.temperatures, 300.0, TOLERANCE);
+   ASSERT_EQ(visitor.unknown, 1);
+
+   // A single record
+   counting_visitor single;
+   registry::dispatch(std::span(stream).subspan(registry::record_size, registry::record_size), single);
+   ASSERT_NEAR(single.pressures, 100.0, TOLERANCE);
+
+   ASSERT_THROW(registry::dispatch_all(std::span(stream).first(stream.size() - 1), visitor), std::invalid_argument);
+   ASSERT_THROW(registry::dispatch(std::span(stream).first(4), visitor), std::invalid_argument);
+}
+
+TEST(TagRegistry, DynamicFallback) {
+
+   std::vector<std::byte> stream;
+   append(stream, pressure<pascals>(101325.0));
+   append(stream, temperature<kelvin>(273.15));
+
+   // Types without a typed handler arrive as a dynamic_quantity
+   struct pressure_visitor
+   {
+      double atmospheres = 0.0;
+      int generic = 0;
+
+      void operator()(const pressure<pascals>& p) { atmospheres += get_pressure_as<pascals>(p) / 101325.0; }
+      void operator()(const dynamic_quantity& q) { generic += has_dimensions_of<temperature<kelvin>>(q) ? 1 : 0; }
+   };
+
+   pressure_visitor visitor;
+   ASSERT_EQ(registry::dispatch_all(stream, visitor), 2u);
+   ASSERT_NEAR(visitor.atmospheres, 1.0, TOLERANCE);
+   ASSERT_EQ(visitor.generic, 1);
+
+   // Without a handler for unknown records, unknown tags throw
+   append(stream, length<meters>(1.0));
+   const auto strict = [](const dynamic_quantity&) {};
+   ASSERT_THROW(registry::dispatch_all(stream, strict), std::invalid_argument);
+}
+
+TEST(TagRegistry, GroupedDispatch) {
+
+   // More than one batch, with types and unknown records interleaved
+   std::vector<std::byte> stream;
+   const std::size_t count = registry::group_size * 2 + 17;
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      switch (i % 4)
+      {
+         case 0: append(stream, force<newtons>(static_cast<double>(i))); break;
+         case 1: append(stream, pressure<pascals>(static_cast<double>(i))); break;
+         case 2: append(stream, temperature<kelvin>(static_cast<double>(i))); break;
+         default: append(stream, length<meters>(static_cast<double>(i))); break;
+      }
+   }
+
+   struct ordered_visitor
+   {
+      std::vector<double> forces;
+      std::vector<double> pressures;
+      std::size_t temperatures = 0;
+      std::size_t unknown = 0;
+
+      void operator()(const force<newtons>& f) { forces.push_back(get_force_as<newtons>(f)); }
+      void operator()(const pressure<pascals>& p) { pressures.push_back(get_pressure_as<pascals>(p)); }
+      void operator()(const temperature<kelvin>&) { ++temperatures; }
+      void operator()(const unknown_record&) { ++unknown; }
+   };
+
+   ordered_visitor visitor;
+   ASSERT_EQ(registry::dispatch_grouped(stream, visitor), count);
+   ASSERT_EQ(visitor.forces.size() + visitor.pressures.size() + visitor.temperatures + visitor.unknown, count);
+   ASSERT_EQ(visitor.unknown, count / 4);
+
+   // Records of one type keep their stream order
+   for (std::size_t i = 0; i < visitor.forces.size(); ++i)
+   {
+      ASSERT_NEAR(visitor.forces[i], static_cast<double>(i * 4), TOLERANCE);
+   }
+   for (std::size_t i = 0; i < visitor.pressures.size(); ++i)
+   {
+      ASSERT_NEAR(visitor.pressures[i], static_cast<double>(i * 4 + 1), TOLERANCE);
+   }
+
+   ASSERT_THROW(registry::dispatch_grouped(std::span(stream).first(stream.size() - 1), visitor), std::invalid_argument);
+}
@@ -1,6 +1,10 @@
 #include "DimensionTest.h"
+#include "TestUtilities.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
 
 using namespace dimension;
 using dimension::cos;
@@ -110,3 +114,76 @@ TEST(TrigFunctions, HypotTest) {
    ASSERT_NEAR(get_length_as<meters>((hypot(length<meters>(1e10), length<meters>(1.0)))), 1e10, TOLERANCE);
    
 }
+
+TEST(TrigFunctions, BatchedSinCos) {
+
+   dimension_array<angle<degrees>> angles(3891);
+   for (std::size_t i = 0; i < angles.size(); ++i)
+   {
+      angles.data()[i] = -720.0 + 0.37 * static_cast<double>(i);
+   }
+
+   const auto [sines, cosines] = sincos(angles);
+   const auto sinesOnly = sin(angles);
+   const auto cosinesOnly = cos(angles);
+
+   for (std::size_t i = 0; i < angles.size(); ++i)
+   {
+      // Reference at long double precision, on the same radian argument the kernel sees
+      const auto x = static_cast<long double>(angles.data()[i] * radians_factor_v<angle<degrees>>);
+      ASSERT_LE(UlpDistance(sines[i], static_cast<double>(std::sin(x))), 3u) << angles.data()[i];
+      ASSERT_LE(UlpDistance(cosines[i], static_cast<double>(std::cos(x))), 3u) << angles.data()[i];
+      ASSERT_EQ(sines[i], sinesOnly[i]);
+      ASSERT_EQ(cosines[i], cosinesOnly[i]);
+      ASSERT_NEAR(sines[i], sin(angles[i]), 1e-15);
+   }
+
+   // Raw spans at float precision, with arguments outside the reduction range
+   std::vector<float> radiansIn{0.5f, -2.0f, 1.0e6f, 3.0e4f};
+   std::vector<float> sinOut(radiansIn.size());
+   std::vector<float> cosOut(radiansIn.size());
+   sincos<radians>(radiansIn, sinOut, cosOut);
+
+   ASSERT_FLOAT_EQ(sinOut[0], std::sin(0.5f));
+   ASSERT_FLOAT_EQ(cosOut[1], std::cos(-2.0f));
+   ASSERT_EQ(sinOut[2], std::sin(1.0e6f));
+   ASSERT_NEAR(cosOut[3], std::cos(3.0e4f), 1e-6f);
+
+   // NaN and infinity pass through libm
+   std::vector<double> special{std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity(),
+                               -std::numeric_limits<double>::infinity(), 1.0e300, 1.0};
+   std::vector<double> specialSin(special.size());
+   std::vector<double> specialCos(special.size());
+   sincos<radians>(special, specialSin, specialCos);
+   for (std::size_t i = 0; i < 3; ++i)
+   {
+      ASSERT_TRUE(std::isnan(specialSin[i]));
+      ASSERT_TRUE(std::isnan(specialCos[i]));
+   }
+   ASSERT_EQ(specialSin[3], std::sin(1.0e300));
+   ASSERT_EQ(specialCos[3], std::cos(1.0e300));
+   ASSERT_DOUBLE_EQ(specialSin[4], std::sin(1.0));
+
+   std::vector<float> tooSmall(2);
+   ASSERT_THROW(sincos<radians>(radiansIn, tooSmall, cosOut), std::invalid_argument);
+}
+
+TEST(TrigFunctions, BatchedAtan2) {
+
+   dimension_array<length<meters>> y{length<meters>(1.0), length<meters>(-3.0), length<meters>(0.0), length<meters>(-2.0), length<meters>(0.0)};
+   dimension_array<length<feet>> x{length<feet>(1.0), length<feet>(-10.0), length<feet>(-4.0), length<feet>(0.0), length<feet>(0.0)};
+
+   const dimension_array<angle<radians>> angles = atan2(y, x);
+   ASSERT_EQ(angles.size(), y.size());
+
+   for (std::size_t i = 0; i < angles.size(); ++i)
+   {
+      const auto xMeters = static_cast<long double>(x.data()[i] * 0.3048);
+      const auto expected = static_cast<double>(std::atan2(static_cast<long double>(y.data()[i]), xMeters));
+      ASSERT_LE(UlpDistance(angles.data()[i], expected), 2u) << i;
+      ASSERT_NEAR(get_angle_as<radians>(angles[i]), get_angle_as<radians>(dimension::atan2(y[i], length<meters>(x[i]))), 1e-15);
+   }
+
+   dimension_array<length<meters>> tooShort{length<meters>(1.0)};
+   ASSERT_THROW(static_cast<void>(atan2(tooShort, x)), std::invalid_argument);
+}
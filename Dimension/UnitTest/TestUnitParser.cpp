@@ -0,0 +1,71 @@
+#include "DimensionTest.h"
+
+using namespace dimension;
+
+TEST(UnitParser, SymbolTable) {
+
+   // Every unit and SI prefixed unit has its own symbol
+   static_assert(unit_symbols.size() == std::tuple_size_v<parseable_units> + 12 * std::tuple_size_v<si_prefixed_units>);
+   static_assert(unit_symbols.find("km") != nullptr);
+   static_assert(unit_symbols.find("kmm") == nullptr);
+
+   static_assert(unit_symbols.find("km")->scale == 1000.0);
+   static_assert(unit_symbols.find("ms")->scale == 1e-3);
+   static_assert(unit_symbols.find("kg")->scale == 1000.0);
+   static_assert(unit_symbols.find("min")->scale == 60.0);
+   static_assert(unit_symbols.find("h")->signature == dimension_signature::of("timespan", 1));
+   static_assert(unit_symbols.find("ft")->signature == dimension_signature::of("length", 1));
+   static_assert(unit_symbols.find("hm")->signature == dimension_signature::of("length", 1));
+   ASSERT_EQ(unit_symbols.find(""), nullptr);
+   ASSERT_EQ(unit_symbols.find("xyz"), nullptr);
+   ASSERT_EQ(unit_symbols.find("DataMilesDataMilesDataMiles"), nullptr);
+}
+
+TEST(UnitParser, StaticTypes) {
+
+   ASSERT_NEAR((get_speed_as<meters, seconds>(parse<speed<meters, seconds>>("12.5 km/h"))), 12.5 / 3.6, 1e-12);
+   ASSERT_NEAR(get_area_as<meters>(parse<area<meters>>("3 ft^2")), 3.0 * 0.3048 * 0.3048, 1e-12);
+   ASSERT_NEAR(get_length_as<feet>(parse<length<feet>>("  -1.5e3 m ")), -1500.0 / 0.3048, 1e-9);
+   ASSERT_NEAR(get_timespan_as<seconds>(parse<timespan<seconds>>("90min")), 5400.0, 1e-9);
+
+   // Products, quotients, negative exponents and the middle dot
+   ASSERT_NEAR(get_force_as<newtons>(parse<force<newtons>>("2 kg*m/s^2")), 2.0, 1e-12);
+   ASSERT_NEAR(get_force_as<newtons>(parse<force<newtons>>("2 kg.m.s^-2")), 2.0, 1e-12);
+   ASSERT_NEAR(get_force_as<newtons>(parse<force<newtons>>("2 kg·m/s/s")), 2.0, 1e-12);
+
+   // The dimensions are checked
+   ASSERT_THROW(static_cast<void>(parse<length<meters>>("4 s")), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(parse<length<meters>>("four m")), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(parse<length<meters>>("4 parsecs")), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(parse<area<meters>>("4 m^")), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(parse<area<meters>>("4 m^22")), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(parse<speed<meters, seconds>>("4 m/")), std::invalid_argument);
+   ASSERT_THROW(static_cast<void>(parse<speed<meters, seconds>>("4 m s")), std::invalid_argument);
+}
+
+TEST(UnitParser, RuntimeQuantities) {
+
+   const auto atmosphere = parse_quantity("101.325 kg/m/s^2");
+   ASSERT_EQ(atmosphere.signature(), dimension_signature_v<pressure<pascals>>);
+   ASSERT_NEAR(atmosphere.value(), 101.325, 1e-12);
+
+   // No units is a dimensionless value
+   ASSERT_TRUE(parse_quantity("0.5").signature().dimensionless());
+
+   // Units alone give the scale of one of them
+   const auto knots = parse_unit("nmi/h");
+   ASSERT_NEAR(knots.primary_value(), 1852.0 / 3600.0, 1e-12);
+
+   // try_parse reports failures without throwing
+   parse_errc error = parse_errc::ok;
+   ASSERT_TRUE(try_parse<length<meters>>("3 ft", error).has_value());
+   ASSERT_EQ(error, parse_errc::ok);
+   ASSERT_FALSE(try_parse<length<meters>>("3 ft/s", error).has_value());
+   ASSERT_EQ(error, parse_errc::dimension_mismatch);
+   ASSERT_FALSE(try_parse<length<meters>>("3 furlongs", error).has_value());
+   ASSERT_EQ(error, parse_errc::unknown_unit);
+   ASSERT_FALSE(try_parse<length<meters>>("m", error).has_value());
+   ASSERT_EQ(error, parse_errc::invalid_number);
+   ASSERT_FALSE(try_parse<length<meters>>("1 m^9*m^9*m^9", error).has_value());
+   ASSERT_EQ(error, parse_errc::invalid_exponent);
+}
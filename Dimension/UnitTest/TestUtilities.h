@@ -3,6 +3,15 @@
 
 #include "DimensionTest.h"
 
-class UtilitiesTest : public DimensionTest {};
+#include <bit>
+#include <cstdint>
+
+/// @brief Distance in units of least precision between two doubles of the same sign
+inline std::uint64_t UlpDistance(double a, double b)
+{
+   const auto ia = std::bit_cast<std::uint64_t>(a);
+   const auto ib = std::bit_cast<std::uint64_t>(b);
+   return ia > ib ? ia - ib : ib - ia;
+}
 
 #endif // TEST_UTILITIES_H
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "DimensionTest.h"
+
+using namespace dimension;
+
+TEST(Vec, ConstructionAndConversion) {
+
+   // Components in other units are converted to the units of the vector
+   constexpr vec3<length<meters>> position{length<meters>(1.0), length<feet>(10.0), length<meters>(-2.0)};
+   ASSERT_NEAR(get_length_as<meters>(position[1]), 3.048, TOLERANCE);
+   ASSERT_NEAR(position.raw()[2], -2.0, TOLERANCE);
+
+   const vec3<length<feet>> inFeet = position;
+   ASSERT_NEAR(get_length_as<feet>(inFeet[0]), 1.0 / 0.3048, TOLERANCE);
+
+   // Addition converts the right hand side to the units of the left
+   const auto total = position + inFeet;
+   static_assert(std::is_same_v<std::remove_cv_t<decltype(total)>, vec3<length<meters>>>);
+   ASSERT_NEAR(get_length_as<meters>(total[1]), 6.096, TOLERANCE);
+   ASSERT_TRUE(total - inFeet == position);
+
+   const auto scaled = -2.0 * position / 4.0;
+   ASSERT_NEAR(get_length_as<meters>(scaled[0]), -0.5, TOLERANCE);
+   ASSERT_NEAR(get_length_as<meters>(scaled[2]), 1.0, TOLERANCE);
+
+   // Packed for arrays of 3-vectors, aligned to the full width for power of two sizes
+   static_assert(sizeof(vec3<length<meters>>) == 3 * sizeof(double));
+   static_assert(alignof(vec4<length<meters>>) == alignof(simd_rep<double, 4>));
+}
+
+TEST(Vec, DotAndCrossUnits) {
+
+   const vec3<speed<meters, seconds>> velocity{speed<meters, seconds>(3.0), speed<meters, seconds>(0.0), speed<meters, seconds>(4.0)};
+
+   // v . v is a squared speed
+   const auto squared = dot(velocity, velocity);
+   using squared_speed = base_dimension<unit_exponent<meters, 2>, unit_exponent<seconds, -2>>;
+   static_assert(matching_dimensions<std::remove_cv_t<decltype(squared)>, squared_speed>);
+   ASSERT_NEAR((get_dimension_as<unit_exponent<meters, 2>, unit_exponent<seconds, -2>>(squared)), 25.0, TOLERANCE);
+
+   const vec3<length<meters>> r{length<meters>(0.0), length<meters>(2.0), length<meters>(0.0)};
+   const vec3<force<newtons>> f{force<newtons>(5.0), force<newtons>(0.0), force<newtons>(1.0)};
+
+   // F . d is an energy
+   const auto work = dot(f, r + vec3<length<meters>>{length<meters>(1.0), length<meters>(0.0), length<meters>(0.0)});
+   static_assert(matching_dimensions<std::remove_cv_t<decltype(work)>, energy<joules>>);
+   ASSERT_NEAR(get_energy_as<joules>(energy<joules>(work)), 5.0, TOLERANCE);
+
+   // r x F has the units of energy, per radian it is a torque
+   const auto moment = cross(r, f);
+   ASSERT_NEAR(get_energy_as<joules>(energy<joules>(moment[0])), 2.0, TOLERANCE);
+   ASSERT_NEAR(get_energy_as<joules>(energy<joules>(moment[1])), 0.0, TOLERANCE);
+   ASSERT_NEAR(get_energy_as<joules>(energy<joules>(moment[2])), -10.0, TOLERANCE);
+
+   const auto torqueVec = moment / angle<radians>(1.0);
+   using torque_type = std::remove_cv_t<decltype(torqueVec[2])>;
+   static_assert(is_torque<torque_type>);
+   ASSERT_NEAR((get_torque_as<kilo_grams, meters, seconds, radians>(torqueVec[2])), -10.0, TOLERANCE);
+
+   // Mixed units are converted through the product units
+   const vec3<length<feet>> rFeet = r;
+   ASSERT_NEAR(get_energy_as<joules>(energy<joules>(cross(rFeet, f)[2])), -10.0, TOLERANCE);
+}
+
+TEST(Vec, NormNormalizeAndScale) {
+
+   const vec2<length<feet>> side{length<feet>(3.0), length<feet>(4.0)};
+   static_assert(std::is_same_v<decltype(norm(side)), length<feet>>);
+   ASSERT_NEAR(get_length_as<feet>(norm(side)), 5.0, TOLERANCE);
+
+   const auto direction = normalize(side);
+   ASSERT_NEAR(direction.raw()[0], 0.6, TOLERANCE);
+   ASSERT_NEAR(direction.raw()[1], 0.8, TOLERANCE);
+
+   // Scaling by a dimension gives a vector of the product dimension
+   const auto displacement = length<meters>(10.0) * direction;
+   ASSERT_NEAR(get_length_as<meters>(length<meters>(displacement[1])), 8.0, TOLERANCE);
+
+   const auto velocity = side / timespan<seconds>(2.0);
+   ASSERT_NEAR((get_speed_as<feet, seconds>(velocity[0])), 1.5, TOLERANCE);
+
+   const auto momentum = mass<kilo_grams>(2.0) * velocity;
+   ASSERT_NEAR(momentum.raw()[1], 4.0, TOLERANCE);
+}
@@ -20,6 +20,25 @@ set(TEST_SOURCES
     ${CMAKE_CURRENT_LIST_DIR}/TestSymbols.cpp
     ${CMAKE_CURRENT_LIST_DIR}/PhysicsProblemsExamples/Example1.cpp
     ${CMAKE_CURRENT_LIST_DIR}/TestSerialization.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestDimensionArray.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestBatchConversion.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestArrayExpression.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestSimdRep.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestRepPreservation.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestReductions.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestVec.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestDimensionMatrix.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestExactConversion.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestCompactQuantity.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestDynamicQuantity.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestUnitParser.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestFormat.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestSerializedView.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestColumnFile.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestTagRegistry.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestConvertibleSerialization.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestPortableSerialization.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/TestStreamingSerialization.cpp
 
     #${CMAKE_CURRENT_LIST_DIR}/TestNewDimension.cpp
 
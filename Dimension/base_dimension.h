@@ -16,6 +16,7 @@
 #include "Dimension_Core/UnitSimplifier.h"
 #include "Dimension_Core/FundamentalUnitExtractor.h"
 #include "Dimension_Core/Conversion.h"
+#include "Dimension_Core/ExactConversion.h"
 #include "Dimension_Core/SI_Macro.h"
 #include "Dimension_Core/Hashing.h"
 #include "Dimension_Core/StringLiteral.h"
@@ -23,8 +24,23 @@
 #include "Dimension_Core/Serialization.h"
 #include "Dimension_Core/base_dimension_signature.h"
 #include "Dimension_Core/Coefficient.h"
+#include "Dimension_Core/RepTraits.h"
 
 #include "Dimension_Core/Point.h"
+#include "Dimension_Core/DimensionArray.h"
+#include "Dimension_Core/SimdRep.h"
+#include "Dimension_Core/TrigKernels.h"
+#include "Dimension_Core/Reductions.h"
+#include "Dimension_Core/Vec.h"
+#include "Dimension_Core/DimensionMatrix.h"
+#include "Dimension_Core/CompactQuantity.h"
+#include "Dimension_Core/DynamicQuantity.h"
+#include "Dimension_Core/UnitParser.h"
+#include "Dimension_Core/SerializedView.h"
+#include "Dimension_Core/TagRegistry.h"
+#include "Dimension_Core/ConvertibleSerialization.h"
+#include "Dimension_Core/PortableSerialization.h"
+#include "Dimension_Core/StreamingSerialization.h"
 
 namespace dimension
 {
@@ -76,9 +92,20 @@ namespace dimension
    requires (matching_dimensions<base_dimension_impl<double, Units...>, Dim> && !same_units<std::tuple<Units...>, typename Dim::units>)
    constexpr Dim::rep get_dimension_as(Dim obj)
    {
-      return ConvertDim<typename Dim::units, std::tuple<Units...>>::Convert(
-         call_unpack<typename Dim::units>([&]<typename... OrigUnits> { return get_dimension_as<OrigUnits...>(static_cast<const base_dimension_impl<double, OrigUnits...>&>(obj)); })
-      );
+      using target = base_dimension_impl<typename Dim::rep, Units...>;
+
+      if constexpr (std::is_integral_v<typename Dim::rep> && has_exact_factor_v<Dim, target>)
+      {
+         // Integral values with an exact factor never pass through floating point
+         return convert_raw<target, rounding::toward_zero, overflow::unchecked, Dim>(obj.template get_tuple_scalar<typename Dim::units>());
+      }
+      else
+      {
+         // Coefficients and unit conversion are folded into one compile-time factor
+         constexpr PrecisionType factor = coefficient_factor_v<Dim> * conversion_factor_v<typename Dim::units, std::tuple<Units...>>;
+
+         return rep_traits<typename Dim::rep>::scale(obj.template get_tuple_scalar<typename Dim::units>(), factor);
+      }
    }
    
    template<are_unit_exponents... Units, typename Dim>
@@ -88,8 +115,8 @@ namespace dimension
       return obj.template get<Units...>();
    }
 
-   template<typename UnitTuple>
-   constexpr PrecisionType get_dimension_tuple(typename base_dimensionFromTuple<UnitTuple>::dim obj)
+   template<typename UnitTuple, typename Dim>
+   constexpr Dim::rep get_dimension_tuple(const Dim& obj)
    {
       return call_unpack<UnitTuple>([&]<typename... Units> { return get_dimension_as<Units...>(obj); });
    }
@@ -98,9 +125,9 @@ namespace dimension
    requires (matching_dimensions<base_dimension_impl<double, Units...>, Dim> && !same_units<std::tuple<Units...>, typename Dim::units>)
    constexpr Dim::rep get_scalar_as(Dim obj)
    {
-      return ConvertDim<typename Dim::units, std::tuple<Units...>>::Convert(
-         call_unpack<typename Dim::units>([&]<typename... OrigUnits> { return get_scalar_as<OrigUnits...>(static_cast<const base_dimension_impl<double, OrigUnits...>&>(obj)); })
-      );
+      constexpr PrecisionType factor = conversion_factor_v<typename Dim::units, std::tuple<Units...>>;
+
+      return rep_traits<typename Dim::rep>::scale(obj.template get_tuple_scalar<typename Dim::units>(), factor);
    }
    
    template<are_unit_exponents... Units, typename Dim>
@@ -111,7 +138,7 @@ namespace dimension
    }
 
    template<typename UnitTuple, typename Dim>
-   constexpr PrecisionType get_scalar_tuple(Dim obj)
+   constexpr Dim::rep get_scalar_tuple(Dim obj)
    {
       return call_unpack<typename Dim::units>([&]<typename... Units> { return get_scalar_as<Units...>(obj); });
    }
@@ -191,7 +218,7 @@ namespace dimension
       /// @brief Cast to double operator overload for Scalar types
       /// @details Cast the dimension to a double if unitless (i.e. scalar type) 
       template<typename U = simplified>
-      requires (std::tuple_size_v<U> == 0)
+      requires (std::tuple_size_v<U> == 0 && std::is_convertible_v<Rep, double>)
       constexpr operator double() const
       {
          return scalar;
@@ -232,18 +259,27 @@ namespace dimension
       }
 
       /// @brief *= operator overload for a scalar
+      /// @details Floating-point Reps are scaled at their own precision
       /// @param[in] rhs scalar value to multiply by
       constexpr base_dimension_impl<Rep, Ts...>& operator*=(PrecisionType rhs)
       {
-         scalar *= rhs;
+         scalar = rep_traits<Rep>::scale(scalar, rhs);
          return *this;
       }
 
       /// @brief /= operator overload for a scalar
+      /// @details Floating-point Reps are divided at their own precision
       /// @param[in] rhs scalar value to divide by
       constexpr base_dimension_impl<Rep, Ts...>& operator/=(PrecisionType rhs)
       {
-         scalar /= rhs;
+         if constexpr (std::is_integral_v<Rep>)
+         {
+            scalar = static_cast<Rep>(static_cast<PrecisionType>(scalar) / rhs);
+         }
+         else
+         {
+            scalar /= static_cast<Rep>(rhs);
+         }
          return *this;
       }
       
@@ -255,38 +291,38 @@ namespace dimension
 
       template<typename... Units2>
       requires matching_dimensions<base_dimension_impl<Rep, Ts...>, base_dimension_impl<Rep, Units2...>>
-      constexpr bool operator<(const base_dimension_impl<Rep, Units2...>& rhs) const {
+      constexpr auto operator<(const base_dimension_impl<Rep, Units2...>& rhs) const {
          return scalar < get_dimension_as<Ts...>(rhs);
       }
 
       template<typename... Units2>
       requires matching_dimensions<base_dimension_impl<Rep, Ts...>, base_dimension_impl<Rep, Units2...>>
-      constexpr bool operator>(const base_dimension_impl<Rep, Units2...>& rhs) const {
+      constexpr auto operator>(const base_dimension_impl<Rep, Units2...>& rhs) const {
          return scalar > get_dimension_as<Ts...>(rhs);
       }
 
       template<typename... Units2>
       requires matching_dimensions<base_dimension_impl<Rep, Ts...>, base_dimension_impl<Rep, Units2...>>
-      constexpr bool operator<=(const base_dimension_impl<Rep, Units2...>& rhs) const {
+      constexpr auto operator<=(const base_dimension_impl<Rep, Units2...>& rhs) const {
          return scalar <= get_dimension_as<Ts...>(rhs);
       }
 
       template<typename... Units2>
       requires matching_dimensions<base_dimension_impl<Rep, Ts...>, base_dimension_impl<Rep, Units2...>>
-      constexpr bool operator>=(const base_dimension_impl<Rep, Units2...>& rhs) const {
+      constexpr auto operator>=(const base_dimension_impl<Rep, Units2...>& rhs) const {
          return scalar >= get_dimension_as<Ts...>(rhs);
       }
 
       template<typename... Units2>
       requires matching_dimensions<base_dimension_impl<Rep, Ts...>, base_dimension_impl<Rep, Units2...>>
-      constexpr bool operator==(const base_dimension_impl<Rep, Units2...>& rhs) const {
+      constexpr auto operator==(const base_dimension_impl<Rep, Units2...>& rhs) const {
          return scalar == get_dimension_as<Ts...>(rhs);
       }
 
       template<typename... Units2>
       requires matching_dimensions<base_dimension_impl<Rep, Ts...>, base_dimension_impl<Rep, Units2...>>
-      constexpr bool operator!=(const base_dimension_impl<Rep, Units2...>& rhs) const {
-         return !(*this == rhs);
+      constexpr auto operator!=(const base_dimension_impl<Rep, Units2...>& rhs) const {
+         return scalar != get_dimension_as<Ts...>(rhs);
       }
 
       template<typename... Units2>
@@ -296,9 +332,16 @@ namespace dimension
             "get is an implementation detail of Dimensional and is not meant to be called externally! Prefer get_dimension_as. When using get directly, template parameter units must exactly match units of the object."
          );
 
-         return static_cast<Rep>(scalar *
-                                 ratio_value<ratio>() * 
-                                 eval_symbol_tuple<symbols>());
+         // Coefficients are folded into one factor, applied at the precision of Rep
+         constexpr PrecisionType factor = coefficient_factor_v<base_dimension_impl>;
+         if constexpr (factor == PrecisionType{1})
+         {
+            return scalar;
+         }
+         else
+         {
+            return rep_traits<Rep>::scale(scalar, factor);
+         }
       }
 
       template<typename... Units2>
@@ -449,38 +492,42 @@ namespace dimension
    }
  
    // Scalar Math
+   // Scalars may be arithmetic or a simd_rep, see scaled_rep_t for the Rep of the result
 
    // Multiply base_dimension * scalar
-   template<typename Lhs>
-   constexpr auto operator*(const Lhs& lhs, double scalar)
+   template<is_base_dimension Lhs, scalar_operand Scalar>
+   constexpr auto operator*(const Lhs& lhs, const Scalar& scalar)
    {
-      return typename base_dimensionFromTuple<typename Lhs::units>::dim(
-         call_unpack<typename Lhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(lhs); }) * scalar
+      using Rep = scaled_rep_t<typename Lhs::rep, Scalar>;
+      return typename base_dimensionFromTuple<Rep, typename Lhs::units, std::tuple<>>::dim(
+         call_unpack<typename Lhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(lhs); }) * static_cast<Rep>(scalar)
       );
    }
 
    // Multiply scalar * base_dimension
-   template<typename Rhs>
-   constexpr auto operator*(double scalar, const Rhs& rhs)
+   template<scalar_operand Scalar, is_base_dimension Rhs>
+   constexpr auto operator*(const Scalar& scalar, const Rhs& rhs)
    {
       return rhs * scalar; // Just reuse the other overload
    }
 
    // Divide base_dimension / scalar
-   template<typename Lhs>
-   constexpr auto operator/(const Lhs& lhs, double scalar)
+   template<is_base_dimension Lhs, scalar_operand Scalar>
+   constexpr auto operator/(const Lhs& lhs, const Scalar& scalar)
    {
-      return typename base_dimensionFromTuple<typename Lhs::units>::dim(
-         call_unpack<typename Lhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(lhs); }) / scalar
+      using Rep = scaled_rep_t<typename Lhs::rep, Scalar>;
+      return typename base_dimensionFromTuple<Rep, typename Lhs::units, std::tuple<>>::dim(
+         call_unpack<typename Lhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(lhs); }) / static_cast<Rep>(scalar)
       );
    }
 
    // Divide scalar / base_dimension --> flip units
-   template<typename Rhs>
-   constexpr auto operator/(double scalar, const Rhs& rhs)
+   template<scalar_operand Scalar, is_base_dimension Rhs>
+   constexpr auto operator/(const Scalar& scalar, const Rhs& rhs)
    {
-      return typename base_dimensionFromTuple<typename FlipExponents<typename Rhs::units>::units>::dim(
-         scalar / call_unpack<typename Rhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(rhs); })
+      using Rep = scaled_rep_t<typename Rhs::rep, Scalar>;
+      return typename base_dimensionFromTuple<Rep, typename FlipExponents<typename Rhs::units>::units, std::tuple<>>::dim(
+         static_cast<Rep>(scalar) / call_unpack<typename Rhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(rhs); })
       );
    }
 
@@ -491,7 +538,8 @@ namespace dimension
    template<is_base_dimension Lhs, is_base_dimension Rhs>
    constexpr auto operator+(const Lhs& lhs, const Rhs& rhs)
    {
-      return typename base_dimensionFromTuple<typename Lhs::units>::dim(
+      using Rep = std::common_type_t<typename Lhs::rep, typename Rhs::rep>;
+      return typename base_dimensionFromTuple<Rep, typename Lhs::units, std::tuple<>>::dim(
          call_unpack<typename Lhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(lhs); }) +
          call_unpack<typename Lhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(rhs); })
       );
@@ -503,7 +551,8 @@ namespace dimension
    template<is_base_dimension Lhs, is_base_dimension Rhs>
    constexpr auto operator-(const Lhs& lhs, const Rhs& rhs)
    {
-      return typename base_dimensionFromTuple<typename Lhs::units>::dim(
+      using Rep = std::common_type_t<typename Lhs::rep, typename Rhs::rep>;
+      return typename base_dimensionFromTuple<Rep, typename Lhs::units, std::tuple<>>::dim(
          call_unpack<typename Lhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(lhs); }) -
          call_unpack<typename Lhs::units>([&]<typename... Units> { return get_dimension_as<Units...>(rhs); })
       );
@@ -562,9 +611,9 @@ namespace dimension
    template<is_base_dimension T>
    [[nodiscard]] constexpr T hypot(T obj1, T obj2)
    {
-      return T(std::hypot(
-         call_unpack<typename T::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj1); }),
-         call_unpack<typename T::units>([&]<typename... Units> { return get_dimension_as<Units...>(obj2); })
+      return T(rep_traits<typename T::rep>::hypot(
+         get_dimension_tuple<typename T::units>(obj1),
+         get_dimension_tuple<typename T::units>(obj2)
       ));
    }
 
@@ -575,7 +624,8 @@ namespace dimension
    template<is_base_dimension T>
    [[nodiscard]] constexpr T abs(T obj)
    {
-      return obj < T{0} ? -obj : obj;
+      // Coefficients are positive, so the raw value alone decides the sign
+      return T(rep_traits<typename T::rep>::abs(obj.template get_tuple_scalar<typename T::units>()));
    }
 
    /// @brief Round dimension down to nearest whole number
@@ -585,8 +635,7 @@ namespace dimension
    template<is_base_dimension T>
    [[nodiscard]] constexpr T floor(const T& obj)
    {
-      return T(static_cast<PrecisionType>(static_cast<int>(get_dimension_tuple<typename T::units>(obj)) - 
-              (get_dimension_tuple<typename T::units>(obj) < static_cast<int>(get_dimension_tuple<typename T::units>(obj)))));
+      return T(rep_traits<typename T::rep>::floor(get_dimension_tuple<typename T::units>(obj)));
    }
 
    /// @brief Round dimension up to nearest whole number
@@ -596,8 +645,7 @@ namespace dimension
    template<is_base_dimension T>
    [[nodiscard]] constexpr T ceil(const T& obj)
    {
-      return T(static_cast<PrecisionType>(static_cast<int>(get_dimension_tuple<typename T::units>(obj)) +
-               (get_dimension_tuple<typename T::units>(obj) > static_cast<int>(get_dimension_tuple<typename T::units>(obj)))));
+      return T(rep_traits<typename T::rep>::ceil(get_dimension_tuple<typename T::units>(obj)));
    }
 
    /// @brief Round dimension to nearest whole number
@@ -607,9 +655,7 @@ namespace dimension
    template<is_base_dimension T>
    [[nodiscard]] constexpr T round(const T& obj)
    {
-      const auto val = get_dimension_tuple<typename T::units>(obj);
-      const auto floor_val = static_cast<PrecisionType>(static_cast<int>(val));
-      return T((val - floor_val < 0.5) ? floor_val : floor_val + 1.0);
+      return T(rep_traits<typename T::rep>::round(get_dimension_tuple<typename T::units>(obj)));
    }
 
    /// @brief Decompose dimension into integer and floating point type
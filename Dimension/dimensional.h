@@ -4,5 +4,7 @@
 #include "dimensions/dimensions.h"
 #include "dimensions/dimensional_constants.h"
 #include "dimensions/dimensional_molar_masses.h"
+#include "dimensions/dimensional_units.h"
+#include "dimensions/dimensional_format.h"
 
 #endif // DIMENSIONAL_H
\ No newline at end of file
@@ -9,10 +9,10 @@ namespace dimension
    //   These don't map to typical physical units, but are necessary to
    //   produce some derived units
    struct atmosphere_mass : public massUnit<atmosphere_mass, "Atmospheremass", "Atmospheremass"> {};
-   template<> struct Conversion<atmosphere_mass, grams> { static constexpr PrecisionType slope = 101325000.0; };
+   template<> struct Conversion<atmosphere_mass, grams> { static constexpr PrecisionType slope = 101325000.0; using ratio = std::ratio<101325000, 1>; };
 
    struct bar_mass : public massUnit<bar_mass, "Barmass", "Barmass"> {};
-   template<> struct Conversion<bar_mass, grams> { static constexpr PrecisionType slope = 100000000.0; };
+   template<> struct Conversion<bar_mass, grams> { static constexpr PrecisionType slope = 100000000.0; using ratio = std::ratio<100000000, 1>; };
 
    struct torr_mass : public massUnit<torr_mass, "Torrmass", "Torrmass"> {};
    template<> struct Conversion<torr_mass, grams> { static constexpr PrecisionType slope = 133322.31202220617; };
@@ -0,0 +1,128 @@
+#ifndef STATIC_DIMENSION_FORMAT_H
+#define STATIC_DIMENSION_FORMAT_H
+
+#include <version> // For __cpp_lib_format
+
+#if defined(__cpp_lib_format)
+
+#include <algorithm> // For std::copy
+#include <array>
+#include <charconv> // For std::to_chars, std::chars_format
+#include <format>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include "dimensional_units.h"
+
+/// @brief std::format support for dimensions
+/// @details The format spec is [.precision][e|f|g|a][;units]. Precision and presentation are those
+///    of std::to_chars, and with neither the value is written in its shortest round trip form.
+///    Units are parsed with the unit symbols of parse when the format string is checked, so units
+///    of other dimensions fail to compile. For example std::format("{:.1f;km/h}", v) gives "45.0 [km/h]".
+template<dimension::is_base_dimension Dim>
+requires std::is_arithmetic_v<typename Dim::rep>
+struct std::formatter<Dim, char>
+{
+   constexpr auto parse(std::format_parse_context& ctx)
+   {
+      auto it = ctx.begin();
+      const auto end = ctx.end();
+
+      if (it != end && *it == '.')
+      {
+         ++it;
+         if (it == end || *it < '0' || *it > '9')
+         {
+            throw std::format_error("Expected a precision after '.' in the format spec of a dimension");
+         }
+         int digits = 0;
+         for (; it != end && *it >= '0' && *it <= '9'; ++it)
+         {
+            digits = digits * 10 + (*it - '0');
+            if (digits > max_precision)
+            {
+               throw std::format_error("Precision in the format spec of a dimension is too large");
+            }
+         }
+         precision = digits;
+      }
+
+      if (it != end && (*it == 'e' || *it == 'f' || *it == 'g' || *it == 'a'))
+      {
+         presentation = *it == 'e' ? std::chars_format::scientific
+                      : *it == 'f' ? std::chars_format::fixed
+                      : *it == 'g' ? std::chars_format::general
+                      : std::chars_format::hex;
+         ++it;
+      }
+
+      if (it != end && *it == ';')
+      {
+         const auto first = ++it;
+         while (it != end && *it != '}')
+         {
+            ++it;
+         }
+         units = std::string_view(first, it);
+
+         dimension::PrecisionType scale = 1.0;
+         dimension::dimension_signature signature;
+         if (units.empty() || dimension::parse_detail::parse_units(dimension::unit_symbols, units, scale, signature) != dimension::parse_errc::ok)
+         {
+            throw std::format_error("Unknown units in the format spec of a dimension");
+         }
+         if (signature != dimension::dimension_signature_v<Dim>)
+         {
+            throw std::format_error("Units in the format spec do not match the dimensions of the value");
+         }
+         factor = dimension::primary_scale_v<Dim> / scale;
+      }
+
+      if (it != end && *it != '}')
+      {
+         throw std::format_error("Invalid format spec for a dimension");
+      }
+      return it;
+   }
+
+   template<typename FormatContext>
+   auto format(const Dim& obj, FormatContext& ctx) const
+   {
+      const auto value = units.empty()
+         ? static_cast<dimension::PrecisionType>(dimension::get_dimension_tuple<typename Dim::units>(obj))
+         : static_cast<dimension::PrecisionType>(obj.template get_tuple_scalar<typename Dim::units>()) * factor;
+
+      std::array<char, buffer_size> buffer;
+      char* const last = buffer.data() + buffer.size();
+      const auto number = precision ? std::to_chars(buffer.data(), last, value, presentation.value_or(std::chars_format::general), *precision)
+                        : presentation ? std::to_chars(buffer.data(), last, value, *presentation)
+                        : std::to_chars(buffer.data(), last, value);
+
+      auto out = std::copy(buffer.data(), number.ptr, ctx.out());
+      if (units.empty())
+      {
+         return std::copy(dimension::unit_suffix<Dim>().begin(), dimension::unit_suffix<Dim>().end(), out);
+      }
+
+      constexpr std::string_view open = " [";
+      out = std::copy(open.begin(), open.end(), out);
+      out = std::copy(units.begin(), units.end(), out);
+      *out++ = ']';
+      return out;
+   }
+
+private:
+   // Fixed notation of the largest double takes 309 digits before the point
+   static constexpr int max_precision = 64;
+   static constexpr std::size_t buffer_size = 320 + max_precision;
+
+   std::optional<int> precision;
+   std::optional<std::chars_format> presentation;
+   std::string_view units;
+   dimension::PrecisionType factor = 1.0;
+};
+
+#endif // __cpp_lib_format
+
+#endif // STATIC_DIMENSION_FORMAT_H
@@ -0,0 +1,61 @@
+#ifndef STATIC_DIMENSION_UNITS_H
+#define STATIC_DIMENSION_UNITS_H
+
+#include <optional>
+#include <string_view>
+#include <tuple>
+
+#include "dimensions.h"
+
+namespace dimension
+{
+
+   // Units of metadata/FundamentalUnits.json that can be parsed from their abbreviations
+   using parseable_units = std::tuple<
+      meters, feet, inches, astronomical_units, data_miles, nautical_miles, miles, fathoms, furlong, yards, us_survey_feet,
+      grams, pound_mass, ounces, slugs, grains, stone, short_ton, long_ton, tonne,
+      moles, pound_moles,
+      radians, degrees,
+      coulombs, elementary_charges,
+      seconds, minutes, hours,
+      kelvin, rankine
+   >;
+
+   // Units of metadata/FundamentalUnits.json that take SI prefixes
+   using si_prefixed_units = std::tuple<meters, grams, moles, coulombs, seconds, kelvin>;
+
+   /// @brief Perfect hash table of the abbreviations of all parseable units and their SI prefixed forms
+   inline constexpr auto unit_symbols = make_unit_table<parseable_units, si_prefixed_units>();
+
+   /// @brief Parse a quantity such as "12.5 km/h" into a dynamic_quantity
+   /// @throws std::invalid_argument if the text is not a quantity of known units
+   inline dynamic_quantity parse_quantity(std::string_view text)
+   {
+      return parse_quantity(unit_symbols, text);
+   }
+
+   /// @brief Parse units such as "km/h" into a dynamic_quantity of one of them
+   /// @throws std::invalid_argument if the text is not an expression of known units
+   inline dynamic_quantity parse_unit(std::string_view text)
+   {
+      return parse_unit(unit_symbols, text);
+   }
+
+   /// @brief Parse a quantity such as "12.5 km/h" into a static dimension type
+   /// @throws std::invalid_argument if the text is not a quantity or has other dimensions than Dim
+   template<is_base_dimension Dim>
+   Dim parse(std::string_view text)
+   {
+      return parse<Dim>(unit_symbols, text);
+   }
+
+   /// @brief Parse a quantity into a static dimension type without throwing
+   template<is_base_dimension Dim>
+   std::optional<Dim> try_parse(std::string_view text, parse_errc& error) noexcept
+   {
+      return try_parse<Dim>(unit_symbols, text, error);
+   }
+
+}
+
+#endif // STATIC_DIMENSION_UNITS_H
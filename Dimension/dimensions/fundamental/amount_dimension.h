@@ -8,7 +8,7 @@ namespace dimension
    struct moles : public amountUnit<moles, "Moles", "mol"> {};
    struct pound_moles : public amountUnit<pound_moles, "Pound Moles", "lbmol"> {};
 
-   template<> struct Conversion<moles, pound_moles> { static constexpr PrecisionType slope = (100000.0 / 45359237.0); };
+   template<> struct Conversion<moles, pound_moles> { static constexpr PrecisionType slope = (100000.0 / 45359237.0); using ratio = std::ratio<100000, 45359237>; };
 
    ALL_SI_PREFIXES(moles, "mol", amountUnit);
 
@@ -1,6 +1,14 @@
 #ifndef DIMENSION_ANGLE_EXTRAS_H
 #define DIMENSION_ANGLE_EXTRAS_H
 
+#include <cstddef> // For std::size_t
+#include <ranges> // For std::ranges::contiguous_range
+#include <span>
+#include <stdexcept> // For std::invalid_argument
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 namespace dimension
 {
    template<typename angleUnit>
@@ -30,6 +38,111 @@ namespace dimension
       return angle<radians>(std::atan2(get_dimension_as<Units...>(obj1) , get_dimension_as<Units...>(obj2)));
    }
 
+   // ============================================================
+   // ================ Batched Trig Functions ====================
+   // ============================================================
+
+   /// @brief Factor converting raw values of an angle type to radians
+   template<typename Dim>
+   inline constexpr auto radians_factor_v = static_cast<typename Dim::rep>(
+      coefficient_factor_v<Dim> * conversion_factor_v<typename Dim::units, std::tuple<unit_exponent<radians>>>);
+
+   /// @brief angle in radians with the given Rep, spelled angle<radians> for double
+   template<typename Rep>
+   using radians_angle_t = std::conditional_t<std::is_same_v<Rep, double>, angle<radians>, angle<Rep, radians>>;
+
+   /// @brief Sine and cosine of every element of an angle array
+   template<typename Rep>
+   struct sincos_arrays
+   {
+      std::vector<Rep> sin;
+      std::vector<Rep> cos;
+   };
+
+   /// @brief Sine and cosine of raw angles in one pass
+   /// @details The conversion from Unit to radians is folded into the vectorized kernel,
+   ///    see kernels::sincos for accuracy.
+   /// @tparam Unit Angle unit the input values are expressed in
+   /// @param angles Values to evaluate, any contiguous range such as std::span or std::vector
+   /// @param sin_out Destination for the sines, must be the same size as angles
+   /// @param cos_out Destination for the cosines, must be the same size as angles
+   template<is_angle_unit Unit, std::ranges::contiguous_range In, std::ranges::contiguous_range SinOut, std::ranges::contiguous_range CosOut>
+   requires (std::is_floating_point_v<std::ranges::range_value_t<In>> &&
+             std::is_same_v<std::ranges::range_value_t<In>, std::ranges::range_value_t<SinOut>> &&
+             std::is_same_v<std::ranges::range_value_t<In>, std::ranges::range_value_t<CosOut>>)
+   void sincos(const In& angles, SinOut&& sin_out, CosOut&& cos_out)
+   {
+      using T = std::ranges::range_value_t<In>;
+
+      const std::size_t count = std::ranges::size(angles);
+      if (std::ranges::size(sin_out) != count || std::ranges::size(cos_out) != count)
+      {
+         throw std::invalid_argument("sincos inputs and outputs must be the same size");
+      }
+
+      kernels::sincos<T>(std::ranges::data(angles), std::ranges::data(sin_out), std::ranges::data(cos_out), count,
+                         radians_factor_v<angle<T, Unit>>);
+   }
+
+   /// @brief Sine and cosine of every element of an angle array in one pass
+   /// @param angles Angles in any unit
+   /// @return The sines and cosines, in the Rep of the array
+   template<is_angle Dim, typename Allocator>
+   [[nodiscard]] sincos_arrays<typename Dim::rep> sincos(const dimension_array<Dim, Allocator>& angles)
+   {
+      using rep = typename Dim::rep;
+
+      sincos_arrays<rep> result{std::vector<rep>(angles.size()), std::vector<rep>(angles.size())};
+      kernels::sincos<rep>(angles.data(), result.sin.data(), result.cos.data(), angles.size(), radians_factor_v<Dim>);
+      return result;
+   }
+
+   /// @brief Sine of every element of an angle array, see kernels::sincos for accuracy
+   template<is_angle Dim, typename Allocator>
+   [[nodiscard]] std::vector<typename Dim::rep> sin(const dimension_array<Dim, Allocator>& angles)
+   {
+      std::vector<typename Dim::rep> result(angles.size());
+      kernels::sin<typename Dim::rep>(angles.data(), result.data(), angles.size(), radians_factor_v<Dim>);
+      return result;
+   }
+
+   /// @brief Cosine of every element of an angle array, see kernels::sincos for accuracy
+   template<is_angle Dim, typename Allocator>
+   [[nodiscard]] std::vector<typename Dim::rep> cos(const dimension_array<Dim, Allocator>& angles)
+   {
+      std::vector<typename Dim::rep> result(angles.size());
+      kernels::cos<typename Dim::rep>(angles.data(), result.data(), angles.size(), radians_factor_v<Dim>);
+      return result;
+   }
+
+   /// @brief Element-wise atan2 of two arrays of the same dimension
+   /// @details x is converted to the units of y by a factor folded into the vectorized kernel,
+   ///    see kernels::atan2 for accuracy.
+   /// @param y Array of ordinates
+   /// @param x Array of abscissas, must be the same size as y
+   /// @return The angles, in radians
+   template<is_base_dimension DimY, typename AllocY, is_base_dimension DimX, typename AllocX>
+   requires (matching_dimensions<DimY, DimX> &&
+             std::is_same_v<typename DimY::rep, typename DimX::rep> &&
+             std::is_floating_point_v<typename DimY::rep>)
+   [[nodiscard]] dimension_array<radians_angle_t<typename DimY::rep>> atan2(const dimension_array<DimY, AllocY>& y,
+                                                                           const dimension_array<DimX, AllocX>& x)
+   {
+      using rep = typename DimY::rep;
+
+      if (y.size() != x.size())
+      {
+         throw std::invalid_argument("atan2 arrays must be the same size");
+      }
+
+      constexpr auto x_scale = static_cast<rep>(coefficient_factor_v<DimX> *
+         conversion_factor_v<typename DimX::units, typename DimY::units> / coefficient_factor_v<DimY>);
+
+      auto result = dimension_array<radians_angle_t<rep>>::uninitialized(y.size());
+      kernels::atan2<rep>(y.data(), x.data(), result.data(), y.size(), x_scale);
+      return result;
+   }
+
 }
 
 #endif //DIMENSION_ANGLE_EXTRAS_H
\ No newline at end of file
@@ -17,16 +17,16 @@ namespace dimension
    struct yards : public lengthUnit<yards, "Yards", "yd"> {};
    struct us_survey_feet : public lengthUnit<us_survey_feet, "US Survey Feet", "ftUS"> {};
 
-   template<> struct Conversion<meters, feet> { static constexpr PrecisionType slope = (1250.0 / 381.0); };
-   template<> struct Conversion<meters, inches> { static constexpr PrecisionType slope = (15000.0 / 381.0); };
-   template<> struct Conversion<meters, astronomical_units> { static constexpr PrecisionType slope = (1.0 / 149597870700.0); };
-   template<> struct Conversion<meters, data_miles> { static constexpr PrecisionType slope = (5.0 / 9144.0); };
-   template<> struct Conversion<meters, nautical_miles> { static constexpr PrecisionType slope = (1.0 / 1852.0); };
-   template<> struct Conversion<meters, miles> { static constexpr PrecisionType slope = (125.0 / 201168.0); };
-   template<> struct Conversion<meters, fathoms> { static constexpr PrecisionType slope = (3937.0 / 7200.0); };
-   template<> struct Conversion<meters, furlong> { static constexpr PrecisionType slope = (3937.0 / 792000.0); };
-   template<> struct Conversion<meters, yards> { static constexpr PrecisionType slope = (1250.0 / 1143.0); };
-   template<> struct Conversion<meters, us_survey_feet> { static constexpr PrecisionType slope = (3937.0 / 1200.0); };
+   template<> struct Conversion<meters, feet> { static constexpr PrecisionType slope = (1250.0 / 381.0); using ratio = std::ratio<1250, 381>; };
+   template<> struct Conversion<meters, inches> { static constexpr PrecisionType slope = (15000.0 / 381.0); using ratio = std::ratio<15000, 381>; };
+   template<> struct Conversion<meters, astronomical_units> { static constexpr PrecisionType slope = (1.0 / 149597870700.0); using ratio = std::ratio<1, 149597870700>; };
+   template<> struct Conversion<meters, data_miles> { static constexpr PrecisionType slope = (5.0 / 9144.0); using ratio = std::ratio<5, 9144>; };
+   template<> struct Conversion<meters, nautical_miles> { static constexpr PrecisionType slope = (1.0 / 1852.0); using ratio = std::ratio<1, 1852>; };
+   template<> struct Conversion<meters, miles> { static constexpr PrecisionType slope = (125.0 / 201168.0); using ratio = std::ratio<125, 201168>; };
+   template<> struct Conversion<meters, fathoms> { static constexpr PrecisionType slope = (3937.0 / 7200.0); using ratio = std::ratio<3937, 7200>; };
+   template<> struct Conversion<meters, furlong> { static constexpr PrecisionType slope = (3937.0 / 792000.0); using ratio = std::ratio<3937, 792000>; };
+   template<> struct Conversion<meters, yards> { static constexpr PrecisionType slope = (1250.0 / 1143.0); using ratio = std::ratio<1250, 1143>; };
+   template<> struct Conversion<meters, us_survey_feet> { static constexpr PrecisionType slope = (3937.0 / 1200.0); using ratio = std::ratio<3937, 1200>; };
 
    ALL_SI_PREFIXES(meters, "m", lengthUnit);
 
@@ -15,14 +15,14 @@ namespace dimension
    struct long_ton : public massUnit<long_ton, "Long Ton", "LT"> {};
    struct tonne : public massUnit<tonne, "Tonne", "t"> {};
 
-   template<> struct Conversion<grams, pound_mass> { static constexpr PrecisionType slope = (100000.0 / 45359237.0); };
-   template<> struct Conversion<grams, ounces> { static constexpr PrecisionType slope = (1600000.0 / 45359237.0); };
-   template<> struct Conversion<grams, slugs> { static constexpr PrecisionType slope = (609600000.0 / 8896443230521.0); };
-   template<> struct Conversion<grams, grains> { static constexpr PrecisionType slope = (100000000.0 / 6479891.0); };
-   template<> struct Conversion<grams, stone> { static constexpr PrecisionType slope = (50000.0 / 317514659.0); };
-   template<> struct Conversion<grams, short_ton> { static constexpr PrecisionType slope = (50.0 / 45359237.0); };
-   template<> struct Conversion<grams, long_ton> { static constexpr PrecisionType slope = (625.0 / 635029318.0); };
-   template<> struct Conversion<grams, tonne> { static constexpr PrecisionType slope = 1e-06; };
+   template<> struct Conversion<grams, pound_mass> { static constexpr PrecisionType slope = (100000.0 / 45359237.0); using ratio = std::ratio<100000, 45359237>; };
+   template<> struct Conversion<grams, ounces> { static constexpr PrecisionType slope = (1600000.0 / 45359237.0); using ratio = std::ratio<1600000, 45359237>; };
+   template<> struct Conversion<grams, slugs> { static constexpr PrecisionType slope = (609600000.0 / 8896443230521.0); using ratio = std::ratio<609600000, 8896443230521>; };
+   template<> struct Conversion<grams, grains> { static constexpr PrecisionType slope = (100000000.0 / 6479891.0); using ratio = std::ratio<100000000, 6479891>; };
+   template<> struct Conversion<grams, stone> { static constexpr PrecisionType slope = (50000.0 / 317514659.0); using ratio = std::ratio<50000, 317514659>; };
+   template<> struct Conversion<grams, short_ton> { static constexpr PrecisionType slope = (50.0 / 45359237.0); using ratio = std::ratio<50, 45359237>; };
+   template<> struct Conversion<grams, long_ton> { static constexpr PrecisionType slope = (625.0 / 635029318.0); using ratio = std::ratio<625, 635029318>; };
+   template<> struct Conversion<grams, tonne> { static constexpr PrecisionType slope = (1.0 / 1000000.0); using ratio = std::ratio<1, 1000000>; };
 
    ALL_SI_PREFIXES(grams, "g", massUnit);
 
@@ -8,8 +8,9 @@ namespace dimension
    struct kelvin : public temperatureUnit<kelvin, "Kelvin", "K"> {};
    struct rankine : public temperatureUnit<rankine, "Rankine", "R"> {};
 
-   template<> struct Conversion<kelvin, rankine> { static constexpr PrecisionType slope = (9.0 / 5.0); };
+   template<> struct Conversion<kelvin, rankine> { static constexpr PrecisionType slope = (9.0 / 5.0); using ratio = std::ratio<9, 5>; };
 
+   ALL_SI_PREFIXES(kelvin, "K", temperatureUnit);
 
 }
 
@@ -9,8 +9,8 @@ namespace dimension
    struct minutes : public timespanUnit<minutes, "minutes", "min"> {};
    struct hours : public timespanUnit<hours, "Hours", "h"> {};
 
-   template<> struct Conversion<seconds, minutes> { static constexpr PrecisionType slope = (1.0 / 60.0); };
-   template<> struct Conversion<seconds, hours> { static constexpr PrecisionType slope = (1.0 / 3600.0); };
+   template<> struct Conversion<seconds, minutes> { static constexpr PrecisionType slope = (1.0 / 60.0); using ratio = std::ratio<1, 60>; };
+   template<> struct Conversion<seconds, hours> { static constexpr PrecisionType slope = (1.0 / 3600.0); using ratio = std::ratio<1, 3600>; };
 
    ALL_SI_PREFIXES(seconds, "s", timespanUnit);
 